@@ -2,9 +2,30 @@
 
 #include <vector>
 #include <string>
+#include <random>
+#include <fstream>
+#include <filesystem>
 #include "Benchmarks/nanobench.h"
+#ifdef _WIN32
+#include <ws2tcpip.h>
+#pragma comment(lib, "Ws2_32.lib")
+#else
+#include <arpa/inet.h>
+#endif
 #include "cpparsec.h"
+#include "cpparsec_datetime.h"
+#include "cpparsec_encoding.h"
+#include "cpparsec_expression.h"
+#include "cpparsec_net.h"
 #include "cpparsec_numeric.h"
+#include "cpparsec_optimize.h"
+#include "cpparsec_memo.h"
+#include "cpparsec_padded.h"
+#include "cpparsec_peg.h"
+#include "cpparsec_utf8.h"
+#include "cpparsec_vm.h"
+#include "tests/generated_parsers.h"
+#include "tests/test_grammars.h"
 
 using std::string, std::vector;
 using namespace cpparsec;
@@ -21,7 +42,7 @@ inline Parser<std::string> inefficient_string(const std::string& str) {
 
 Parser<vector<string>> string_csv() {
     auto nonCommaChar = [](char c) { return (c != ','); };
-    return sep_by1(many(char_satisfy(nonCommaChar)), char_(','));
+    return sep_by1(many(char_class(nonCommaChar)), char_(','));
 }
 
 void benchmark1() {
@@ -72,7 +93,97 @@ void benchmark1() {
         });
 }
 
-void int_benchmarks();
+void int_benchmarks() {
+    bool _ignore = false;
+    string int_input = "23554567";
+
+    auto int_parsers = {
+        std::pair{ "int_ parser", int_() },
+        std::pair{ "int_fromchar parser", int_fromchar() },
+        std::pair{ "int_alt parser", int_alt() },
+        std::pair{ "int_2 parser", int_2() },
+        std::pair{ "integer<int> parser", integer<int>() },
+    };
+    for (auto& [name, p] : int_parsers) {
+        ankerl::nanobench::Bench().minEpochIterations(100000).run(name, [&] {
+            ParseResult<int> num = p.parse(int_input);
+            ankerl::nanobench::doNotOptimizeAway(_ignore);
+            });
+    }
+
+    auto int64_p = integer<int64_t>();
+    string int64_input = "-9223372036854775807";
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("integer<int64_t> parser, 19 digits", [&] {
+        ParseResult<int64_t> num = int64_p.parse(int64_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+
+    auto uint64_p = integer<uint64_t>();
+    string id_input = "4096123456789012";
+    ankerl::nanobench::Bench().minEpochIterations(1000000).run("std::from_chars uint64_t, 16 digit ID", [&] {
+        uint64_t id;
+        std::from_chars(id_input.data(), id_input.data() + id_input.size(), id);
+        ankerl::nanobench::doNotOptimizeAway(id);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(1000000).run("detail::decimal_run, 16 digit ID", [&] {
+        detail::DigitRun run = detail::decimal_run(id_input, id_input.size());
+        ankerl::nanobench::doNotOptimizeAway(run);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(1000000).run("integer<uint64_t> parser, 16 digit ID", [&] {
+        ParseResult<uint64_t> num = uint64_p.parse(id_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+
+    auto uint8_p = integer<uint8_t>();
+    string uint8_input = "255";
+    ankerl::nanobench::Bench().minEpochIterations(1000000).run("integer<uint8_t> parser", [&] {
+        ParseResult<uint8_t> num = uint8_p.parse(uint8_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+
+    auto int_p = integer<int>();
+    string overflow_input = "99999999999";
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("integer<int> parser overflow reporting", [&] {
+        ParseResult<int> num = int_p.parse(overflow_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+}
+
+PaddedParser<vector<string>> padded_string_csv() {
+    auto nonCommaChar = [](char c) { return (c != ','); };
+    return sep_by1(many(char_satisfy<PaddedInput>(nonCommaChar)), char_<PaddedInput>(','));
+}
+
+void padded_benchmarks() {
+    bool _ignore = false;
+    string str_csv_input = "a, bc, def, ghij, jklmnop, qrestuvwxyz, dsiadisandiosndioni, daiondidsajhio dhsiofsdhuihrfsdfhdsifhniosdafoisadfni";
+    PaddedBuffer padded_csv_input(str_csv_input);
+
+    ankerl::nanobench::Bench().minEpochIterations(20000).run("CSV string parser, string_view", [&] {
+        std::string_view input = str_csv_input;
+        ParseResult<vector<string>> strs = string_csv().parse(input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(20000).run("CSV string parser, PaddedInput", [&] {
+        PaddedInput input = padded_csv_input.view();
+        ParseResult<vector<string>> strs = padded_string_csv().parse(input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+
+    string int_input = "23554567";
+    PaddedBuffer padded_int_input(int_input);
+
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("integer parser, string_view", [&] {
+        std::string_view input = int_input;
+        ParseResult<int> num = int_().parse(input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("integer parser, PaddedInput", [&] {
+        PaddedInput input = padded_int_input.view();
+        ParseResult<int> num = int_<PaddedInput>().parse(input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+}
 
 Parser<std::vector<int>> spaced_ints() {
     return many(int_().skip(spaces()));
@@ -101,6 +212,22 @@ void macro_benchmarks() {
 
         ankerl::nanobench::doNotOptimizeAway(_ignore);
         });
+
+    Parser<vector<int>> ints = int_list<int>(" ");
+    ankerl::nanobench::Bench().minEpochIterations(50000).run("int_list parser", [&] {
+        ParseResult<vector<int>> num = ints.parse("0 1732 -2783723 1723 -23823 281 +0237 12 2 +23");
+
+        ankerl::nanobench::doNotOptimizeAway(num);
+        });
+
+    vector<int> values;
+    Parser<size_t> ints_into = int_list<int>(" ", values);
+    ankerl::nanobench::Bench().minEpochIterations(50000).run("int_list parser, reused vector", [&] {
+        values.clear();
+        ParseResult<size_t> count = ints_into.parse("0 1732 -2783723 1723 -23823 281 +0237 12 2 +23");
+
+        ankerl::nanobench::doNotOptimizeAway(count);
+        });
 }
 
 void between_benchmarks() {
@@ -143,6 +270,804 @@ void between_benchmarks() {
     //    });
 }
 
+void decimal_benchmarks() {
+    bool _ignore = false;
+    string price = "-1234567.8912";
+
+    // copying the digits out and scaling by hand, the way prices are read today
+    auto as_string = many1(char_satisfy([](char c) { return isdigit(c) || c == '-' || c == '.'; }))
+        .transform([](const string& text) {
+            size_t dot = text.find('.');
+            string fraction = dot == string::npos ? "" : text.substr(dot + 1);
+            fraction.resize(4, '0');
+            int64_t whole = std::stoll(text.substr(0, dot));
+            int64_t scaled = std::stoll(fraction);
+            return whole * 10000 + (text[0] == '-' ? -scaled : scaled);
+        });
+
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("many1 char_satisfy + stoll price parser", [&] {
+        auto value = as_string.parse(price);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+
+    auto fixed = decimal<4>();
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("decimal<4> price parser", [&] {
+        ParseResult<int64_t> value = fixed.parse(price);
+        ankerl::nanobench::doNotOptimizeAway(value);
+        });
+}
+
+void hex_benchmarks() {
+    bool _ignore = false;
+
+    auto per_char = many1(char_satisfy(isxdigit)).transform([](const string& digits) { return std::stoull(digits, nullptr, 16); });
+    auto hex_p = hex_integer<uint64_t>();
+    string address = "0x00007ffd5a3b1c40";
+
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("many1 isxdigit + stoull parser, address", [&] {
+        std::string_view input = std::string_view(address).substr(2);
+        ParseResult<unsigned long long> value = per_char.parse(input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("hex_integer<uint64_t> parser, address", [&] {
+        ParseResult<uint64_t> value = hex_p.parse(address);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+
+    string digest_text;
+    for (int i = 0; i < 64; i++) {
+        digest_text += "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+    }
+    std::vector<uint8_t> digest(digest_text.size() / 2);
+    auto bytes_p = hex_bytes(digest);
+
+    ankerl::nanobench::Bench().minEpochIterations(10000).run("hex_bytes parser, 2KB digest", [&] {
+        ParseResult<std::span<uint8_t>> bytes = bytes_p.parse(digest_text);
+        ankerl::nanobench::doNotOptimizeAway(digest.data());
+        });
+}
+
+void float_benchmarks() {
+    // 10M numbers in a file, a mix of short decimals, long decimals and exponents
+    const size_t count = 10'000'000;
+    auto path = std::filesystem::temp_directory_path() / "cpparsec_floats.txt";
+    {
+        std::mt19937_64 rng(42);
+        std::uniform_real_distribution<double> dist(-1e6, 1e6);
+        std::ofstream file(path, std::ios::binary);
+        char buffer[64];
+        for (size_t i = 0; i < count; i++) {
+            double value = dist(rng);
+            auto [end, ec] = (i % 3 == 0) ? std::to_chars(buffer, buffer + 64, value, std::chars_format::fixed, 2)
+                : (i % 3 == 1) ? std::to_chars(buffer, buffer + 64, value)
+                : std::to_chars(buffer, buffer + 64, value, std::chars_format::scientific);
+            file.write(buffer, end - buffer).put('\n');
+        }
+    }
+    PaddedBuffer floats = PaddedBuffer::from_file(path).value();
+
+    ankerl::nanobench::Bench().epochs(3).run("std::from_chars double, 10M numbers", [&] {
+        std::string_view input = floats.view();
+        double sum = 0;
+        while (!input.empty()) {
+            double value;
+            auto [end, ec] = std::from_chars(input.data(), input.data() + input.size(), value);
+            sum += value;
+            input.remove_prefix(end - input.data() + 1);
+        }
+        ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+
+    auto double_p = double_();
+    ankerl::nanobench::Bench().epochs(3).run("double_ parser, 10M numbers", [&] {
+        std::string_view input = floats.view();
+        double sum = 0;
+        while (!input.empty()) {
+            sum += *double_p.parse(input);
+            input.remove_prefix(1);
+        }
+        ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+
+    auto padded_double_p = double_<PaddedInput>();
+    ankerl::nanobench::Bench().epochs(3).run("double_ parser, 10M numbers, PaddedInput", [&] {
+        PaddedInput input = floats.view();
+        double sum = 0;
+        while (!input.empty()) {
+            sum += *padded_double_p.parse(input);
+            input.remove_prefix(1);
+        }
+        ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+
+    std::filesystem::remove(path);
+}
+
+void take_until_benchmarks() {
+    bool _ignore = false;
+    string comment = "/*" + string(2000, 'x') + "* not yet *" + string(2000, 'y') + "*/";
+
+    ankerl::nanobench::Bench().minEpochIterations(1000).run("many_till comment parser", [&] {
+        ParseResult<string> body = (string_("/*") >> many_till(any_char(), try_(string_("*/")))).parse(comment);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    auto optimized_comment = optimize(string_("/*") >> many_till(any_char(), try_(string_("*/"))));
+    ankerl::nanobench::Bench().minEpochIterations(1000).run("many_till comment parser, optimized", [&] {
+        ParseResult<string> body = optimized_comment.parse(comment);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(1000).run("take_until comment parser", [&] {
+        ParseResult<std::string_view> body = (string_("/*") >> take_until("*/")).parse(comment);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+}
+
+void quoted_string_benchmarks() {
+    bool _ignore = false;
+    string field = "\"" + string(200, 'x') + "\\n" + string(200, 'y') + "\": 1";
+
+    auto escape = char_('\\') >> char_satisfy([](char c) { return c == '"' || c == '\\' || c == 'n'; })
+        .transform([](char c) { return c == 'n' ? '\n' : c; });
+    auto per_char = char_('"') >> many_till(try_(escape) | any_char(), char_('"'));
+
+    ankerl::nanobench::Bench().minEpochIterations(1000).run("many_till escape | any_char string parser", [&] {
+        ParseResult<string> text = per_char.parse(field);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+
+    string buffer;
+    auto quoted = quoted_string('"', EscapeRules::json, buffer);
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("quoted_string parser, one escape", [&] {
+        ParseResult<std::string_view> text = quoted.parse(field);
+        ankerl::nanobench::doNotOptimizeAway(text);
+        });
+
+    string plain = "\"" + string(400, 'x') + "\": 1";
+    ankerl::nanobench::Bench().minEpochIterations(1000000).run("quoted_string parser, no escapes", [&] {
+        ParseResult<std::string_view> text = quoted.parse(plain);
+        ankerl::nanobench::doNotOptimizeAway(text);
+        });
+}
+
+void timestamp_benchmarks() {
+    bool _ignore = false;
+    string line = "2024-03-09T14:07:31.250Z INFO request served";
+
+    // fields from count(n, digit()) and std::stoi, the way log parsers are written today
+    auto field = [](int n) {
+        return count(n, digit()).transform([](const vector<char>& digits) { return std::stoi(string(digits.begin(), digits.end())); });
+    };
+    auto per_field = field(4).skip(char_('-')) & field(2).skip(char_('-')) & field(2).skip(char_('T'))
+        & field(2).skip(char_(':')) & field(2).skip(char_(':')) & field(2);
+    auto fraction = optional_(char_('.') >> many1(digit()));
+    auto combinator = per_field.skip(fraction).skip(char_('Z'));
+
+    ankerl::nanobench::Bench().minEpochIterations(10000).run("count digit timestamp parser", [&] {
+        auto fields = combinator.parse(line);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+
+    auto timestamp = rfc3339();
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("rfc3339 parser", [&] {
+        ParseResult<Timestamp> time = timestamp.parse(line);
+        ankerl::nanobench::doNotOptimizeAway(time);
+        });
+}
+
+void address_benchmarks() {
+    string v4 = "203.0.113.195";
+    string v6 = "2001:db8:85a3::8a2e:370:7334";
+
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("inet_pton, IPv4", [&] {
+        in_addr address;
+        int ok = inet_pton(AF_INET, v4.c_str(), &address);
+        ankerl::nanobench::doNotOptimizeAway(ok);
+        });
+    auto v4_p = ipv4();
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("ipv4 parser", [&] {
+        ParseResult<uint32_t> address = v4_p.parse(v4);
+        ankerl::nanobench::doNotOptimizeAway(address);
+        });
+
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("inet_pton, IPv6", [&] {
+        in6_addr address;
+        int ok = inet_pton(AF_INET6, v6.c_str(), &address);
+        ankerl::nanobench::doNotOptimizeAway(ok);
+        });
+    auto v6_p = ipv6();
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("ipv6 parser", [&] {
+        ParseResult<std::array<uint8_t, 16>> address = v6_p.parse(v6);
+        ankerl::nanobench::doNotOptimizeAway(address);
+        });
+}
+
+void decoding_benchmarks() {
+    bool _ignore = false;
+
+    std::mt19937 rng(7);
+    string payload;
+    const char* alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    for (int i = 0; i < 4096; i++) {
+        payload += alphabet[rng() % 64];
+    }
+    payload += "\"}";
+
+    // copying the field out, then decoding it in a second pass
+    auto copy_out = many1(char_satisfy([](char c) { return isalnum(c) || c == '+' || c == '/'; }))
+        .transform([](const string& digits) {
+            vector<uint8_t> bytes;
+            uint32_t bits = 0;
+            int count = 0;
+            for (char c : digits) {
+                bits = (bits << 6) | (uint32_t)(strchr("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/", c) - "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/");
+                if (++count % 4 == 0) {
+                    bytes.insert(bytes.end(), { uint8_t(bits >> 16), uint8_t(bits >> 8), uint8_t(bits) });
+                }
+            }
+            return bytes;
+        });
+
+    ankerl::nanobench::Bench().minEpochIterations(100).run("many1 char_satisfy + decode, 4KB base64", [&] {
+        auto bytes = copy_out.parse(payload);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+
+    vector<uint8_t> bytes;
+    auto base64 = base64_decode(Base64Alphabet::standard, bytes);
+    ankerl::nanobench::Bench().minEpochIterations(10000).run("base64_decode parser, 4KB", [&] {
+        bytes.clear();
+        ParseResult<size_t> count = base64.parse(payload);
+        ankerl::nanobench::doNotOptimizeAway(count);
+        });
+
+    string query = "q=" + string(200, 'x') + "%20cpparsec%2Fparsers+and+combinators&page=2";
+    auto per_char = many(try_(char_('%') >> count(2, char_satisfy(isxdigit)).transform([](const vector<char>& hex) {
+        return static_cast<char>(std::stoi(string(hex.begin(), hex.end()), nullptr, 16));
+        })) | char_satisfy([](char c) { return c != '&'; }));
+
+    ankerl::nanobench::Bench().minEpochIterations(1000).run("many escape | char_satisfy, query", [&] {
+        std::string_view input = std::string_view(query).substr(2);
+        auto value = per_char.parse(input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+
+    string value;
+    auto percent = percent_decode("&", value, true);
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("percent_decode parser, query", [&] {
+        std::string_view input = std::string_view(query).substr(2);
+        value.clear();
+        ParseResult<size_t> count = percent.parse(input);
+        ankerl::nanobench::doNotOptimizeAway(count);
+        });
+}
+
+void case_insensitive_benchmarks() {
+    bool _ignore = false;
+    string header = "CONTENT-LENGTH: 1234";
+
+    // lowercasing every character through char_satisfy, the usual workaround
+    Parser<std::monostate> per_char = success<std::string_view>(std::monostate{});
+    for (char c : string("content-length")) {
+        per_char = per_char << char_satisfy([c](char x) { return tolower(x) == c; });
+    }
+
+    ankerl::nanobench::Bench().minEpochIterations(10000).run("char_satisfy tolower header parser", [&] {
+        ParseResult<std::monostate> name = per_char.parse(header);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    auto content_length = string_ci("Content-Length");
+    ankerl::nanobench::Bench().minEpochIterations(10000).run("string_ci header parser", [&] {
+        ParseResult<std::string_view> name = content_length.parse(header);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+
+    auto sql = keywords_ci({ "select", "insert", "update", "delete", "from", "where", "set", "values" });
+    auto sql_choice = choice<std::string_view, std::string_view>({ string_ci("select"), string_ci("insert"), string_ci("update"),
+        string_ci("delete"), string_ci("from"), string_ci("where"), string_ci("set"), string_ci("values") });
+    string statement = "UPDATE";
+
+    ankerl::nanobench::Bench().minEpochIterations(10000).run("choice of string_ci keyword parser", [&] {
+        ParseResult<std::string_view> word = sql_choice.parse(statement);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("keywords_ci keyword parser", [&] {
+        ParseResult<std::string_view> word = sql.parse(statement);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+}
+
+void utf8_benchmarks() {
+    bool _ignore = false;
+    string ascii_word(200, 'x');
+
+    ankerl::nanobench::Bench().minEpochIterations(10000).run("skip_many letter parser, ASCII", [&] {
+        ParseResult<std::monostate> word = skip_many(letter()).parse(ascii_word);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(10000).run("skip_many unicode_letter parser, ASCII", [&] {
+        ParseResult<std::monostate> word = skip_many(unicode_letter()).parse(ascii_word);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(10000).run("take_while_codepoint letter parser, ASCII", [&] {
+        ParseResult<std::string_view> word = take_while_codepoint(is_unicode_letter).parse(ascii_word);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+
+    string mostly_ascii;
+    for (int i = 0; i < 10000; i++) {
+        mostly_ascii += "some ascii log text, caf\xC3\xA9 \xE2\x82\xAC" "12 ";
+    }
+
+    ankerl::nanobench::Bench().minEpochIterations(100).run("valid_utf8 parser, 500KB mostly ASCII", [&] {
+        ParseResult<std::string_view> text = valid_utf8().parse(mostly_ascii);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+}
+
+void optimize_benchmarks() {
+    bool _ignore = false;
+    string str_csv_input = "a, bc, def, ghij, jklmnop, qrestuvwxyz, dsiadisandiosndioni, daiondidsajhio dhsiofsdhuihrfsdfhdsifhniosdafoisadfni";
+
+    // idiomatic grammars, built once, then rewritten by optimize
+    auto csv = string_csv();
+    auto csv_optimized = optimize(csv);
+    auto csv_hand_tuned = CPPARSEC_MAKE(Parser<vector<string>>) {
+        vector<string> fields;
+        while (true) {
+            size_t comma = input.find(',');
+            fields.emplace_back(input.substr(0, comma));
+            if (comma == string::npos) {
+                input.remove_prefix(input.size());
+                return fields;
+            }
+            input.remove_prefix(comma + 1);
+        }
+    };
+
+    ankerl::nanobench::Bench().minEpochIterations(20000).run("CSV string parser, prebuilt", [&] {
+        ParseResult<vector<string>> strs = csv.parse(str_csv_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(20000).run("CSV string parser, optimized", [&] {
+        ParseResult<vector<string>> strs = csv_optimized.parse(str_csv_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(20000).run("CSV string parser, hand-tuned", [&] {
+        ParseResult<vector<string>> strs = csv_hand_tuned.parse(str_csv_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+
+    // a tag name after "<!", whitespace skipped, the sign of the tag picked by a choice of char_
+    string tag_input = "<!--   doctype+";
+    auto tag = char_('<') >> char_('!') >> char_('-') >> char_('-') >> skip(many(space())) >> many1(letter()) << (char_('+') | char_('-'));
+    auto tag_optimized = optimize(tag);
+    auto tag_hand_tuned = CPPARSEC_MAKE(Parser<string>) {
+        CPPARSEC_FAIL_IF(!input.starts_with("<!--"), ParseError("<!--", string(input.substr(0, 4))));
+        size_t start = input.find_first_not_of(" \t\n\v\f\r", 4);
+        size_t end = start;
+        while (end < input.size() && isalpha(static_cast<unsigned char>(input[end]))) {
+            end++;
+        }
+        CPPARSEC_FAIL_IF(start == end || end == input.size() || (input[end] != '+' && input[end] != '-'), ParseError("tag"));
+
+        string name(input.substr(start, end - start));
+        input.remove_prefix(end + 1);
+        return name;
+    };
+
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("tag parser, prebuilt", [&] {
+        ParseResult<string> name = tag.parse(tag_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("tag parser, optimized", [&] {
+        ParseResult<string> name = tag_optimized.parse(tag_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("tag parser, hand-tuned", [&] {
+        ParseResult<string> name = tag_hand_tuned.parse(tag_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+
+    // whitespace skipping with a dropped many, the idiom optimize turns into a scan
+    string spaced(200, ' ');
+    auto blanks = skip(many(char_(' ') | char_('\t')));
+    auto blanks_optimized = optimize(blanks);
+    auto blanks_hand_tuned = CPPARSEC_MAKE(Parser<std::monostate>) {
+        input.remove_prefix(std::min(input.find_first_not_of(" \t"), input.size()));
+        return std::monostate{};
+    };
+
+    ankerl::nanobench::Bench().minEpochIterations(10000).run("skip(many(blank)) parser, prebuilt", [&] {
+        ParseResult<std::monostate> skipped = blanks.parse(spaced);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(10000).run("skip(many(blank)) parser, optimized", [&] {
+        ParseResult<std::monostate> skipped = blanks_optimized.parse(spaced);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(10000).run("skip(many(blank)) parser, hand-tuned", [&] {
+        ParseResult<std::monostate> skipped = blanks_hand_tuned.parse(spaced);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+}
+
+void choice_benchmarks() {
+    bool _ignore = false;
+
+    // a statement keyword, the last of eight alternatives with distinct first bytes
+    string statement_input = "values (1, 2)";
+    vector<Parser<string>> keywords;
+    for (string keyword : { "select", "insert", "update", "delete", "create", "drop", "alter", "values" }) {
+        keywords.push_back(try_(string_(keyword)));
+    }
+    auto statement = choice(keywords);
+
+    // or_ as it was, each alternative tried in order
+    auto in_order = [](const vector<Parser<string>>& alternatives) {
+        return CPPARSEC_MAKE(Parser<string>) {
+            for (size_t i = 0; ; i++) {
+                auto start = input.data();
+                auto result = alternatives[i].parse(input);
+                if (result || start != input.data() || i + 1 == alternatives.size()) {
+                    return result;
+                }
+            }
+        };
+    };
+    auto statement_in_order = in_order(keywords);
+
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("keyword choice parser, in order", [&] {
+        ParseResult<string> word = statement_in_order.parse(statement_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("keyword choice parser, dispatched", [&] {
+        ParseResult<string> word = statement.parse(statement_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+
+    // a JSON-like scalar, a number after three literals
+    string value_input = "12345,";
+    vector<Parser<string>> scalars = { string_("null"), string_("true"), string_("false"), many1(digit()) };
+    auto value = choice(scalars);
+    auto value_in_order = in_order(scalars);
+
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("scalar choice parser, in order", [&] {
+        ParseResult<string> scalar = value_in_order.parse(value_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(100000).run("scalar choice parser, dispatched", [&] {
+        ParseResult<string> scalar = value.parse(value_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+}
+
+// expr := term '+' expr | term '-' expr | term, term := '(' expr ')' | digit
+// Without memo every level parses the level inside it three times, 3^depth in all
+struct NestedSum {
+    Parser<char> term;
+    Parser<char> expr;
+
+    explicit NestedSum(bool memoized) :
+        term(memoize(memoized, try_(char_('(') >> lazy(std::function([this] { return expr; })) << char_(')')) | digit())),
+        expr(memoize(memoized, try_(term >> char_('+') >> lazy(std::function([this] { return expr; })))
+            | try_(term >> char_('-') >> lazy(std::function([this] { return expr; }))) | term))
+    { }
+
+    NestedSum(const NestedSum&) = delete;
+
+    static Parser<char> memoize(bool memoized, const Parser<char>& p) {
+        return memoized ? memo(p) : p;
+    }
+};
+
+void memo_benchmarks() {
+    bool _ignore = false;
+    NestedSum plain(false);
+    NestedSum memoized(true);
+
+    for (int depth : { 4, 8, 12 }) {
+        string nested = string(depth, '(') + "1" + string(depth, ')');
+
+        ankerl::nanobench::Bench().minEpochIterations(depth < 12 ? 100 : 2).run(std::format("nested sum depth {} parser, plain", depth), [&] {
+            ParseResult<char> sum = plain.expr.parse(nested);
+            ankerl::nanobench::doNotOptimizeAway(_ignore);
+            });
+        ankerl::nanobench::Bench().minEpochIterations(10000).run(std::format("nested sum depth {} parser, packrat", depth), [&] {
+            ParseResult<char> sum = packrat(memoized.expr).parse(nested);
+            ankerl::nanobench::doNotOptimizeAway(_ignore);
+            });
+    }
+
+    // a long input parsed with a bounded table
+    string long_sum;
+    for (int i = 0; i < 1000; i++) {
+        long_sum += "(1)+";
+    }
+    long_sum += "1";
+    auto windowed = packrat(memoized.expr, { .window = 64 });
+    auto unbounded = packrat(memoized.expr);
+
+    ankerl::nanobench::Bench().minEpochIterations(100).run("1000 term sum parser, plain", [&] {
+        ParseResult<char> sum = plain.expr.parse(long_sum);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(100).run("1000 term sum parser, packrat", [&] {
+        ParseResult<char> sum = unbounded.parse(long_sum);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(100).run("1000 term sum parser, packrat window 64", [&] {
+        ParseResult<char> sum = windowed.parse(long_sum);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+}
+
+void left_recursion_benchmarks() {
+    bool _ignore = false;
+    auto add = [](std::tuple<int, int> operands) { return std::get<0>(operands) + std::get<1>(operands); };
+    auto mul = [](std::tuple<int, int> operands) { return std::get<0>(operands) * std::get<1>(operands); };
+    auto add_op = success(std::function<int(int, int)>([](int a, int b) { return a + b; }));
+    auto mul_op = success(std::function<int(int, int)>([](int a, int b) { return a * b; }));
+
+    // left recursive grammar
+    Rule<int> expr("expr"), term("term");
+    expr = (expr << char_('+') & term).transform(add) | term;
+    term = (term << char_('*') & int_()).transform(mul) | int_();
+
+    // the same grammar with the left recursion transformed away by hand
+    Parser<int> chained = chainl1(chainl1(int_(), char_('*') >> mul_op), char_('+') >> add_op);
+
+    string sum = "1";
+    for (int i = 1; i < 100; i++) {
+        sum += i % 2 == 0 ? "+" : "*";
+        sum += std::to_string(i % 10);
+    }
+    auto memoized = packrat(Parser<int>(expr), { .memoize_rules = true });
+
+    ankerl::nanobench::Bench().minEpochIterations(1000).run("100 term sum parser, left recursive rules", [&] {
+        ParseResult<int> result = expr.parse(sum);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(1000).run("100 term sum parser, left recursive rules packrat", [&] {
+        ParseResult<int> result = memoized.parse(sum);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(1000).run("100 term sum parser, chainl1", [&] {
+        ParseResult<int> result = chained.parse(sum);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+}
+
+void expression_benchmarks() {
+    bool _ignore = false;
+    using Apply = std::function<unsigned(unsigned, unsigned)>;
+
+    // C-like binary operators, loosest level first
+    vector<vector<std::pair<string, Apply>>> levels = {
+        { { "||", [](unsigned a, unsigned b) { return unsigned(a || b); } } },
+        { { "&&", [](unsigned a, unsigned b) { return unsigned(a && b); } } },
+        { { "|", [](unsigned a, unsigned b) { return a | b; } } },
+        { { "^", [](unsigned a, unsigned b) { return a ^ b; } } },
+        { { "&", [](unsigned a, unsigned b) { return a & b; } } },
+        { { "==", [](unsigned a, unsigned b) { return unsigned(a == b); } }, { "!=", [](unsigned a, unsigned b) { return unsigned(a != b); } } },
+        { { "<=", [](unsigned a, unsigned b) { return unsigned(a <= b); } }, { ">=", [](unsigned a, unsigned b) { return unsigned(a >= b); } },
+          { "<", [](unsigned a, unsigned b) { return unsigned(a < b); } }, { ">", [](unsigned a, unsigned b) { return unsigned(a > b); } } },
+        { { "<<", [](unsigned a, unsigned b) { return a << (b & 31); } }, { ">>", [](unsigned a, unsigned b) { return a >> (b & 31); } } },
+        { { "+", [](unsigned a, unsigned b) { return a + b; } }, { "-", [](unsigned a, unsigned b) { return a - b; } } },
+        { { "*", [](unsigned a, unsigned b) { return a * b; } }, { "/", [](unsigned a, unsigned b) { return a / b; } },
+          { "%", [](unsigned a, unsigned b) { return a % b; } } },
+    };
+    auto negate = [](unsigned a) { return 0u - a; };
+    Parser<unsigned> operand = digit().transform([](char c) { return unsigned(c - '0'); });
+
+    // one chainl1 per level, symbols that start a longer one of a looser level are not followed by its rest
+    Parser<unsigned> chained = (char_('-') >> operand).transform(negate) | operand;
+    for (auto level = levels.rbegin(); level != levels.rend(); ++level) {
+        vector<Parser<Apply>> ops;
+        for (const auto& [symbol, apply] : *level) {
+            Parser<string> matched = try_(string_(symbol));
+            if (symbol == "|" || symbol == "&") {
+                matched = try_(string_(symbol) << not_followed_by(char_(symbol[0])));
+            }
+            ops.push_back(matched >> success(apply));
+        }
+        chained = chainl1(chained, choice(ops));
+    }
+
+    OperatorTable<unsigned> table;
+    for (int precedence = 0; precedence < int(levels.size()); precedence++) {
+        for (const auto& [symbol, apply] : levels[precedence]) {
+            table.infix(symbol, precedence, Associativity::left, apply);
+        }
+    }
+    table.prefix("-", int(levels.size()), negate);
+    Parser<unsigned> pratt = expression_parser(operand, table);
+
+    string expression;
+    std::mt19937 random(42);
+    for (int i = 0; i < 200; i++) {
+        const auto& level = levels[random() % levels.size()];
+        expression += (random() % 4 == 0 ? "-" : "") + std::to_string(1 + random() % 9);
+        expression += i + 1 < 200 ? level[random() % level.size()].first : "";
+    }
+    ankerl::nanobench::doNotOptimizeAway(*chained.parse(expression) == *pratt.parse(expression));
+
+    ankerl::nanobench::Bench().minEpochIterations(1000).run("200 operand expression parser, chainl1 per level", [&] {
+        ParseResult<unsigned> result = chained.parse(expression);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(1000).run("200 operand expression parser, expression_parser", [&] {
+        ParseResult<unsigned> result = pratt.parse(expression);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+}
+
+void chain_benchmarks() {
+    bool _ignore = false;
+    enum class Op { add, subtract };
+
+    Parser<int> operand = digit().transform([](char c) { return c - '0'; });
+    auto erased = chainl1(operand, char_('+') >> success(std::function<int(int, int)>(std::plus<int>{}))
+        | char_('-') >> success(std::function<int(int, int)>(std::minus<int>{})));
+    auto tagged = chainl1(operand, char_('+') >> success(Op::add) | char_('-') >> success(Op::subtract),
+        [](Op op, int a, int b) { return op == Op::add ? a + b : a - b; });
+    auto sum_only = chainl1(operand, char_('+') >> success(std::plus<int>{}));
+
+    string sum = "1";
+    for (int i = 1; i < 1000; i++) {
+        sum += "+" + std::to_string(i % 10);
+    }
+
+    ankerl::nanobench::Bench().minEpochIterations(1000).run("1000 term sum parser, chainl1 std::function operators", [&] {
+        ParseResult<int> result = erased.parse(sum);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(1000).run("1000 term sum parser, chainl1 enum operators", [&] {
+        ParseResult<int> result = tagged.parse(sum);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(1000).run("1000 term sum parser, chainl1 std::plus", [&] {
+        ParseResult<int> result = sum_only.parse(sum);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+}
+
+void vm_benchmarks() {
+    bool _ignore = false;
+    string str_csv_input = "a, bc, def, ghij, jklmnop, qrestuvwxyz, dsiadisandiosndioni, daiondidsajhio dhsiofsdhuihrfsdfhdsifhniosdafoisadfni";
+    string int_list_input = "1 22 333 4444 55555 666666 7777777 88888888 999999999 123 456 789 1011 1213 1415 1617 1819";
+
+    // the same grammars run by their closures and by the bytecode machine
+    auto csv = string_csv();
+    auto csv_bytecode = bytecode(csv);
+    auto ints = spaced_ints();
+    auto ints_bytecode = bytecode(ints);
+    Parser<vector<string>> digit_runs = many(many1(digit()) << spaces());
+    auto digit_runs_bytecode = bytecode(digit_runs);
+
+    ankerl::nanobench::Bench().minEpochIterations(20000).run("CSV string parser, closures", [&] {
+        ParseResult<vector<string>> strs = csv.parse(str_csv_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(20000).run("CSV string parser, bytecode", [&] {
+        ParseResult<vector<string>> strs = csv_bytecode.parse(str_csv_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(20000).run("int list parser, closures", [&] {
+        ParseResult<vector<int>> nums = ints.parse(int_list_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(20000).run("int list parser, bytecode with int_ callouts", [&] {
+        ParseResult<vector<int>> nums = ints_bytecode.parse(int_list_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(20000).run("digit run list parser, closures", [&] {
+        ParseResult<vector<string>> runs = digit_runs.parse(int_list_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(20000).run("digit run list parser, bytecode", [&] {
+        ParseResult<vector<string>> runs = digit_runs_bytecode.parse(int_list_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+}
+
+void codegen_benchmarks() {
+    bool _ignore = false;
+    string str_csv_input = "a, bc, def, ghij, jklmnop, qrestuvwxyz, dsiadisandiosndioni, daiondidsajhio dhsiofsdhuihrfsdfhdsifhniosdafoisadfni";
+    string digit_runs_input = "1, 22, 333, 4444, 55555, 666666, 7777777, 88888888, 999999999, 123, 456, 789, 1011, 1213, 1415, 1617, 1819";
+
+    // the grammars of tests/test_grammars.h, as closures and as generated by generate_parsers
+    auto csv = test_grammars::csv();
+    auto digit_runs = test_grammars::digit_runs();
+
+    ankerl::nanobench::Bench().minEpochIterations(20000).run("CSV string parser, closures", [&] {
+        ParseResult<vector<string>> strs = csv.parse(str_csv_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(20000).run("CSV string parser, generated", [&] {
+        ParseResult<vector<string>> strs = generated::csv(str_csv_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(20000).run("digit run list parser, closures", [&] {
+        ParseResult<vector<string>> runs = digit_runs.parse(digit_runs_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+    ankerl::nanobench::Bench().minEpochIterations(20000).run("digit run list parser, generated", [&] {
+        ParseResult<vector<string>> runs = generated::digit_runs(digit_runs_input);
+        ankerl::nanobench::doNotOptimizeAway(_ignore);
+        });
+}
+
+void peg_benchmarks() {
+    bool _ignore = false;
+    vector<string> log_lines = {
+        "2024-05-01 INFO [main] Started server on port 8080",
+        "2024-05-01 DEBUG [worker_3] Accepted connection from 10.0.0.7",
+        "2024-05-01 WARN [gc] Pause of 212 ms exceeded the target",
+        "2024-05-02 ERROR [worker_12] Request /api/v2/items timed out after 30000 ms",
+    };
+
+    // the same log format, loaded at runtime and written with combinators
+    ParseResult<Grammar> log = load_grammar(R"(
+        entry   <- date:[0-9-]+ ' ' level:level ' [' thread:[a-zA-Z0-9_]+ '] ' message:.*
+        level   <- 'DEBUG' / 'INFO' / 'WARN' / 'ERROR'
+    )");
+    Parser<Fields> log_fields = log->fields();
+    Parser<Capture> log_captures = log->captures();
+    Parser<string> date = many1(digit() | char_('-')) << char_(' ');
+    Parser<std::string_view> level = keywords({ "DEBUG", "INFO", "WARN", "ERROR" }) << string_(" [");
+    Parser<string> thread = many1(alpha_num() | char_('_')) << string_("] ");
+    Parser<string> message = many(any_char());
+    auto entry = CPPARSEC_MAKE(Parser<std::tuple<string, std::string_view, string, string>>) {
+        CPPARSEC_SAVE(d, date);
+        CPPARSEC_SAVE(l, level);
+        CPPARSEC_SAVE(t, thread);
+        CPPARSEC_SAVE(m, message);
+        return std::tuple(d, l, t, m);
+    };
+
+    ankerl::nanobench::Bench().minEpochIterations(20000).run("log lines, combinators", [&] {
+        for (const string& line : log_lines) {
+            auto fields = entry.parse(line);
+            ankerl::nanobench::doNotOptimizeAway(fields);
+        }
+        });
+    ankerl::nanobench::Bench().minEpochIterations(20000).run("log lines, loaded PEG fields", [&] {
+        for (const string& line : log_lines) {
+            ParseResult<Fields> fields = log_fields.parse(line);
+            ankerl::nanobench::doNotOptimizeAway(fields);
+        }
+        });
+    ankerl::nanobench::Bench().minEpochIterations(20000).run("log lines, loaded PEG captures", [&] {
+        for (const string& line : log_lines) {
+            ParseResult<Capture> captures = log_captures.parse(line);
+            ankerl::nanobench::doNotOptimizeAway(captures);
+        }
+        });
+    ankerl::nanobench::doNotOptimizeAway(_ignore);
+}
+
 int main() {
     benchmark1();
+    int_benchmarks();
+    macro_benchmarks();
+    decimal_benchmarks();
+    hex_benchmarks();
+    float_benchmarks();
+    take_until_benchmarks();
+    quoted_string_benchmarks();
+    timestamp_benchmarks();
+    address_benchmarks();
+    decoding_benchmarks();
+    case_insensitive_benchmarks();
+    padded_benchmarks();
+    utf8_benchmarks();
+    optimize_benchmarks();
+    choice_benchmarks();
+    memo_benchmarks();
+    left_recursion_benchmarks();
+    expression_benchmarks();
+    chain_benchmarks();
+    vm_benchmarks();
+    codegen_benchmarks();
+    peg_benchmarks();
 }
@@ -1,105 +1,199 @@
 #ifndef CPPARSEC_CHAR_H
 #define CPPARSEC_CHAR_H
 
+#include <memory>
+#include <optional>
 #include "cpparsec_core.h"
+#include "cpparsec_simd.h"
 
 namespace cpparsec {
 
     // ======================== CORE CHARACTER PARSERS ========================
 
+    // Character parsers default to std::string_view input, any other InputStream
+    // with a string_view-like interface can be given explicitly, e.g. char_<PaddedInput>('x')
+    // InputStreams with readable padding (see cpparsec_padded.h) skip most end of input checks
+    // Wide InputStreams (std::u16string_view, std::u32string_view) parse code units of their value_type
+
     // Parses a single character
-    inline Parser<char> char_(char c);
+    template <typename Input = std::string_view>
+    Parser<input_atom_t<Input>, Input> char_(input_atom_t<Input> c);
 
     // Parses any character
-    inline Parser<char> any_char();
+    template <typename Input = std::string_view>
+    Parser<input_atom_t<Input>, Input> any_char();
 
     // Parses a single character that satisfies a constraint
     // Faster than try_(any_char().satisfy(cond))
-    inline Parser<char> char_satisfy(UnaryPredicate<char> auto cond, std::string&& err_msg = "<char_satisfy>");
+    template <typename Input = std::string_view>
+    Parser<input_atom_t<Input>, Input> char_satisfy(UnaryPredicate<input_atom_t<Input>> auto cond, std::string&& err_msg = "<char_satisfy>");
+
+    // Parses a single character in the class cond tests, as char_satisfy does
+    // cond must be pure: or_, optimize, bytecode and ParserGenerator tabulate it over every byte value
+    template <typename Input = std::string_view>
+    Parser<input_atom_t<Input>, Input> char_class(UnaryPredicate<input_atom_t<Input>> auto cond, std::string&& err_msg = "<char_class>");
+
+    namespace detail {
+        // char_satisfy, pure if cond may be called outside of a parse
+        template <typename Input>
+        Parser<input_atom_t<Input>, Input> satisfy_class(UnaryPredicate<input_atom_t<Input>> auto cond, std::string&& err_msg, bool pure);
+    };
 
     // Parses a single string
-    inline Parser<std::string> string_(const std::string& str);
+    template <typename Input = std::string_view>
+    Parser<std::basic_string<input_atom_t<Input>>, Input> string_(const std::basic_string<input_atom_t<Input>>& str);
+
+    // ========================== BULK SCAN PARSERS ===========================
+
+    // Parses up to and including terminator, returning a view of the input before it
+    // Same result as many_till(any_char(), try_(string_(terminator))) without per-char parsing
+    template <typename Input = std::string_view>
+    Parser<std::string_view, Input> take_until(const std::string& terminator);
+
+    // Skips up to and including terminator
+    template <typename Input = std::string_view>
+    Parser<std::monostate, Input> skip_until(const std::string& terminator);
+
+    // ======================= CASE INSENSITIVE PARSERS =======================
+
+    // Parses a string ignoring ASCII case, returning a view of the matched input
+    // string_ci("Content-Length") also matches "content-length" and "CONTENT-LENGTH"
+    template <typename Input = std::string_view>
+    Parser<std::string_view, Input> string_ci(const std::string& str);
+
+    // Parses the longest of a set of keywords, returning a view of the matched input
+    // Fails without consuming input if no keyword matches
+    template <typename Input = std::string_view>
+    Parser<std::string_view, Input> keywords(const std::vector<std::string>& words);
+
+    // Parses the longest of a set of keywords ignoring ASCII case, returning a view of the matched input
+    // keywords_ci({ "select", "set" }) matches "SELECT" and "Set"
+    template <typename Input = std::string_view>
+    Parser<std::string_view, Input> keywords_ci(const std::vector<std::string>& words);
+
+    // ======================== QUOTED STRING PARSERS =========================
+
+    // Escape syntaxes for quoted_string
+    enum class EscapeRules {
+        json, // \" \\ \/ \b \f \n \r \t and \uXXXX with surrogate pairs, raw control bytes are rejected
+        csv,  // RFC 4180, a doubled quote stands for one quote
+        c,    // simple escapes, octal \ooo, \xHH, \uXXXX and \UXXXXXXXX
+    };
+
+    // Parses a string between quotes and decodes its escapes, returning a view of the contents
+    // The view points into the input when there were no escapes, and into buffer otherwise
+    // Quotes, escapes and control bytes are found 16 bytes at a time, fails without consuming input
+    template <typename Input = std::string_view>
+    Parser<std::string_view, Input> quoted_string(char quote, EscapeRules rules, std::string& buffer);
+
+    // Parses a string between quotes and decodes its escapes, see quoted_string above
+    template <typename Input = std::string_view>
+    Parser<std::string, Input> quoted_string(char quote = '"', EscapeRules rules = EscapeRules::json);
 
     // ========================== CHARACTER PARSERS ===========================
 
+    namespace detail {
+        // Applies a <cctype> classifier to an atom, wide atoms outside ASCII never match
+        // chars are passed as unsigned char, a negative char is undefined behavior for <cctype>
+        template <typename Input>
+        auto ascii_class(int (*classify)(int)) {
+            using Atom = input_atom_t<Input>;
+            if constexpr (std::same_as<Atom, char>) {
+                return [classify](char c) { return classify(static_cast<unsigned char>(c)) != 0; };
+            }
+            else {
+                return [classify](Atom c) { return c < 0x80 && classify(static_cast<int>(c)); };
+            }
+        }
+    };
+
     // Parses a single letter
-    inline Parser<char> letter() {
-        return char_satisfy(isalpha, "<letter>");
+    template <typename Input = std::string_view>
+    Parser<input_atom_t<Input>, Input> letter() {
+        return detail::satisfy_class<Input>(detail::ascii_class<Input>(isalpha), "<letter>", true);
     }
 
     // Parses a single digit
-    inline Parser<char> digit() {
-        return char_satisfy(isdigit, "<digit>");
+    template <typename Input = std::string_view>
+    Parser<input_atom_t<Input>, Input> digit() {
+        return detail::satisfy_class<Input>(detail::ascii_class<Input>(isdigit), "<digit>", true);
     }
 
     // Parses a single space
-    inline Parser<char> space() {
-        return char_satisfy(isspace, "<space>");
+    template <typename Input = std::string_view>
+    Parser<input_atom_t<Input>, Input> space() {
+        return detail::satisfy_class<Input>(detail::ascii_class<Input>(isspace), "<space>", true);
     }
 
     // Skips zero or more spaces
-    inline Parser<std::monostate> spaces() {
-        return skip_many(space());
+    template <typename Input = std::string_view>
+    Parser<std::monostate, Input> spaces() {
+        return skip_many(space<Input>());
     }
 
     // Skips one or more spaces
-    inline Parser<std::monostate> spaces1() {
-        return skip_many1(space());
+    template <typename Input = std::string_view>
+    Parser<std::monostate, Input> spaces1() {
+        return skip_many1(space<Input>());
     }
 
     // Parses a single newline '\n'
-    inline Parser<char> newline() {
-        return char_('\n');
+    template <typename Input = std::string_view>
+    Parser<input_atom_t<Input>, Input> newline() {
+        return char_<Input>('\n');
     }
 
     // Parses a single uppercase letter 
-    inline Parser<char> upper() {
-        return char_satisfy(isupper, "<uppercase>");
+    template <typename Input = std::string_view>
+    Parser<input_atom_t<Input>, Input> upper() {
+        return detail::satisfy_class<Input>(detail::ascii_class<Input>(isupper), "<uppercase>", true);
     }
 
     // Parses a single lowercase letter 
-    inline Parser<char> lower() {
-        return char_satisfy(islower, "<lowercase>");
+    template <typename Input = std::string_view>
+    Parser<input_atom_t<Input>, Input> lower() {
+        return detail::satisfy_class<Input>(detail::ascii_class<Input>(islower), "<lowercase>", true);
     }
 
     // Parses a single alphanumeric letter 
-    inline Parser<char> alpha_num() {
-        return char_satisfy(isalnum, "<alphanum>");
+    template <typename Input = std::string_view>
+    Parser<input_atom_t<Input>, Input> alpha_num() {
+        return detail::satisfy_class<Input>(detail::ascii_class<Input>(isalnum), "<alphanum>", true);
     }
 
     // ======================== STRING SPECIALIZATIONS ========================
 
     // Parse zero or more characters, std::string specialization
-    template <PushBack<char> StringContainer>
-    Parser<StringContainer> many(Parser<char> charP);
+    template <PushBack<char> StringContainer, typename Input>
+    Parser<StringContainer, Input> many(Parser<char, Input> charP);
 
     // Parse one or more characters, std::string specialization
-    template <PushBack<char> StringContainer>
-    Parser<StringContainer> many1(Parser<char> charP);
+    template <PushBack<char> StringContainer, typename Input>
+    Parser<StringContainer, Input> many1(Parser<char, Input> charP);
 
     // Parses p zero or more times until end succeeds, returning the parsed values, std::string specialization
-    template <typename T, PushBack<char> StringContainer>
-    Parser<StringContainer> many_till(Parser<char> p, Parser<T> end);
+    template <typename T, PushBack<char> StringContainer, typename Input>
+    Parser<StringContainer, Input> many_till(Parser<char, Input> p, Parser<T, Input> end);
 
     // Parses p one or more times until end succeeds, returning the parsed values, std::string specialization
-    template <typename T, PushBack<char> StringContainer>
-    Parser<StringContainer> many1_till(Parser<char> p, Parser<T> end);
+    template <typename T, PushBack<char> StringContainer, typename Input>
+    Parser<StringContainer, Input> many1_till(Parser<char, Input> p, Parser<T, Input> end);
 
     // Parse zero or more parses of p separated by sep, std::string specialization
-    template <typename T>
-    Parser<std::string> sep_by(Parser<char> p, Parser<T> sep);
+    template <typename T, typename Input>
+    Parser<std::string, Input> sep_by(Parser<char, Input> p, Parser<T, Input> sep);
 
     // Parse one or more parses of p separated by sep, std::string specialization
-    template <typename T>
-    Parser<std::string> sep_by1(Parser<char> p, Parser<T> sep);
+    template <typename T, typename Input>
+    Parser<std::string, Input> sep_by1(Parser<char, Input> p, Parser<T, Input> sep);
 
     // Parse zero or more parses of p separated by and ending with sep, std::string specialization
-    template <typename T>
-    Parser<std::string> end_by(Parser<char> p, Parser<T> sep);
+    template <typename T, typename Input>
+    Parser<std::string, Input> end_by(Parser<char, Input> p, Parser<T, Input> sep);
 
     // Parse one or more parses of p separated by and ending with sep, std::string specialization
-    template <typename T>
-    Parser<std::string> end_by1(Parser<char> p, Parser<T> sep);
+    template <typename T, typename Input>
+    Parser<std::string, Input> end_by1(Parser<char, Input> p, Parser<T, Input> sep);
 
     // ========================================================================
     // 
@@ -110,10 +204,22 @@ namespace cpparsec {
     // ======================== Core Character Parsers ========================
 
     // Parses a single character
-    inline Parser<char> char_(char c) {
-        return CPPARSEC_MAKE(Parser<char>) {
-            CPPARSEC_FAIL_IF(input.empty(), ParseError("end of input", { c }));
-            CPPARSEC_FAIL_IF(input[0] != c, ParseError(input[0], c));
+    template <typename Input>
+    Parser<input_atom_t<Input>, Input> char_(input_atom_t<Input> c) {
+        using Atom = input_atom_t<Input>;
+
+        return CPPARSEC_MAKE_NODE((GrammarNode<Atom>{ .kind = GrammarKind::char_, .atoms = { c } }), Parser<Atom, Input>) {
+            if constexpr (input_padding<Input>() > 0) {
+                // padding reads as '\0', so only a mismatch or a '\0' needs the end of input check
+                if (input[0] != c || c == '\0') {
+                    CPPARSEC_FAIL_IF(input.empty(), ParseError<Atom>("end of input", detail::atom_to_string(c)));
+                    CPPARSEC_FAIL_IF(input[0] != c, ParseError<Atom>(input[0], c));
+                }
+            }
+            else {
+                CPPARSEC_FAIL_IF(input.empty(), ParseError<Atom>("end of input", detail::atom_to_string(c)));
+                CPPARSEC_FAIL_IF(input[0] != c, ParseError<Atom>(input[0], c));
+            }
 
             input.remove_prefix(1);
             return c;
@@ -121,11 +227,14 @@ namespace cpparsec {
     }
 
     // Parses any character
-    inline Parser<char> any_char() {
-        return CPPARSEC_MAKE(Parser<char>) {
-            CPPARSEC_FAIL_IF(input.empty(), ParseError("any_char: end of input"));
+    template <typename Input>
+    Parser<input_atom_t<Input>, Input> any_char() {
+        using Atom = input_atom_t<Input>;
+
+        return CPPARSEC_MAKE_NODE(GrammarNode<Atom>{ GrammarKind::any_char }, Parser<Atom, Input>) {
+            CPPARSEC_FAIL_IF(input.empty(), ParseError<Atom>("any_char: end of input"));
 
-            char c = input[0];
+            Atom c = input[0];
             input.remove_prefix(1);
             return c;
         };
@@ -133,29 +242,63 @@ namespace cpparsec {
 
     // Parses a single character that satisfies a constraint
     // Faster than try_(any_char().satisfy(cond))
-    inline Parser<char> char_satisfy(UnaryPredicate<char> auto cond, std::string&& err_msg) {
-        return CPPARSEC_MAKE(Parser<char>) {
-            CPPARSEC_FAIL_IF(input.empty(), ParseError(err_msg, "end of input"));
-            CPPARSEC_FAIL_IF(!cond(input[0]), ParseError(err_msg, { input[0] }));
+    template <typename Input>
+    Parser<input_atom_t<Input>, Input> char_satisfy(UnaryPredicate<input_atom_t<Input>> auto cond, std::string&& err_msg) {
+        return detail::satisfy_class<Input>(cond, std::move(err_msg), false);
+    }
+
+    // Parses a single character in the class cond tests, as char_satisfy does
+    template <typename Input>
+    Parser<input_atom_t<Input>, Input> char_class(UnaryPredicate<input_atom_t<Input>> auto cond, std::string&& err_msg) {
+        return detail::satisfy_class<Input>(cond, std::move(err_msg), true);
+    }
+
+    template <typename Input>
+    Parser<input_atom_t<Input>, Input> detail::satisfy_class(UnaryPredicate<input_atom_t<Input>> auto cond, std::string&& err_msg, bool pure) {
+        using Atom = input_atom_t<Input>;
+
+        return CPPARSEC_MAKE_NODE((GrammarNode<Atom>{ .kind = GrammarKind::char_class, .predicate = cond, .label = err_msg, .pure = pure }), Parser<Atom, Input>) {
+            if constexpr (input_padding<Input>() > 0) {
+                // padding reads as '\0', so only a '\0' needs the end of input check
+                CPPARSEC_FAIL_IF(input[0] == '\0' && input.empty(), ParseError<Atom>(err_msg, "end of input"));
+                CPPARSEC_FAIL_IF(!cond(input[0]), ParseError<Atom>(err_msg, detail::atom_to_string(input[0])));
+            }
+            else {
+                CPPARSEC_FAIL_IF(input.empty(), ParseError<Atom>(err_msg, "end of input"));
+                CPPARSEC_FAIL_IF(!cond(input[0]), ParseError<Atom>(err_msg, detail::atom_to_string(input[0])));
+            }
 
-            char c = input[0];
+            Atom c = input[0];
             input.remove_prefix(1);
             return c;
         };
     }
 
     // Parses a single string
-    inline Parser<std::string> string_(const std::string& str) {
-        return CPPARSEC_MAKE(Parser<std::string>) {
-            CPPARSEC_FAIL_IF(str.size() > input.size(), ParseError("end of input", { str[0] }));
+    template <typename Input>
+    Parser<std::basic_string<input_atom_t<Input>>, Input> string_(const std::basic_string<input_atom_t<Input>>& str) {
+        using Atom = input_atom_t<Input>;
+        using String = std::basic_string<Atom>;
+
+        // a padded match of a string without '\0' can never run past the end of input
+        const bool padded_compare = input_padding<Input>() > 0 && input_padding<Input>() >= str.size() * sizeof(Atom)
+            && str.find(Atom('\0')) == String::npos;
+
+        return CPPARSEC_MAKE_NODE((GrammarNode<Atom>{ .kind = GrammarKind::literal, .atoms = std::vector<Atom>(str.begin(), str.end()) }), Parser<String, Input>) {
+            if (padded_compare && std::memcmp(input.data(), str.data(), str.size() * sizeof(Atom)) == 0) {
+                input.remove_prefix(str.size());
+                return str;
+            }
+
+            CPPARSEC_FAIL_IF(str.size() > input.size(), ParseError<Atom>("end of input", detail::atom_to_string(str[0])));
 
             for (auto [i, c] : str | std::views::enumerate) {
                 if (c != input[i]) {
-                    char c2 = input[i];
-                    auto str2 = std::string(input.substr(0, i + 1));
+                    Atom c2 = input[i];
+                    auto str2 = detail::to_utf8(std::basic_string_view<Atom>(input.data(), i + 1));
                     input.remove_prefix(i);
 
-                    CPPARSEC_FAIL(ParseError(c, c2).add_error({ std::pair{ str, str2 } }));
+                    CPPARSEC_FAIL(ParseError<Atom>(c, c2).add_error({ std::pair{ detail::to_utf8(std::basic_string_view<Atom>(str)), str2 } }));
                 }
             }
 
@@ -164,18 +307,306 @@ namespace cpparsec {
         };
     }
 
+    // =========================== Bulk Scan Parsers ==========================
+
+    // Parses up to and including terminator, returning a view of the input before it
+    // Fails without consuming input if terminator is never found
+    template <typename Input>
+    Parser<std::string_view, Input> take_until(const std::string& terminator) {
+        detail::LiteralSearcher searcher(terminator);
+
+        return CPPARSEC_MAKE(Parser<std::string_view, Input>) {
+            std::string_view view(input.data(), input.size());
+            size_t pos = searcher.find(view);
+            CPPARSEC_FAIL_IF(pos == std::string_view::npos, ParseError(searcher.literal(), "end of input"));
+
+            input.remove_prefix(pos + searcher.literal().size());
+            return view.substr(0, pos);
+        };
+    }
+
+    // Skips up to and including terminator
+    template <typename Input>
+    Parser<std::monostate, Input> skip_until(const std::string& terminator) {
+        detail::LiteralSearcher searcher(terminator);
+
+        return CPPARSEC_MAKE(Parser<std::monostate, Input>) {
+            size_t pos = searcher.find(std::string_view(input.data(), input.size()));
+            CPPARSEC_FAIL_IF(pos == std::string_view::npos, ParseError(searcher.literal(), "end of input"));
+
+            input.remove_prefix(pos + searcher.literal().size());
+            return std::monostate{};
+        };
+    }
+
+    // ======================= Case Insensitive Parsers =======================
+
+    // Parses a string ignoring ASCII case, returning a view of the matched input
+    // Fails without consuming input
+    template <typename Input>
+    Parser<std::string_view, Input> string_ci(const std::string& str) {
+        detail::CaseFoldMatcher matcher(str);
+
+        return CPPARSEC_MAKE(Parser<std::string_view, Input>) {
+            std::string_view view(input.data(), input.size());
+            const size_t n = matcher.size();
+
+            // padded input can be loaded past its end, a match there still fails the size check
+            if (n <= view.size() + input_padding<Input>() && matcher.match(view.data()) && n <= view.size()) {
+                input.remove_prefix(n);
+                return view.substr(0, n);
+            }
+
+            CPPARSEC_FAIL_IF(n > view.size(), ParseError(matcher.literal(), "end of input"));
+            CPPARSEC_FAIL(ParseError(matcher.literal(), std::string(view.substr(0, n))));
+        };
+    }
+
+    namespace detail {
+        // Shared by keywords and keywords_ci, the set is built once and shared between parser copies
+        template <typename Input>
+        Parser<std::string_view, Input> keyword_set(const std::vector<std::string>& words, bool fold_case) {
+            auto set = std::make_shared<const KeywordSet>(words, fold_case);
+
+            return CPPARSEC_MAKE(Parser<std::string_view, Input>) {
+                std::string_view view(input.data(), input.size());
+                size_t n = set->match(view, view.size() + input_padding<Input>());
+                CPPARSEC_FAIL_IF(n == KeywordSet::npos,
+                    ParseError(set->description(), view.empty() ? "end of input" : std::string(1, view[0])));
+
+                input.remove_prefix(n);
+                return view.substr(0, n);
+            };
+        }
+    };
+
+    // Parses the longest of a set of keywords, returning a view of the matched input
+    template <typename Input>
+    Parser<std::string_view, Input> keywords(const std::vector<std::string>& words) {
+        return detail::keyword_set<Input>(words, false);
+    }
+
+    // Parses the longest of a set of keywords ignoring ASCII case, returning a view of the matched input
+    template <typename Input>
+    Parser<std::string_view, Input> keywords_ci(const std::vector<std::string>& words) {
+        return detail::keyword_set<Input>(words, true);
+    }
+
+    // ======================== Quoted String Parsers =========================
+
+    namespace detail {
+        // Value of count hex digits at offset at of view
+        inline std::optional<uint32_t> hex_digits_at(std::string_view view, size_t at, size_t count) {
+            if (at + count > view.size()) {
+                return std::nullopt;
+            }
+
+            uint32_t value = 0;
+            for (size_t i = at; i < at + count; i++) {
+                uint8_t digit = hex_digit_value(view[i]);
+                if (digit == 0xFF) {
+                    return std::nullopt;
+                }
+                value = (value << 4) | digit;
+            }
+            return value;
+        }
+
+        inline ParseError<> escape_error(std::string_view view, size_t at, size_t length) {
+            return ParseError("<escape sequence>", at + 1 >= view.size() ? "end of input" : std::string(view.substr(at, length)));
+        }
+
+        // Decodes the JSON escape at offset i of view into buffer, returning the offset past it
+        inline std::expected<size_t, ParseError<>> unescape_json(std::string_view view, size_t i, std::string& buffer) {
+            char simple = 0;
+            switch (i + 1 < view.size() ? view[i + 1] : '\0') {
+            case '"': simple = '"'; break;
+            case '\\': simple = '\\'; break;
+            case '/': simple = '/'; break;
+            case 'b': simple = '\b'; break;
+            case 'f': simple = '\f'; break;
+            case 'n': simple = '\n'; break;
+            case 'r': simple = '\r'; break;
+            case 't': simple = '\t'; break;
+            case 'u': break;
+            default: return std::unexpected(escape_error(view, i, 2));
+            }
+
+            if (simple != 0) {
+                buffer += simple;
+                return i + 2;
+            }
+
+            std::optional<uint32_t> unit = hex_digits_at(view, i + 2, 4);
+            if (!unit) {
+                return std::unexpected(escape_error(view, i, 6));
+            }
+            if (*unit < 0xD800 || *unit > 0xDFFF) {
+                append_utf8(buffer, *unit);
+                return i + 6;
+            }
+
+            // a high surrogate must be followed by an escaped low surrogate
+            std::optional<uint32_t> low = view.substr(i + 6, 2) == "\\u" ? hex_digits_at(view, i + 8, 4) : std::nullopt;
+            if (*unit > 0xDBFF || !low || *low < 0xDC00 || *low > 0xDFFF) {
+                return std::unexpected(ParseError("<escape sequence>", std::format("unpaired surrogate {}", view.substr(i, 6))));
+            }
+
+            append_utf8(buffer, 0x10000 + ((*unit - 0xD800) << 10) + (*low - 0xDC00));
+            return i + 12;
+        }
+
+        // Decodes the C escape at offset i of view into buffer, returning the offset past it
+        inline std::expected<size_t, ParseError<>> unescape_c(std::string_view view, size_t i, std::string& buffer) {
+            const char e = i + 1 < view.size() ? view[i + 1] : '\0';
+            constexpr std::string_view simple_escapes = "n\nt\tr\ra\ab\bf\fv\v\\\\''\"\"??";
+
+            for (size_t k = 0; k < simple_escapes.size(); k += 2) {
+                if (e == simple_escapes[k]) {
+                    buffer += simple_escapes[k + 1];
+                    return i + 2;
+                }
+            }
+
+            if (e >= '0' && e <= '7') {
+                size_t end = i + 1;
+                unsigned value = 0;
+                while (end < view.size() && end < i + 4 && view[end] >= '0' && view[end] <= '7') {
+                    value = value * 8 + (view[end] - '0');
+                    end++;
+                }
+                if (value > 0xFF) {
+                    return std::unexpected(escape_error(view, i, end - i));
+                }
+                buffer += static_cast<char>(value);
+                return end;
+            }
+            if (e == 'x') {
+                size_t end = i + 2;
+                unsigned value = 0;
+                while (end < view.size() && hex_digit_value(view[end]) != 0xFF && value <= 0xFF) {
+                    value = (value << 4) | hex_digit_value(view[end]);
+                    end++;
+                }
+                if (end == i + 2 || value > 0xFF) {
+                    return std::unexpected(escape_error(view, i, end == i + 2 ? 3 : end - i));
+                }
+                buffer += static_cast<char>(value);
+                return end;
+            }
+            if (e == 'u' || e == 'U') {
+                const size_t digits = e == 'u' ? 4 : 8;
+                std::optional<uint32_t> codepoint = hex_digits_at(view, i + 2, digits);
+                if (!codepoint || (*codepoint >= 0xD800 && *codepoint <= 0xDFFF) || *codepoint > 0x10FFFF) {
+                    return std::unexpected(escape_error(view, i, digits + 2));
+                }
+                append_utf8(buffer, *codepoint);
+                return i + 2 + digits;
+            }
+
+            return std::unexpected(escape_error(view, i, 2));
+        }
+
+        // Scans a quoted string at the start of view
+        // Returns the bytes consumed and the contents, a view of view when there were no escapes
+        // and of buffer otherwise
+        inline std::expected<std::pair<size_t, std::string_view>, ParseError<>> scan_quoted(
+            std::string_view view, char quote, EscapeRules rules, std::string& buffer
+        ) {
+            if (view.empty() || view[0] != quote) {
+                return std::unexpected(ParseError(std::string(1, quote), view.empty() ? "end of input" : std::string(1, view[0])));
+            }
+
+            const bool csv = rules == EscapeRules::csv;
+            const char escape = csv ? quote : '\\';
+            const bool stop_at_controls = rules == EscapeRules::json;
+
+            // the common case, no escapes before the closing quote
+            size_t run = plain_string_run(view.substr(1), quote, escape, stop_at_controls);
+            size_t i = 1 + run;
+            if (i < view.size() && view[i] == quote && !(csv && i + 1 < view.size() && view[i + 1] == quote)) {
+                return std::pair{ i + 1, view.substr(1, run) };
+            }
+
+            buffer.assign(view.substr(1, run));
+            while (true) {
+                if (i >= view.size()) {
+                    return std::unexpected(ParseError("closing quote", "end of input"));
+                }
+
+                const char c = view[i];
+                if (c == quote && csv && i + 1 < view.size() && view[i + 1] == quote) {
+                    buffer += quote;
+                    i += 2;
+                }
+                else if (c == quote) {
+                    return std::pair{ i + 1, std::string_view(buffer) };
+                }
+                else if (c == '\\') {
+                    std::expected<size_t, ParseError<>> end = rules == EscapeRules::json
+                        ? unescape_json(view, i, buffer)
+                        : unescape_c(view, i, buffer);
+                    if (!end) {
+                        return std::unexpected(end.error());
+                    }
+                    i = *end;
+                }
+                else {
+                    unsigned byte = static_cast<unsigned char>(c);
+                    return std::unexpected(ParseError("<string character>", std::format("control byte 0x{:02X} at byte offset {}", byte, i)));
+                }
+
+                run = plain_string_run(view.substr(i), quote, escape, stop_at_controls);
+                buffer.append(view.substr(i, run));
+                i += run;
+            }
+        }
+    }
+
+    template <typename Input>
+    Parser<std::string_view, Input> quoted_string(char quote, EscapeRules rules, std::string& buffer) {
+        std::string* unescaped = &buffer;
+
+        return CPPARSEC_MAKE(Parser<std::string_view, Input>) {
+            std::string_view view(input.data(), input.size());
+
+            auto scanned = detail::scan_quoted(view, quote, rules, *unescaped);
+            CPPARSEC_FAIL_IF(!scanned, scanned.error());
+
+            input.remove_prefix(scanned->first);
+            return scanned->second;
+        };
+    }
+
+    template <typename Input>
+    Parser<std::string, Input> quoted_string(char quote, EscapeRules rules) {
+        return CPPARSEC_MAKE(Parser<std::string, Input>) {
+            std::string_view view(input.data(), input.size());
+            std::string buffer;
+
+            auto scanned = detail::scan_quoted(view, quote, rules, buffer);
+            CPPARSEC_FAIL_IF(!scanned, scanned.error());
+
+            input.remove_prefix(scanned->first);
+            if (scanned->second.data() == buffer.data()) {
+                return buffer;
+            }
+            return std::string(scanned->second);
+        };
+    }
+
     // ======================== String Specializations ========================
 
     // Parse zero or more characters, std::string specialization
-    template <PushBack<char> StringContainer = std::string>
-    Parser<StringContainer> many(Parser<char> charP) {
-        return detail::many_accumulator(charP, StringContainer());
+    template <PushBack<char> StringContainer = std::string, typename Input>
+    Parser<StringContainer, Input> many(Parser<char, Input> charP) {
+        return detail::many_accumulator(charP, StringContainer(), [charP] { return detail::grammar_node(GrammarKind::many, charP); });
     }
 
     // Parse one or more characters, std::string specialization
-    template <PushBack<char> StringContainer = std::string>
-    Parser<StringContainer> many1(Parser<char> charP) {
-        return CPPARSEC_MAKE(Parser<StringContainer>) {
+    template <PushBack<char> StringContainer = std::string, typename Input>
+    Parser<StringContainer, Input> many1(Parser<char, Input> charP) {
+        return CPPARSEC_MAKE_NODE(detail::grammar_node(GrammarKind::many1, charP), Parser<StringContainer, Input>) {
             CPPARSEC_SAVE(first, charP);
             CPPARSEC_SAVE(values, detail::many_accumulator(charP, StringContainer({ first })));
 
@@ -184,15 +615,15 @@ namespace cpparsec {
     }
 
     // Parses p zero or more times until end succeeds, returning the parsed values, std::string specialization
-    template <typename T, PushBack<char> StringContainer = std::string>
-    Parser<StringContainer> many_till(Parser<char> p, Parser<T> end) {
-        return detail::many_till_accumulator(p, end, StringContainer());
+    template <typename T, PushBack<char> StringContainer = std::string, typename Input>
+    Parser<StringContainer, Input> many_till(Parser<char, Input> p, Parser<T, Input> end) {
+        return detail::many_till_accumulator(p, end, StringContainer(), [p, end] { return detail::grammar_node(GrammarKind::many_till, p, end); });
     }
 
     // Parses p one or more times until end succeeds, returning the parsed values, std::string specialization
-    template <typename T, PushBack<char> StringContainer = std::string>
-    Parser<StringContainer> many1_till(Parser<char> p, Parser<T> end) {
-        return CPPARSEC_MAKE(Parser<StringContainer>) {
+    template <typename T, PushBack<char> StringContainer = std::string, typename Input>
+    Parser<StringContainer, Input> many1_till(Parser<char, Input> p, Parser<T, Input> end) {
+        return CPPARSEC_MAKE_NODE(detail::grammar_node(GrammarKind::many1_till, p, end), Parser<StringContainer, Input>) {
             CPPARSEC_SAVE(first, p);
             CPPARSEC_SAVE(values, detail::many_till_accumulator(p, end, StringContainer({ first })));
 
@@ -201,32 +632,35 @@ namespace cpparsec {
     }
 
     // Parse zero or more parses of p separated by sep, std::string specialization
-    template <typename T>
-    Parser<std::string> sep_by(Parser<char> p, Parser<T> sep) {
-        return sep_by1(p, sep) | success("");
+    template <typename T, typename Input>
+    Parser<std::string, Input> sep_by(Parser<char, Input> p, Parser<T, Input> sep) {
+        auto values = sep_by1(p, sep) | success<Input>(std::string());
+        return values.described([p, sep] { return detail::grammar_node(GrammarKind::sep_by, p, sep); });
     }
 
     // Parse one or more parses of p separated by sep, std::string specialization
-    template <typename T>
-    Parser<std::string> sep_by1(Parser<char> p, Parser<T> sep) {
-        return CPPARSEC_MAKE(Parser<std::string>) {
+    template <typename T, typename Input>
+    Parser<std::string, Input> sep_by1(Parser<char, Input> p, Parser<T, Input> sep) {
+        Parser<char, Input> next = sep >> p;
+
+        return CPPARSEC_MAKE_NODE(detail::grammar_node(GrammarKind::sep_by1, p, sep), Parser<std::string, Input>) {
             CPPARSEC_SAVE(first, p);
-            CPPARSEC_SAVE(values, detail::many_accumulator(sep >> p, std::string(1, first)));
+            CPPARSEC_SAVE(values, detail::many_accumulator(next, std::string(1, first)));
 
             return values;
         };
     }
 
     // Parse zero or more parses of p separated by and ending with sep, std::string specialization
-    template <typename T>
-    Parser<std::string> end_by(Parser<char> p, Parser<T> sep) {
-        return many(p << sep);
+    template <typename T, typename Input>
+    Parser<std::string, Input> end_by(Parser<char, Input> p, Parser<T, Input> sep) {
+        return many(p << sep).described([p, sep] { return detail::grammar_node(GrammarKind::end_by, p, sep); });
     }
 
     // Parse one or more parses of p separated by and ending with sep, std::string specialization
-    template <typename T>
-    Parser<std::string> end_by1(Parser<char> p, Parser<T> sep) {
-        return many1(p << sep);
+    template <typename T, typename Input>
+    Parser<std::string, Input> end_by1(Parser<char, Input> p, Parser<T, Input> sep) {
+        return many1(p << sep).described([p, sep] { return detail::grammar_node(GrammarKind::end_by1, p, sep); });
     }
 };
 
@@ -0,0 +1,874 @@
+#ifndef CPPARSEC_CODEGEN_H
+#define CPPARSEC_CODEGEN_H
+
+#include <expected>
+#include <map>
+#include "cpparsec_optimize.h"
+
+namespace cpparsec {
+
+    // ============================= CODE GENERATION ==============================
+
+    // ParserGenerator writes a header of recursive-descent parsers generated from grammars built as usual,
+    // to compile into a program instead of running closures
+    //
+    //     ParserGenerator generator("csv");
+    //     generator.add("fields", sep_by1(many(char_class(not_comma)), char_(',')));
+    //     std::ofstream("csv_parser.h") << generator.header("CSV_PARSER_H");
+    //
+    //     ParseResult<std::vector<std::string>> fields = csv::fields(input);
+    //
+    // Each node of the grammar IR (see GrammarNode) is a function of direct loops, class tests and literal compares
+    // called by its parents. A generated parser returns the ParseResult of its grammar, consuming the same input,
+    // with the errors of the same primitives, labels don't add their messages
+    // Classes are tabulated from their predicates through AtomClass, so they are the library classes and
+    // char_class, whose predicates accept negative chars. char_satisfy predicates can't be generated
+    // Grammars of std::string_view, with results of characters, strings, arithmetic types, and std::vector and
+    // std::optional of them. Transforms, chains, lazy, rules, hand-written parsers and tuples can't be generated
+
+    class ParserGenerator {
+    public:
+        // Parsers are in namespace_name, the header includes cpparsec_core.h as include
+        explicit ParserGenerator(std::string namespace_name, std::string include = "cpparsec_core.h");
+
+        // Adds a parser name(input) parsing as p, or fails naming a node of p it can't generate
+        template <typename T>
+        std::expected<void, std::string> add(const std::string& name, const Parser<T>& p);
+
+        // The header of the parsers added, guarded by guard
+        std::string header(const std::string& guard) const;
+
+    private:
+        std::string namespace_name;
+        std::string include;
+        std::string definitions;  // functions of the nodes, in namespace detail
+        std::string parsers;
+    };
+
+    // ============================================================================
+    //
+    // ========================= TEMPLATE IMPLEMENTATIONS =========================
+    //
+    // ============================================================================
+
+    // ============================== C++ Spelling ================================
+
+    namespace detail {
+        // Names of the fundamental types a generated parser can build
+        template <typename T>
+        constexpr std::string_view arithmetic_name = "";
+
+        template <> constexpr std::string_view arithmetic_name<bool> = "bool";
+        template <> constexpr std::string_view arithmetic_name<char> = "char";
+        template <> constexpr std::string_view arithmetic_name<signed char> = "signed char";
+        template <> constexpr std::string_view arithmetic_name<unsigned char> = "unsigned char";
+        template <> constexpr std::string_view arithmetic_name<short> = "short";
+        template <> constexpr std::string_view arithmetic_name<unsigned short> = "unsigned short";
+        template <> constexpr std::string_view arithmetic_name<int> = "int";
+        template <> constexpr std::string_view arithmetic_name<unsigned> = "unsigned";
+        template <> constexpr std::string_view arithmetic_name<long> = "long";
+        template <> constexpr std::string_view arithmetic_name<unsigned long> = "unsigned long";
+        template <> constexpr std::string_view arithmetic_name<long long> = "long long";
+        template <> constexpr std::string_view arithmetic_name<unsigned long long> = "unsigned long long";
+        template <> constexpr std::string_view arithmetic_name<float> = "float";
+        template <> constexpr std::string_view arithmetic_name<double> = "double";
+        template <> constexpr std::string_view arithmetic_name<long double> = "long double";
+
+        // The C++ spelling of T, if a generated parser can build it
+        template <typename T>
+        struct CppType {
+            static std::optional<std::string> name() {
+                if constexpr (std::same_as<T, std::monostate>) {
+                    return "std::monostate";
+                }
+                else if constexpr (std::same_as<T, std::string>) {
+                    return "std::string";
+                }
+                else if constexpr (!arithmetic_name<T>.empty()) {
+                    return std::string(arithmetic_name<T>);
+                }
+                return std::nullopt;
+            }
+        };
+
+        template <typename T>
+        struct CppType<std::vector<T>> {
+            static std::optional<std::string> name() {
+                std::optional<std::string> element = CppType<T>::name();
+                return element ? std::optional("std::vector<" + *element + ">") : std::nullopt;
+            }
+        };
+
+        template <typename T>
+        struct CppType<std::optional<T>> {
+            static std::optional<std::string> name() {
+                std::optional<std::string> element = CppType<T>::name();
+                return element ? std::optional("std::optional<" + *element + ">") : std::nullopt;
+            }
+        };
+
+        // A character literal of c
+        inline std::string cpp_char(char c) {
+            switch (c) {
+            case '\'': return "'\\''";
+            case '\\': return "'\\\\'";
+            case '\n': return "'\\n'";
+            case '\r': return "'\\r'";
+            case '\t': return "'\\t'";
+            case '\0': return "'\\0'";
+            default:
+                if (c >= ' ' && c <= '~') {
+                    return std::string{ '\'', c, '\'' };
+                }
+                return std::format("'\\x{:02X}'", static_cast<unsigned char>(c));
+            }
+        }
+
+        // An unsigned byte value, as a character literal if it is printable
+        inline std::string cpp_byte(unsigned b) {
+            return b > ' ' && b <= '~' && b != '\'' && b != '\\' ? cpp_char(static_cast<char>(b)) : std::to_string(b);
+        }
+
+        // A string literal of s, octal escapes never run into the characters after them
+        inline std::string cpp_string(std::string_view s) {
+            std::string literal = "\"";
+            for (char c : s) {
+                if (c == '"' || c == '\\') {
+                    literal += { '\\', c };
+                }
+                else if (c >= ' ' && c <= '~') {
+                    literal += c;
+                }
+                else {
+                    literal += std::format("\\{:03o}", static_cast<unsigned char>(c));
+                }
+            }
+            return literal + "\"";
+        }
+
+        // An expression of value, if a generated parser can build it
+        template <typename T>
+        std::optional<std::string> cpp_value(const T& value) {
+            if constexpr (std::same_as<T, std::monostate>) {
+                return "std::monostate{}";
+            }
+            else if constexpr (std::same_as<T, std::string>) {
+                return value.find('\0') == std::string::npos ? cpp_string(value)
+                    : std::format("std::string({}, {})", cpp_string(value), value.size());
+            }
+            else if constexpr (std::same_as<T, char>) {
+                return cpp_char(value);
+            }
+            else if constexpr (std::same_as<T, bool>) {
+                return value ? "true" : "false";
+            }
+            else if constexpr (std::is_floating_point_v<T>) {
+                if (!std::isfinite(value)) {
+                    return std::nullopt;
+                }
+                std::string literal = std::format("{}", value);
+                return literal.find_first_of(".e") == std::string::npos ? literal + ".0" : literal;
+            }
+            else if constexpr (std::is_arithmetic_v<T>) {
+                return std::format("{}{}", value, std::is_unsigned_v<T> ? "ull" : "ll");
+            }
+            else if constexpr (is_std_vector<T>) {
+                std::string literal = "{";
+                for (const auto& element : value) {
+                    std::optional<std::string> e = cpp_value(element);
+                    if (!e) {
+                        return std::nullopt;
+                    }
+                    literal += (literal.size() > 1 ? ", " : " ") + *e;
+                }
+                return literal + (literal.size() > 1 ? " }" : "}");
+            }
+            else if constexpr (is_std_optional<T>) {
+                return value ? cpp_value(*value) : std::optional<std::string>("std::nullopt");
+            }
+            return std::nullopt;
+        }
+
+        // Functions used by generated parsers, written once into each header
+        inline constexpr std::string_view generated_support = R"(        // Same errors as char_
+        inline cpparsec::ParseError<char> atom_error(std::string_view input, char expected) {
+            if (input.empty()) {
+                return cpparsec::ParseError<char>("end of input", std::string(1, expected));
+            }
+            return cpparsec::ParseError<char>(input[0], expected);
+        }
+
+        // Same errors as char_satisfy and the character classes
+        inline cpparsec::ParseError<char> class_error(std::string_view input, const std::string& label) {
+            return cpparsec::ParseError<char>(label, input.empty() ? "end of input" : std::string(1, input[0]));
+        }
+
+        // Same matching and errors as string_, consuming the matched prefix of a mismatch
+        inline bool match_literal(std::string_view& input, std::string_view literal, cpparsec::ParseError<char>& error) {
+            if (literal.size() > input.size()) {
+                error = cpparsec::ParseError<char>("end of input", std::string(1, literal[0]));
+                return false;
+            }
+
+            for (size_t i = 0; i < literal.size(); i++) {
+                if (literal[i] != input[i]) {
+                    error = cpparsec::ParseError<char>(literal[i], input[i]);
+                    error.add_error({ std::pair{ std::string(literal), std::string(input.substr(0, i + 1)) } });
+                    input.remove_prefix(i);
+                    return false;
+                }
+            }
+
+            input.remove_prefix(literal.size());
+            return true;
+        }
+)";
+    };
+
+    // =============================== Emitter ====================================
+
+    namespace detail {
+        // Writes the functions of the nodes of a grammar, named from prefix
+        class CodeEmitter {
+        public:
+            std::string definitions;
+            std::string failure;  // why a node couldn't be generated
+
+            explicit CodeEmitter(std::string prefix) : prefix(std::move(prefix)) { }
+
+            // The function parsing node, capturing its result into its last argument, written on first use
+            template <typename T>
+            std::optional<std::string> function(const NodePtr<char>& node, bool capturing);
+
+        private:
+            std::string prefix;
+            std::map<std::pair<const GrammarNode<char>*, bool>, std::string> functions;
+            std::map<const GrammarNode<char>*, std::string> classes;
+
+            bool fail(const GrammarNode<char>& node) {
+                failure = std::format("can't generate {}", node);
+                return false;
+            }
+
+            static void line(std::string& code, int indent, std::string_view text) {
+                code.append(indent, ' ').append(text) += '\n';
+            }
+
+            // Appends statements parsing node to code, into target unless it is empty, running on_fail on failure
+            template <typename T>
+            bool step(const NodePtr<char>& node, const std::string& target, std::string_view on_fail, std::string& code, int indent);
+
+            // Appends the body of the function of node
+            template <typename T>
+            bool body(const NodePtr<char>& node, bool capturing, std::string& code);
+
+            // many, count, sep_by, end_by and their variants
+            template <typename T>
+            bool repeat_body(const GrammarNode<char>& node, bool capturing, std::string& code);
+
+            // An expression testing c is in the class of node
+            std::string class_test(const NodePtr<char>& node, const std::string& c);
+            std::string class_error(const NodePtr<char>& node);
+
+            // The negation of a class test
+            static std::string negated(const std::string& test) {
+                const size_t equals = test.find(" == ");
+                return equals == std::string::npos ? "!" + test : test.substr(0, equals) + " != " + test.substr(equals + 4);
+            }
+        };
+
+        // An atom class that can be tabulated, char_satisfy predicates can only be called by a parse
+        inline bool generable_class(const GrammarNode<char>& node) {
+            if (node.kind == GrammarKind::char_class) {
+                return node.pure;
+            }
+            return is_atom_class(node)
+                && std::ranges::all_of(node.children, [](const NodePtr<char>& child) { return generable_class(*child); });
+        }
+
+        // Appends the char_, char_class and any_char leaves of an atom class
+        inline void class_leaves(const NodePtr<char>& node, std::vector<NodePtr<char>>& leaves) {
+            if (node->kind == GrammarKind::try_ || node->kind == GrammarKind::choice) {
+                for (const NodePtr<char>& child : node->children) {
+                    class_leaves(child, leaves);
+                }
+            }
+            else {
+                leaves.push_back(node);
+            }
+        }
+
+        inline std::string CodeEmitter::class_test(const NodePtr<char>& node, const std::string& c) {
+            std::vector<NodePtr<char>> leaves;
+            class_leaves(node, leaves);
+            if (leaves.size() == 1 && leaves[0]->kind == GrammarKind::char_) {
+                return c + " == " + cpp_char(leaves[0]->atoms[0]);
+            }
+            if (leaves.size() == 1 && leaves[0]->kind == GrammarKind::any_char) {
+                return "true";
+            }
+            if (auto found = classes.find(node.get()); found != classes.end()) {
+                return found->second + "(" + c + ")";
+            }
+
+            // runs of members, or of non-members when there are fewer
+            AtomClass<char> atoms({ node });
+            std::bitset<256> members;
+            for (unsigned b = 0; b < 256; b++) {
+                members[b] = atoms.contains(static_cast<char>(b));
+            }
+            auto runs = [](const std::bitset<256>& set) {
+                std::vector<std::pair<unsigned, unsigned>> runs;
+                for (unsigned b = 0; b < 256; b++) {
+                    if (set[b] && (b == 0 || !set[b - 1])) {
+                        runs.emplace_back(b, b);
+                    }
+                    if (set[b]) {
+                        runs.back().second = b;
+                    }
+                }
+                return runs;
+            };
+            std::vector<std::pair<unsigned, unsigned>> in = runs(members), out = runs(~members);
+            const bool negated = out.size() < in.size();
+            const std::vector<std::pair<unsigned, unsigned>>& tested = negated ? out : in;
+
+            auto range = [&](std::pair<unsigned, unsigned> run, bool single) {
+                auto [lo, hi] = run;
+                if (lo == hi) {
+                    return std::format("u {} {}", negated && single ? "!=" : "==", cpp_byte(lo));
+                }
+                if (lo == 0 || hi == 255) {
+                    const bool below = lo == 0;
+                    return std::format("u {} {}", below != (negated && single) ? "<=" : ">=", cpp_byte(below ? hi : lo));
+                }
+                return negated && single ? std::format("(u < {} || u > {})", cpp_byte(lo), cpp_byte(hi))
+                    : std::format("(u >= {} && u <= {})", cpp_byte(lo), cpp_byte(hi));
+            };
+
+            std::string name = std::format("{}_class_{}", prefix, classes.size());
+            std::string code;
+            line(code, 8, std::format("// {}", *node));
+            line(code, 8, std::format("inline bool {}(char c) {{", name));
+            line(code, 12, "const unsigned char u = static_cast<unsigned char>(c);");
+            if (tested.empty()) {
+                line(code, 12, negated ? "return true;" : "return false;");
+            }
+            else if (tested.size() == 1) {
+                line(code, 12, std::format("return {};", range(tested[0], true)));
+            }
+            else if (tested.size() <= 3) {
+                std::string test;
+                for (const auto& run : tested) {
+                    test += (test.empty() ? "" : " || ") + range(run, false);
+                }
+                line(code, 12, std::format("return {};", negated ? "!(" + test + ")" : test));
+            }
+            else {
+                uint64_t words[4] = {};
+                for (unsigned b = 0; b < 256; b++) {
+                    words[b >> 6] |= uint64_t(members[b]) << (b & 63);
+                }
+                line(code, 12, std::format("static constexpr uint64_t members[4] = {{ 0x{:016X}ull, 0x{:016X}ull, 0x{:016X}ull, 0x{:016X}ull }};",
+                    words[0], words[1], words[2], words[3]));
+                line(code, 12, "return (members[u >> 6] >> (u & 63)) & 1;");
+            }
+            line(code, 8, "}");
+            definitions += code + "\n";
+
+            classes[node.get()] = name;
+            return name + "(" + c + ")";
+        }
+
+        // Same errors as AtomClass, of the last alternative
+        inline std::string CodeEmitter::class_error(const NodePtr<char>& node) {
+            std::vector<NodePtr<char>> leaves;
+            class_leaves(node, leaves);
+            const GrammarNode<char>& last = *leaves.back();
+
+            switch (last.kind) {
+            case GrammarKind::char_:
+                return std::format("atom_error(input, {})", cpp_char(last.atoms[0]));
+            case GrammarKind::char_class:
+                return std::format("class_error(input, {})", cpp_string(last.label));
+            default:
+                return "cpparsec::ParseError<char>(std::string(\"any_char: end of input\"))";
+            }
+        }
+
+        template <typename T>
+        std::optional<std::string> CodeEmitter::function(const NodePtr<char>& node, bool capturing) {
+            const auto key = std::pair(node.get(), capturing);
+            if (auto found = functions.find(key); found != functions.end()) {
+                return found->second;
+            }
+
+            std::string parameters = "std::string_view& input, cpparsec::ParseError<char>& error";
+            if (capturing) {
+                std::optional<std::string> type = CppType<T>::name();
+                if (!type) {
+                    fail(*node);
+                    return std::nullopt;
+                }
+                parameters += ", " + *type + "& value";
+            }
+
+            // children are written before their parents
+            std::string code;
+            if (!body<T>(node, capturing, code)) {
+                return std::nullopt;
+            }
+
+            std::string name = std::format("{}_{}", prefix, functions.size());
+            std::string comment = std::format("{}", *node);
+            if (comment.size() > 100) {
+                comment = comment.substr(0, 97) + "...";
+            }
+            line(definitions, 8, "// " + comment);
+            line(definitions, 8, std::format("inline bool {}({}) {{", name, parameters));
+            definitions += code;
+            line(definitions, 8, "}");
+            definitions += "\n";
+
+            functions[key] = name;
+            return name;
+        }
+
+        template <typename T>
+        bool CodeEmitter::step(const NodePtr<char>& node, const std::string& target, std::string_view on_fail, std::string& code, int indent) {
+            const GrammarNode<char>& n = *node;
+            const bool capturing = !target.empty();
+            auto failing = [&] {
+                for (auto part : std::views::split(on_fail, '\n')) {
+                    line(code, indent + 4, std::string_view(part.begin(), part.end()));
+                }
+                line(code, indent, "}");
+            };
+
+            if (n.kind == GrammarKind::label) {
+                return step<T>(n.children[0], target, on_fail, code, indent);
+            }
+            if (generable_class(n)) {
+                if (capturing && !std::same_as<T, char>) {
+                    return fail(n);
+                }
+
+                std::string test = class_test(node, "input[0]");
+                line(code, indent, test == "true" ? "if (input.empty()) {" : std::format("if (input.empty() || {}) {{", negated(test)));
+                line(code, indent + 4, std::format("error = {};", class_error(node)));
+                failing();
+                if (capturing) {
+                    line(code, indent, target + " = input[0];");
+                }
+                line(code, indent, "input.remove_prefix(1);");
+                return true;
+            }
+
+            switch (n.kind) {
+            case GrammarKind::literal: {
+                if (capturing && !std::same_as<T, std::string>) {
+                    return fail(n);
+                }
+
+                std::string literal = cpp_string(std::string_view(n.atoms.data(), n.atoms.size()));
+                line(code, indent, std::format("if (!match_literal(input, {}, error)) {{", literal));
+                failing();
+                if (capturing) {
+                    line(code, indent, std::format("{} = {};", target, literal));
+                }
+                return true;
+            }
+            case GrammarKind::success:
+                if (capturing) {
+                    std::optional<Parser<T>> p = Parser<T>::recorded(n);
+                    std::string_view empty;
+                    std::optional<std::string> value;
+                    if (p) {
+                        if (typename Parser<T>::Result result = p->parse(empty)) {
+                            value = cpp_value(*result);
+                        }
+                    }
+                    if (!value) {
+                        return fail(n);
+                    }
+                    line(code, indent, std::format("{} = {};", target, *value));
+                }
+                return true;
+            case GrammarKind::eof:
+                line(code, indent, "if (!input.empty()) {");
+                line(code, indent + 4, "error = cpparsec::ParseError<char>(std::string(1, input[0]), \"end of input\");");
+                failing();
+                if (capturing) {
+                    line(code, indent, target + " = {};");
+                }
+                return true;
+            case GrammarKind::unexpected:
+                line(code, indent, "{");
+                line(code, indent + 4, "error = cpparsec::ParseError<char>(std::string(\"unexpected\"));");
+                failing();
+                return true;
+            default: {
+                std::optional<std::string> function = this->function<T>(node, capturing);
+                if (!function) {
+                    return false;
+                }
+                line(code, indent, std::format("if (!{}(input, error{})) {{", *function, capturing ? ", " + target : ""));
+                failing();
+                return true;
+            }
+            }
+        }
+
+        template <typename T>
+        bool CodeEmitter::body(const NodePtr<char>& node, bool capturing, std::string& code) {
+            const GrammarNode<char>& n = *node;
+            const std::string value = capturing ? "value" : "";
+
+            if (generable_class(n) || n.kind == GrammarKind::label || n.kind == GrammarKind::literal || n.kind == GrammarKind::success
+                || n.kind == GrammarKind::eof || n.kind == GrammarKind::unexpected) {
+                if (!step<T>(node, value, "return false;", code, 12)) {
+                    return false;
+                }
+                line(code, 12, "return true;");
+                return true;
+            }
+
+            switch (n.kind) {
+            case GrammarKind::sequence: {
+                std::vector<NodePtr<char>> before, after;
+                NodePtr<char> kept;
+                if (capturing) {
+                    if (n.keep < 0) {
+                        return fail(n);
+                    }
+                    kept = kept_step(n, before, after);
+                }
+                else {
+                    flatten_sequence(node, before);
+                }
+
+                for (const NodePtr<char>& step : before) {
+                    if (!this->step<std::monostate>(step, "", "return false;", code, 12)) {
+                        return false;
+                    }
+                }
+                if (kept && !step<T>(kept, value, "return false;", code, 12)) {
+                    return false;
+                }
+                for (const NodePtr<char>& step : after) {
+                    if (!this->step<std::monostate>(step, "", "return false;", code, 12)) {
+                        return false;
+                    }
+                }
+                line(code, 12, "return true;");
+                return true;
+            }
+            case GrammarKind::choice: {
+                // an alternative is only tried when the one before failed without consuming input
+                std::vector<NodePtr<char>> alternatives;
+                flatten_choice(node, alternatives);
+                // an alternative failing without consuming may still have built part of a value
+                bool reset = false;
+                bool started = false;
+                for (size_t i = 0; i + 1 < alternatives.size(); i++) {
+                    const NodePtr<char>& alternative = alternatives[i];
+                    if (std::exchange(reset, false)) {
+                        line(code, 12, "value = {};");
+                    }
+
+                    if (generable_class(*alternative)) {
+                        if (capturing && !std::same_as<T, char>) {
+                            return fail(*alternative);
+                        }
+                        std::string test = class_test(alternative, "input[0]");
+                        line(code, 12, test == "true" ? "if (!input.empty()) {" : std::format("if (!input.empty() && {}) {{", test));
+                        if (capturing) {
+                            line(code, 16, "value = input[0];");
+                        }
+                        line(code, 16, "input.remove_prefix(1);");
+                        line(code, 16, "return true;");
+                        line(code, 12, "}");
+                        continue;
+                    }
+
+                    std::optional<std::string> function = this->function<T>(alternative, capturing);
+                    if (!function) {
+                        return false;
+                    }
+                    if (!std::exchange(started, true)) {
+                        line(code, 12, "const char* start = input.data();");
+                    }
+                    line(code, 12, std::format("if ({}(input, error{})) {{", *function, capturing ? ", value" : ""));
+                    line(code, 16, "return true;");
+                    line(code, 12, "}");
+                    line(code, 12, "if (input.data() != start) {");
+                    line(code, 16, "return false;");
+                    line(code, 12, "}");
+                    reset = capturing;
+                }
+
+                if (reset) {
+                    line(code, 12, "value = {};");
+                }
+                if (!step<T>(alternatives.back(), value, "return false;", code, 12)) {
+                    return false;
+                }
+                line(code, 12, "return true;");
+                return true;
+            }
+            case GrammarKind::try_:
+                line(code, 12, "const std::string_view start = input;");
+                if (!step<T>(n.children[0], value, "input = start;\nreturn false;", code, 12)) {
+                    return false;
+                }
+                line(code, 12, "return true;");
+                return true;
+            case GrammarKind::look_ahead:
+                line(code, 12, "const std::string_view start = input;");
+                if (!step<T>(n.children[0], value, "return false;", code, 12)) {
+                    return false;
+                }
+                line(code, 12, "input = start;");
+                line(code, 12, "return true;");
+                return true;
+            case GrammarKind::not_followed_by: {
+                std::optional<std::string> function = this->function<std::monostate>(n.children[0], false);
+                if (!function) {
+                    return false;
+                }
+                line(code, 12, "const std::string_view start = input;");
+                line(code, 12, std::format("const bool matched = {}(input, error);", *function));
+                line(code, 12, "input = start;");
+                line(code, 12, "if (matched) {");
+                line(code, 16, "error = cpparsec::ParseError<char>(\"not_followed_by\", \"not_followed_by\");");
+                line(code, 16, "return false;");
+                line(code, 12, "}");
+                line(code, 12, "return true;");
+                return true;
+            }
+            case GrammarKind::optional:
+                line(code, 12, "const char* start = input.data();");
+                if (!capturing) {
+                    if (!step<std::monostate>(n.children[0], "", "return input.data() == start;", code, 12)) {
+                        return false;
+                    }
+                }
+                else if constexpr (is_std_optional<T>) {
+                    using U = typename T::value_type;
+                    line(code, 12, std::format("{} element{{}};", *CppType<U>::name()));
+                    if (!step<U>(n.children[0], "element", "value.reset();\nreturn input.data() == start;", code, 12)) {
+                        return false;
+                    }
+                    line(code, 12, "value = std::move(element);");
+                }
+                else {
+                    return fail(n);
+                }
+                line(code, 12, "return true;");
+                return true;
+            case GrammarKind::many:
+            case GrammarKind::many1:
+            case GrammarKind::skip_many:
+            case GrammarKind::skip_many1:
+            case GrammarKind::count:
+            case GrammarKind::sep_by:
+            case GrammarKind::sep_by1:
+            case GrammarKind::end_by:
+            case GrammarKind::end_by1:
+                return repeat_body<T>(n, capturing, code);
+            case GrammarKind::char_class:
+                failure = std::format("can't generate {}, char_satisfy predicates are only called by parses, use char_class", n);
+                return false;
+            default:
+                return fail(n);
+            }
+        }
+
+        template <typename T>
+        bool CodeEmitter::repeat_body(const GrammarNode<char>& n, bool capturing, std::string& code) {
+            using E = decltype([] {
+                if constexpr (is_std_vector<T> || std::same_as<T, std::string>) {
+                    return typename T::value_type{};
+                }
+                else {
+                    return std::monostate{};
+                }
+            }());
+            if (capturing && !(is_std_vector<T> || std::same_as<T, std::string>)) {
+                return fail(n);
+            }
+
+            const NodePtr<char>& p = n.children[0];
+            const bool at_least_one = n.kind == GrammarKind::many1 || n.kind == GrammarKind::skip_many1;
+
+            // a run of a class is scanned in one loop
+            if ((n.kind == GrammarKind::many || n.kind == GrammarKind::skip_many || at_least_one) && generable_class(*p)
+                && (!capturing || std::same_as<E, char>)) {
+                std::string test = class_test(p, "input[n]");
+                if (test == "true") {
+                    line(code, 12, "size_t n = input.size();");
+                }
+                else {
+                    line(code, 12, "size_t n = 0;");
+                    line(code, 12, std::format("while (n < input.size() && {}) {{", test));
+                    line(code, 16, "n++;");
+                    line(code, 12, "}");
+                }
+                if (at_least_one) {
+                    line(code, 12, "if (n == 0) {");
+                    line(code, 16, std::format("error = {};", class_error(p)));
+                    line(code, 16, "return false;");
+                    line(code, 12, "}");
+                }
+                if (capturing) {
+                    line(code, 12, "value.assign(input.data(), input.data() + n);");
+                }
+                line(code, 12, "input.remove_prefix(n);");
+                line(code, 12, "return true;");
+                return true;
+            }
+
+            // elements in order, each step running on_fail when it fails
+            const std::string element_type = capturing ? *CppType<E>::name() : "";
+            auto element = [&](std::string_view on_fail, int indent, bool separated, bool terminated) {
+                if (separated && !step<std::monostate>(n.children[1], "", on_fail, code, indent)) {
+                    return false;
+                }
+                if (capturing) {
+                    line(code, indent, element_type + " element{};");
+                }
+                if (!step<E>(p, capturing ? "element" : "", on_fail, code, indent)) {
+                    return false;
+                }
+                if (terminated && !step<std::monostate>(n.children[1], "", on_fail, code, indent)) {
+                    return false;
+                }
+                if (capturing) {
+                    line(code, indent, "value.push_back(std::move(element));");
+                }
+                return true;
+            };
+            auto loop = [&](bool separated, bool terminated) {
+                line(code, 12, "while (true) {");
+                line(code, 16, "const char* start = input.data();");
+                if (!element("return input.data() == start;", 16, separated, terminated)) {
+                    return false;
+                }
+                line(code, 12, "}");
+                return true;
+            };
+
+            switch (n.kind) {
+            case GrammarKind::count:
+                line(code, 12, std::format("for (size_t i = 0; i < {}; i++) {{", n.count));
+                if (!element("return false;", 16, false, false)) {
+                    return false;
+                }
+                line(code, 12, "}");
+                line(code, 12, "return true;");
+                return true;
+            case GrammarKind::sep_by:
+                line(code, 12, "const char* first = input.data();");
+                line(code, 12, "{");
+                if (!element("return input.data() == first;", 16, false, false)) {
+                    return false;
+                }
+                line(code, 12, "}");
+                return loop(true, false);
+            case GrammarKind::sep_by1:
+                line(code, 12, "{");
+                if (!element("return false;", 16, false, false)) {
+                    return false;
+                }
+                line(code, 12, "}");
+                return loop(true, false);
+            case GrammarKind::end_by:
+            case GrammarKind::end_by1:
+                if (n.kind == GrammarKind::end_by1) {
+                    line(code, 12, "{");
+                    if (!element("return false;", 16, false, true)) {
+                        return false;
+                    }
+                    line(code, 12, "}");
+                }
+                return loop(false, true);
+            default:
+                if (at_least_one) {
+                    line(code, 12, "{");
+                    if (!element("return false;", 16, false, false)) {
+                        return false;
+                    }
+                    line(code, 12, "}");
+                }
+                return loop(false, false);
+            }
+        }
+    };
+
+    // ============================ Parser Generator ==============================
+
+    inline ParserGenerator::ParserGenerator(std::string namespace_name, std::string include) :
+        namespace_name(std::move(namespace_name)),
+        include(std::move(include))
+    { }
+
+    template <typename T>
+    std::expected<void, std::string> ParserGenerator::add(const std::string& name, const Parser<T>& p) {
+        constexpr bool capturing = !std::same_as<T, std::monostate>;
+        std::optional<std::string> type = detail::CppType<T>::name();
+        if (!type) {
+            return std::unexpected(std::format("can't generate {}, its result type has no C++ spelling", name));
+        }
+
+        detail::CodeEmitter emitter(name);
+        std::optional<std::string> function = emitter.function<T>(p.grammar(), capturing);
+        if (!function) {
+            return std::unexpected(emitter.failure);
+        }
+
+        definitions += emitter.definitions;
+        parsers += std::format(R"(    inline cpparsec::ParseResult<{0}> {1}(std::string_view& input) {{
+        {0} value{{}};
+        cpparsec::ParseError<char> error{{ std::string() }};
+        if (!detail::{2}(input, error{3})) {{
+            return std::unexpected(std::move(error));
+        }}
+        return value;
+    }}
+
+    inline cpparsec::ParseResult<{0}> {1}(std::string_view&& input) {{
+        return {1}(input);
+    }}
+
+)", *type, name, *function, capturing ? ", value" : "");
+        return {};
+    }
+
+    inline std::string ParserGenerator::header(const std::string& guard) const {
+        std::string code = std::format(R"(// Generated by cpparsec::ParserGenerator, do not edit by hand
+
+#ifndef {0}
+#define {0}
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+#include "{1}"
+
+namespace {2} {{
+
+    namespace detail {{
+)", guard, include, namespace_name);
+
+        code += detail::generated_support;
+        code += "\n" + definitions;
+        code += "    };\n\n" + parsers;
+        code += std::format("}};\n\n#endif /* {} */\n", guard);
+        return code;
+    }
+};
+
+#endif /* CPPARSEC_CODEGEN_H */
@@ -10,6 +10,12 @@
 #include <string_view>
 #include <algorithm>
 #include <functional>
+#include <memory>
+#include <optional>
+#include <mutex>
+#include <atomic>
+#include <array>
+#include <bitset>
 #include <utility>
 #include <ranges>
 #include <concepts>
@@ -39,10 +45,19 @@ using std::println;
 #define CPPARSEC_FAIL(message) return std::unexpected(message);
 
 #define CPPARSEC_MAKE(...) \
-    cpparsec::_ParserFactory<__VA_ARGS__> () = [=](__VA_ARGS__::InputStream& input) -> cpparsec::ParseResult<typename __VA_ARGS__::Item>
+    cpparsec::_ParserFactory<__VA_ARGS__> () = [=](__VA_ARGS__::InputStream& input) -> typename __VA_ARGS__::Result
 
 #define CPPARSEC_MAKE_METHOD(name, ...) \
-    cpparsec::_ParserFactory<__VA_ARGS__> () = [=, name = *this](__VA_ARGS__::InputStream& input) -> cpparsec::ParseResult<typename __VA_ARGS__::Item>
+    cpparsec::_ParserFactory<__VA_ARGS__> () = [=, name = *this](__VA_ARGS__::InputStream& input) -> typename __VA_ARGS__::Result
+
+// CPPARSEC_MAKE for a parser described by a grammar IR node, see GrammarNode
+// node is evaluated the first time the grammar is read, not when the parser is made
+#define CPPARSEC_MAKE_NODE(node, ...) \
+    cpparsec::_ParserFactory<__VA_ARGS__>::described([=] { return node; }) = [=](__VA_ARGS__::InputStream& input) -> typename __VA_ARGS__::Result
+
+// CPPARSEC_MAKE_METHOD for a parser described by a grammar IR node, see GrammarNode
+#define CPPARSEC_MAKE_METHOD_NODE(name, node, ...) \
+    cpparsec::_ParserFactory<__VA_ARGS__>::described([=, name = *this] { return node; }) = [=, name = *this](__VA_ARGS__::InputStream& input) -> typename __VA_ARGS__::Result
 
 
 namespace cpparsec {
@@ -55,23 +70,38 @@ namespace cpparsec {
 
     // ============================= PARSE ERROR ==============================
 
-    template <std::formattable<char> Atom = char>
+    // Concept for an atom a ParseError can report, char-formattable or a character type
+    // Wide character atoms (char16_t, char32_t, wchar_t) are formatted as UTF-8
+    template <typename Atom>
+    concept ErrorAtom = std::formattable<Atom, char>
+        || std::same_as<Atom, char8_t> || std::same_as<Atom, char16_t>
+        || std::same_as<Atom, char32_t> || std::same_as<Atom, wchar_t>;
+
+    template <ErrorAtom Atom>
+    struct ParseErrorContent
+        : std::variant<
+                std::pair<std::string, std::string>, 
+                std::pair<Atom, Atom>, 
+                std::string, 
+                std::monostate
+            >
+    { };
+
+    template <ErrorAtom Atom = char>
     class ParseError {
     public:
-        struct ErrorContent
-            : std::variant<
-                    std::pair<std::string, std::string>, 
-                    std::pair<Atom, Atom>, 
-                    std::string, 
-                    std::monostate
-                >
-        { };
+        using ErrorContent = ParseErrorContent<Atom>;
 
         ParseError(ErrorContent&& err) : errors({ err }) { }
         ParseError(const std::string expected, const std::string found) : errors({ ErrorContent{std::pair {expected, found}} }) { }
-        ParseError(std::formattable<char> auto expected, std::formattable<char> auto found) : errors({ ErrorContent{std::pair {expected, found}} }) { }
+        ParseError(ErrorAtom auto expected, ErrorAtom auto found) : errors({ ErrorContent{std::pair {expected, found}} }) { }
         ParseError(std::string&& msg) : errors({ ErrorContent{msg} }) { }
 
+        // Widens errors built with another atom type, e.g. core combinator errors in a char16_t parser
+        template <ErrorAtom OtherAtom>
+            requires (!std::same_as<OtherAtom, Atom>)
+        ParseError(const ParseError<OtherAtom>& other);
+
         // Add error to error container
         ParseError& add_error(ErrorContent&& err);
 
@@ -85,18 +115,36 @@ namespace cpparsec {
         std::string message_stack();
 
     private:
+        template <ErrorAtom OtherAtom>
+        friend class ParseError;
+
         std::vector<ErrorContent> errors;
     };
 
-    template<typename T, std::formattable<char> Atom = char>
+    template<typename T, ErrorAtom Atom = char>
     using ParseResult = std::expected<T, ParseError<Atom>>;
 
+    // Atom type of an InputStream, its value_type if it has one, otherwise char
+    template <typename Input>
+    struct input_atom {
+        using type = char;
+    };
+
+    template <typename Input>
+        requires requires { typename Input::value_type; }
+    struct input_atom<Input> {
+        using type = typename Input::value_type;
+    };
+
+    template <typename Input>
+    using input_atom_t = typename input_atom<Input>::type;
+
     // ============================ PARSER CONCEPTS ===========================
 
     // Concept for a Parser that you can call .parse(s) on it, and it returns a ParserResult
     template<typename Parser, typename T, typename Input>
     concept ParserType = requires(Parser p, Input& s) {
-        { p.parse(s) } -> std::same_as<ParseResult<T>>;
+        { p.parse(s) } -> std::same_as<ParseResult<T, input_atom_t<Input>>>;
     };
 
     // Concept for a container that can call push_back
@@ -112,6 +160,122 @@ namespace cpparsec {
         { f(a) } -> std::convertible_to<bool>;
     };
 
+    // Number of readable bytes an InputStream guarantees past its end, see cpparsec_padded.h
+    // Leaf parsers use it to skip end of input checks, 0 for std::string_view
+    template <typename Input>
+    constexpr size_t input_padding() {
+        if constexpr (requires { Input::padding; }) {
+            return Input::padding;
+        }
+        else {
+            return 0;
+        }
+    }
+
+    // ============================== GRAMMAR IR ==============================
+
+    // Core combinators record how to make a GrammarNode next to their parse function, so the
+    // structure of a grammar can be read back with p.grammar() by optimizers, analyzers and backends
+    // Nodes are made the first time they are read, making a parser costs no more than before
+    // Parsers written with CPPARSEC_MAKE are opaque leaves, CPPARSEC_MAKE_NODE describes them
+
+    // Kind of a grammar IR node, named after the combinator recording it
+    enum class GrammarKind {
+        opaque,          // hand-written parser, structure unknown
+        char_,           // the atom atoms[0]
+        any_char,        // any one atom
+        char_class,      // one atom passing predicate, label is its error message
+        literal,         // string_, the atoms in order
+        sequence,        // children in order, returning child keep, or all of them if keep is -1
+        choice,          // or_, children in order
+        try_,
+        look_ahead,
+        not_followed_by,
+        optional,        // optional_, optional_result
+        many,
+        many1,
+        skip_many,
+        skip_many1,
+        many_till,       // children p and end
+        many1_till,
+        sep_by,          // children p and sep
+        sep_by1,
+        end_by,
+        end_by1,
+        count,           // count repetitions of the child
+        chainl1,         // children arg and op
+        chainl,
+        chainr1,         // children arg and op
+        chainr,
+        satisfy,         // child filtered by a condition on its result
+        transform,       // child with a function applied to its result
+        success,         // returns a value without consuming input
+        unexpected,
+        eof,
+        lazy,            // parser built at parse time, structure unknown
+        label,           // child with the error message label
+        memo,            // memo and packrat, child parsed through a packrat memo table
+        rule,            // named nonterminal, label is its name, a Rule has no children as it may refer to itself
+        expression,      // expression_parser, child the operand, label its operators, atoms the first of its prefix operators
+    };
+
+    // A node of a grammar IR tree, a kind with its children and constants
+    // Nodes are immutable once recorded, and shared by every parser built from them
+    template <typename Atom>
+    struct GrammarNode {
+        using Ptr = std::shared_ptr<const GrammarNode>;
+
+        GrammarKind kind = GrammarKind::opaque;
+        std::vector<Ptr> children;
+        std::vector<Atom> atoms;              // char_ and literal
+        std::function<bool(Atom)> predicate;  // char_class
+        std::string label;                    // char_class and label
+        bool pure = false;                    // char_class, predicate is safe to tabulate, see char_class()
+        int keep = -1;                        // sequence
+        size_t count = 0;                     // count
+        std::weak_ptr<const void> source;     // parse function that recorded the node, see Parser::recorded
+    };
+
+    // Name of a grammar IR node kind, e.g. "many1"
+    constexpr std::string_view grammar_kind_name(GrammarKind kind);
+
+    // Atoms a grammar can start with, an or_ over byte atoms skips alternatives ruled out by the next atom
+    struct FirstSet {
+        std::bitset<256> atoms;  // atoms the grammar may consume first, whether it then succeeds or fails
+        bool nullable = false;   // may succeed without consuming
+
+        // False if the grammar surely fails without consuming on input starting with atom
+        bool viable(unsigned char atom) const {
+            return nullable || atoms[atom];
+        }
+    };
+
+    // FIRST set of a grammar IR node over byte atoms
+    // An over-approximation, opaque and lazy nodes may start with any atom or none, as may
+    // char_satisfy with a user predicate, which is never called outside of a parse
+    template <typename Atom>
+        requires (sizeof(Atom) == 1)
+    FirstSet first_set(const GrammarNode<Atom>& node);
+
+    namespace detail {
+        // Makes the grammar IR node of a parser written with CPPARSEC_MAKE
+        template <typename Atom>
+        struct OpaqueNode {
+            GrammarNode<Atom> operator()() const {
+                return GrammarNode<Atom>{};
+            }
+        };
+
+        // Parse function of a Parser of any result type, the source of its grammar IR node
+        template <typename Input>
+        struct AnyParseFunction {
+            virtual ~AnyParseFunction() = default;
+
+            // Parses, dropping the result
+            virtual ParseResult<std::monostate, input_atom_t<Input>> recognize(Input& input) const = 0;
+        };
+    };
+
     // ================================ PARSER ================================
 
     template<typename T, typename Input = std::string_view>
@@ -119,24 +283,80 @@ namespace cpparsec {
     public:
         using Item = T;
         using InputStream = Input;
-        using ParseFunction = std::function<ParseResult<T>(InputStream&)>; // function takes InputStream, returns ParserResult<T>
+        using Atom = input_atom_t<Input>;
+        using Result = ParseResult<T, Atom>;
+        using ParseFunction = std::function<Result(InputStream&)>; // function takes InputStream, returns ParserResult<T>
         // ParseResult<T>(*)(InputStream&)
         
     
     private:
-        ParseFunction parser;
+        // Parse function of a Parser, shared by its copies
+        // Its grammar IR node is made by describe() the first time it is read
+        struct Function : detail::AnyParseFunction<Input> {
+            mutable std::once_flag described;
+            mutable std::shared_ptr<const GrammarNode<Atom>> node;
+
+            virtual Result operator()(InputStream& input) const = 0;
+            virtual GrammarNode<Atom> describe() const = 0;
+
+            ParseResult<std::monostate, Atom> recognize(InputStream& input) const override {
+                if (auto result = (*this)(input); !result) {
+                    return std::unexpected(std::move(result.error()));
+                }
+                return std::monostate{};
+            }
+        };
+
+        template <typename F, typename Describe>
+        struct DescribedFunction final : Function {
+            F function;
+            Describe make_node;
+
+            DescribedFunction(F&& function, Describe&& make_node) : function(std::move(function)), make_node(std::move(make_node)) { }
+
+            Result operator()(InputStream& input) const override {
+                return function(input);
+            }
+
+            GrammarNode<Atom> describe() const override {
+                return make_node();
+            }
+        };
+
+        std::shared_ptr<const Function> parser;
+
+        explicit Parser(std::shared_ptr<const Function> parser) : parser(std::move(parser)) { }
 
     public:
         // Implementation detail, Parsers take ParseFunctions
         // Use the CPPARSEC_MAKE macro for documented parsers
         Parser(ParseFunction&& parser);
 
+        // Implementation detail, a parse function and a function making its grammar IR node
+        // Use the CPPARSEC_MAKE and CPPARSEC_MAKE_NODE macros for documented parsers
+        template <typename F, typename Describe = detail::OpaqueNode<Atom>>
+            requires std::invocable<const F&, Input&>
+        explicit Parser(F parser, Describe describe = {});
+
         // Top level parser execution, parses a string
-        ParseResult<T> parse(const std::string& input) const;
+        Result parse(const std::basic_string<Atom>& input) const;
 
         // Top level parser execution, parses an InputStream
         // Parser consumes/modifies InputStream
-        ParseResult<T> parse(InputStream& input) const;
+        Result parse(InputStream& input) const;
+
+        // Grammar IR describing this parser, an opaque node if it was never described
+        std::shared_ptr<const GrammarNode<Atom>> grammar() const;
+
+        // The parser that recorded node, if it is still alive
+        // node must have been recorded by a Parser<T, Input>, e.g. a child of a node of this type
+        // whose result is the result of the node, like the kept child of a sequence
+        static std::optional<Parser<T, Input>> recorded(const GrammarNode<Atom>& node);
+
+        // This parser described by the grammar IR node describe() makes
+        // For combinators built from other combinators, e.g. sep_by from sep_by1 and or_
+        template <typename Describe>
+        Parser<T, Input> described(Describe describe) const;
 
         // Parses self and other, returns result of other
         template<typename U>
@@ -162,6 +382,10 @@ namespace cpparsec {
         Parser<T, Input> between(Parser<O, Input> open, Parser<C, Input> close) const;
 
         // | "or" operator parses the left parser, then the right parser if the left one fails without consuming
+        // Once hot, a choice over byte atoms parses through its ChoiceTable, going straight to the
+        // alternatives its next atom allows
+        // Only the library character classes and char_class are tabulated for it, char_satisfy predicates
+        // are only called by parses, so they may be impure
         Parser<T, Input> or_(const Parser<T, Input>& right) const;
 
         // Parses p without consuming input on failure
@@ -183,10 +407,18 @@ namespace cpparsec {
     // ============================ PARSER FACTORY ============================
 
     // Implementation detail, should never be invoked manually
-    template <typename ParserType>
+    template <typename ParserType, typename Describe = detail::OpaqueNode<typename ParserType::Atom>>
     struct _ParserFactory {
-        ParserType operator=(ParserType::ParseFunction&& parser) {
-            return ParserType(std::move(parser));
+        Describe describe;
+
+        template <typename F>
+        ParserType operator=(F&& parser) {
+            return ParserType(std::forward<F>(parser), std::move(describe));
+        }
+
+        template <typename D>
+        static _ParserFactory<ParserType, D> described(D describe) {
+            return { std::move(describe) };
         }
     };
 
@@ -297,13 +529,48 @@ namespace cpparsec {
 
     // Parse one or more left associative applications of op to p, returning the
     // result of the repeated applications. Can be used to parse 1+2+3+4 as ((1+2)+3)+4
-    template <typename T, typename Input>
-    Parser<T, Input> chainl1(Parser<T, Input> arg, Parser<std::function<T(T, T)>, Input> op);
+    // op returns the function applied, any callable of two operands, e.g. a lambda or std::function
+    template <typename T, typename Op, typename Input>
+        requires std::is_invocable_r_v<T, const Op&, T, T>
+    Parser<T, Input> chainl1(Parser<T, Input> arg, Parser<Op, Input> op);
+
+    // chainl1 with op returning a tag, e.g. an enum, applied to the operands a and b as apply(tag, a, b)
+    template <typename T, typename Op, typename Input, typename Apply>
+        requires std::is_invocable_r_v<T, const Apply&, Op, T, T>
+    Parser<T, Input> chainl1(Parser<T, Input> arg, Parser<Op, Input> op, Apply apply);
 
     // Parse zero or more left associative applications of op to p, returning the
     // result of the repeated applications. If there are zero applications, return backup.
-    template <typename T, typename Input>
-    Parser<T, Input> chainl(Parser<T, Input> arg, Parser<std::function<T(T, T)>, Input> op, T backup);
+    template <typename T, typename Op, typename Input>
+        requires std::is_invocable_r_v<T, const Op&, T, T>
+    Parser<T, Input> chainl(Parser<T, Input> arg, Parser<Op, Input> op, T backup);
+
+    // chainl with op returning a tag applied as apply(tag, a, b)
+    template <typename T, typename Op, typename Input, typename Apply>
+        requires std::is_invocable_r_v<T, const Apply&, Op, T, T>
+    Parser<T, Input> chainl(Parser<T, Input> arg, Parser<Op, Input> op, Apply apply, T backup);
+
+    // Parse one or more right associative applications of op to p, returning the
+    // result of the repeated applications. Can be used to parse 2^3^2 as 2^(3^2)
+    template <typename T, typename Op, typename Input>
+        requires std::is_invocable_r_v<T, const Op&, T, T>
+    Parser<T, Input> chainr1(Parser<T, Input> arg, Parser<Op, Input> op);
+
+    // chainr1 with op returning a tag applied as apply(tag, a, b)
+    template <typename T, typename Op, typename Input, typename Apply>
+        requires std::is_invocable_r_v<T, const Apply&, Op, T, T>
+    Parser<T, Input> chainr1(Parser<T, Input> arg, Parser<Op, Input> op, Apply apply);
+
+    // Parse zero or more right associative applications of op to p, returning the
+    // result of the repeated applications. If there are zero applications, return backup.
+    template <typename T, typename Op, typename Input>
+        requires std::is_invocable_r_v<T, const Op&, T, T>
+    Parser<T, Input> chainr(Parser<T, Input> arg, Parser<Op, Input> op, T backup);
+
+    // chainr with op returning a tag applied as apply(tag, a, b)
+    template <typename T, typename Op, typename Input, typename Apply>
+        requires std::is_invocable_r_v<T, const Apply&, Op, T, T>
+    Parser<T, Input> chainr(Parser<T, Input> arg, Parser<Op, Input> op, Apply apply, T backup);
 
     // Takes a std::function of a parser (not the parser itself) for deferred evaluation
     // Can be used to avoid infinite cycles in mutual recursion
@@ -365,27 +632,117 @@ namespace cpparsec {
 
     // ============================= PARSE ERROR ==============================
 
+    namespace detail {
+        // Appends a codepoint as UTF-8, unpaired surrogates and invalid values become U+FFFD
+        inline void append_utf8(std::string& out, char32_t c) {
+            if ((c >= 0xD800 && c <= 0xDFFF) || c > 0x10FFFF) {
+                c = 0xFFFD;
+            }
+
+            if (c < 0x80) {
+                out += static_cast<char>(c);
+            }
+            else if (c < 0x800) {
+                out += static_cast<char>(0xC0 | (c >> 6));
+                out += static_cast<char>(0x80 | (c & 0x3F));
+            }
+            else if (c < 0x10000) {
+                out += static_cast<char>(0xE0 | (c >> 12));
+                out += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (c & 0x3F));
+            }
+            else {
+                out += static_cast<char>(0xF0 | (c >> 18));
+                out += static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+                out += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (c & 0x3F));
+            }
+        }
+
+        // Converts a string of any character type to a std::string for error messages
+        // char and char8_t are copied as is, UTF-16 surrogate pairs are combined
+        template <typename Atom>
+        std::string to_utf8(std::basic_string_view<Atom> str) {
+            if constexpr (sizeof(Atom) == 1) {
+                return std::string(str.begin(), str.end());
+            }
+            else {
+                std::string out;
+                for (size_t i = 0; i < str.size(); i++) {
+                    char32_t c = static_cast<char32_t>(str[i]);
+
+                    if (sizeof(Atom) == 2 && c >= 0xD800 && c <= 0xDBFF && i + 1 < str.size()) {
+                        char32_t low = static_cast<char32_t>(str[i + 1]);
+                        if (low >= 0xDC00 && low <= 0xDFFF) {
+                            c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+                            i++;
+                        }
+                    }
+                    append_utf8(out, c);
+                }
+                return out;
+            }
+        }
+
+        // Converts a single atom to a std::string for error messages
+        template <typename Atom>
+        std::string atom_to_string(Atom c) {
+            if constexpr (std::same_as<Atom, char>) {
+                return std::string(1, c);
+            }
+            else if constexpr (std::formattable<Atom, char> && !std::is_integral_v<Atom>) {
+                return std::format("{}", c);
+            }
+            else {
+                return to_utf8(std::basic_string_view<Atom>(&c, 1));
+            }
+        }
+    };
+
+    // Widens errors built with another atom type, e.g. core combinator errors in a char16_t parser
+    template <ErrorAtom Atom>
+    template <ErrorAtom OtherAtom>
+        requires (!std::same_as<OtherAtom, Atom>)
+    ParseError<Atom>::ParseError(const ParseError<OtherAtom>& other) {
+        for (const auto& err : other.errors) {
+            std::visit([this](auto&& content) {
+                using V = std::decay_t<decltype(content)>;
+                if constexpr (std::is_same_v<V, std::pair<OtherAtom, OtherAtom>>) {
+                    if constexpr (std::convertible_to<OtherAtom, Atom>) {
+                        errors.push_back(ErrorContent{ std::pair<Atom, Atom>(content.first, content.second) });
+                    }
+                    else {
+                        errors.push_back(ErrorContent{ std::pair{ detail::atom_to_string(content.first), detail::atom_to_string(content.second) } });
+                    }
+                }
+                else {
+                    errors.push_back(ErrorContent{ content });
+                }
+            }, err);
+        }
+    }
+
     // Add error to error container
-    template <std::formattable<char> Atom>
+    template <ErrorAtom Atom>
     ParseError<Atom>& ParseError<Atom>::add_error(ErrorContent&& err) {
         errors.push_back(err);
         return *this;
     }
 
     // Returns deepest error message as a std::string
-    template <std::formattable<char> Atom>
+    template <ErrorAtom Atom>
     std::string ParseError<Atom>::message() {
         return std::format("{}", errors.front());
     }
 
     // Returns shallowest error message as a std::string
-    template <std::formattable<char> Atom>
+    template <ErrorAtom Atom>
     std::string ParseError<Atom>::message_top() {
         return std::format("{}", errors.back());
     }
 
     // Returns all error messages as a std::string
-    template <std::formattable<char> Atom>
+    template <ErrorAtom Atom>
     std::string ParseError<Atom>::message_stack() {
         std::string msg = std::format("{}", errors[0]);
 
@@ -396,37 +753,456 @@ namespace cpparsec {
         return msg;
     }
 
+    // ============================== Grammar IR ==============================
+
+    // Name of a grammar IR node kind, e.g. "many1"
+    constexpr std::string_view grammar_kind_name(GrammarKind kind) {
+        constexpr std::string_view names[] = {
+            "opaque", "char_", "any_char", "char_class", "literal", "sequence", "choice", "try_",
+            "look_ahead", "not_followed_by", "optional", "many", "many1", "skip_many", "skip_many1",
+            "many_till", "many1_till", "sep_by", "sep_by1", "end_by", "end_by1", "count", "chainl1",
+            "chainl", "chainr1", "chainr", "satisfy", "transform", "success", "unexpected", "eof", "lazy", "label", "memo", "rule",
+            "expression",
+        };
+        return names[static_cast<size_t>(kind)];
+    }
+
+    namespace detail {
+        // A grammar IR node over the grammar of each parser
+        template <typename T, typename Input, typename... Ps>
+        GrammarNode<input_atom_t<Input>> grammar_node(GrammarKind kind, const Parser<T, Input>& first, const Ps&... rest) {
+            return GrammarNode<input_atom_t<Input>>{ .kind = kind, .children = { first.grammar(), rest.grammar()... } };
+        }
+
+        // A sequence node over the grammar of each parser, returning the result of child keep
+        template <typename T, typename Input, typename... Ps>
+        GrammarNode<input_atom_t<Input>> sequence_node(int keep, const Parser<T, Input>& first, const Ps&... rest) {
+            GrammarNode<input_atom_t<Input>> node = grammar_node(GrammarKind::sequence, first, rest...);
+            node.keep = keep;
+            return node;
+        }
+
+        // The node of p.success(item), a sequence of p and a success leaf
+        template <typename T, typename Input>
+        GrammarNode<input_atom_t<Input>> success_node(const Parser<T, Input>& p) {
+            using Atom = input_atom_t<Input>;
+            GrammarNode<Atom> node = sequence_node(1, p);
+            node.children.push_back(std::make_shared<const GrammarNode<Atom>>(GrammarNode<Atom>{ GrammarKind::success }));
+            return node;
+        }
+
+        // The node of count(n, p)
+        template <typename T, typename Input>
+        GrammarNode<input_atom_t<Input>> count_node(int n, const Parser<T, Input>& p) {
+            GrammarNode<input_atom_t<Input>> node = grammar_node(GrammarKind::count, p);
+            node.count = n;
+            return node;
+        }
+
+        // The node of p ^ msg and p % msg
+        template <typename T, typename Input>
+        GrammarNode<input_atom_t<Input>> label_node(const std::string& msg, const Parser<T, Input>& p) {
+            GrammarNode<input_atom_t<Input>> node = grammar_node(GrammarKind::label, p);
+            node.label = msg;
+            return node;
+        }
+
+        // Writes a grammar IR tree on one line, e.g. many(char_class(<digit>))
+        template <typename Atom>
+        void format_grammar(std::string& out, const GrammarNode<Atom>& node) {
+            out += grammar_kind_name(node.kind);
+
+            if (node.kind == GrammarKind::char_) {
+                out += std::format("('{}')", atom_to_string(node.atoms[0]));
+                return;
+            }
+            if (node.kind == GrammarKind::literal) {
+                out += '"';
+                for (Atom c : node.atoms) {
+                    out += atom_to_string(c);
+                }
+                out += '"';
+                return;
+            }
+            if (node.kind == GrammarKind::char_class) {
+                out += std::format("({})", node.label);
+                return;
+            }
+            if (node.kind == GrammarKind::sequence && node.keep >= 0) {
+                out += std::format("<{}>", node.keep);
+            }
+            if (node.kind == GrammarKind::count) {
+                out += std::format("<{}>", node.count);
+            }
+            if (node.kind == GrammarKind::rule && node.children.empty()) {
+                out += std::format("(\"{}\")", node.label);
+                return;
+            }
+            if (node.children.empty()) {
+                return;
+            }
+
+            out += '(';
+            if (node.kind == GrammarKind::label || node.kind == GrammarKind::rule || node.kind == GrammarKind::expression) {
+                out += std::format("\"{}\", ", node.label);
+            }
+            for (size_t i = 0; i < node.children.size(); i++) {
+                if (i > 0) {
+                    out += ", ";
+                }
+                format_grammar(out, *node.children[i]);
+            }
+            out += ')';
+        }
+    };
+
+    namespace detail {
+        // Members of a class of byte atoms, its predicate called once with each byte value
+        // Bytes above 0x7F are passed as they are read from the input, negative for char, so a predicate
+        // handing them to <cctype> must convert them to unsigned char first, as the library classes do
+        template <typename Atom>
+            requires (sizeof(Atom) == 1)
+        std::bitset<256> class_members(const std::function<bool(Atom)>& predicate) {
+            std::bitset<256> members;
+            for (unsigned atom = 0; atom < 256; atom++) {
+                members[atom] = predicate(static_cast<Atom>(atom));
+            }
+            return members;
+        }
+
+        // FIRST set of parsing a, then b if a matched without consuming
+        inline FirstSet then_first(FirstSet a, const FirstSet& b) {
+            if (a.nullable) {
+                a.atoms |= b.atoms;
+                a.nullable = b.nullable;
+            }
+            return a;
+        }
+
+        // FIRST set of a, matching empty input too
+        inline FirstSet or_empty(FirstSet a) {
+            a.nullable = true;
+            return a;
+        }
+
+        // FIRST set of parsing a or b
+        inline FirstSet either_first(FirstSet a, const FirstSet& b) {
+            a.atoms |= b.atoms;
+            a.nullable |= b.nullable;
+            return a;
+        }
+    };
+
+    // FIRST set of a grammar IR node over byte atoms
+    // An over-approximation, opaque and lazy nodes may start with any atom or none, as may
+    // char_satisfy with a user predicate, which is never called outside of a parse
+    template <typename Atom>
+        requires (sizeof(Atom) == 1)
+    FirstSet first_set(const GrammarNode<Atom>& node) {
+        auto child = [&node](size_t i) { return first_set(*node.children[i]); };
+        FirstSet first;
+
+        switch (node.kind) {
+        case GrammarKind::char_:
+            first.atoms.set(static_cast<unsigned char>(node.atoms[0]));
+            return first;
+        case GrammarKind::any_char:
+            first.atoms.set();
+            return first;
+        case GrammarKind::char_class:
+            if (node.pure) {
+                first.atoms = detail::class_members(node.predicate);
+            }
+            else {
+                first.atoms.set();
+            }
+            return first;
+        case GrammarKind::literal:
+            if (node.atoms.empty()) {
+                first.nullable = true;
+            }
+            else {
+                first.atoms.set(static_cast<unsigned char>(node.atoms[0]));
+            }
+            return first;
+        case GrammarKind::sequence:
+            // later children only matter while every child before them can match empty input
+            first.nullable = true;
+            for (size_t i = 0; i < node.children.size() && first.nullable; i++) {
+                first = detail::then_first(first, child(i));
+            }
+            return first;
+        case GrammarKind::choice:
+            for (size_t i = 0; i < node.children.size(); i++) {
+                first = detail::either_first(first, child(i));
+            }
+            return first;
+        case GrammarKind::try_:
+        case GrammarKind::many1:
+        case GrammarKind::skip_many1:
+        case GrammarKind::satisfy:
+        case GrammarKind::transform:
+        case GrammarKind::label:
+        case GrammarKind::memo:
+            return child(0);
+        case GrammarKind::rule:
+            if (node.children.empty()) {
+                first.atoms.set();
+                return detail::or_empty(first);
+            }
+            return child(0);
+        case GrammarKind::look_ahead:
+        case GrammarKind::optional:
+        case GrammarKind::many:
+        case GrammarKind::skip_many:
+            return detail::or_empty(child(0));
+        case GrammarKind::count:
+            return node.count > 0 ? child(0) : detail::or_empty(first);
+        case GrammarKind::many_till:
+            // end is tried before each p
+            return detail::either_first(child(1), child(0));
+        case GrammarKind::many1_till:
+            return detail::then_first(child(0), detail::either_first(child(1), child(0)));
+        case GrammarKind::sep_by1:
+        case GrammarKind::chainl1:
+        case GrammarKind::chainr1:
+            // p then sep, or arg then op, stopping without consuming if sep or op fails
+            first = child(0);
+            return detail::either_first(first, detail::then_first(first, child(1)));
+        case GrammarKind::end_by1:
+            return detail::then_first(child(0), child(1));
+        case GrammarKind::sep_by:
+        case GrammarKind::end_by:
+        case GrammarKind::chainl:
+        case GrammarKind::chainr:
+            return detail::or_empty(detail::then_first(child(0), child(1)));
+        case GrammarKind::not_followed_by:
+        case GrammarKind::success:
+        case GrammarKind::eof:
+            return detail::or_empty(first);
+        case GrammarKind::unexpected:
+            return first;
+        case GrammarKind::expression:
+            // an operand, or a prefix operator
+            first = child(0);
+            for (Atom atom : node.atoms) {
+                first.atoms.set(static_cast<unsigned char>(atom));
+            }
+            return first;
+        default:
+            first.atoms.set();
+            return detail::or_empty(first);
+        }
+    }
+
+    // ============================ Choice Dispatch ===========================
+
+    namespace detail {
+        // Parses after which an or_ builds its ChoiceTable, so choices made and parsed
+        // once, such as inside another parse function, never pay for one
+        constexpr uint32_t choice_warmup_parses = 8;
+
+        // Alternatives of a choice over byte atoms worth trying for each next atom
+        // An alternative ruled out by its FIRST set would fail without consuming, so skipping it
+        // can't change the result, but the last one always runs as its error is the error of the choice
+        struct ChoiceRoutes {
+            std::vector<std::vector<uint32_t>> routes;  // distinct runs of alternatives, in order
+            std::array<uint32_t, 257> route_of{};       // route by next atom, 256 at end of input
+            bool dispatches = false;                    // some route skips an alternative
+
+            explicit ChoiceRoutes(const std::vector<FirstSet>& firsts) {
+                const uint32_t last = static_cast<uint32_t>(firsts.size() - 1);
+
+                for (unsigned next = 0; next <= 256; next++) {
+                    std::vector<uint32_t> route;
+                    for (uint32_t i = 0; i < last; i++) {
+                        if (next == 256 ? firsts[i].nullable : firsts[i].viable(static_cast<unsigned char>(next))) {
+                            route.push_back(i);
+                        }
+                    }
+                    route.push_back(last);
+                    dispatches |= route.size() < firsts.size();
+
+                    auto found = std::ranges::find(routes, route);
+                    route_of[next] = static_cast<uint32_t>(found - routes.begin());
+                    if (found == routes.end()) {
+                        routes.push_back(std::move(route));
+                    }
+                }
+            }
+
+            // Alternatives to try in order on input
+            template <typename Input>
+            const std::vector<uint32_t>& operator()(const Input& input) const {
+                return routes[route_of[input.size() == 0 ? 256 : static_cast<unsigned char>(*input.data())]];
+            }
+        };
+
+        // A choice flattened into its alternatives, parsed along their ChoiceRoutes
+        template <typename T, typename Input>
+        class ChoiceTable {
+        public:
+            // The choice of left and right, nested choices flattened into it
+            ChoiceTable(const Parser<T, Input>& left, const Parser<T, Input>& right) :
+                ChoiceTable(flattened({ left, right }))
+            { }
+
+            // The choice of alternatives with their FIRST sets
+            ChoiceTable(std::vector<Parser<T, Input>> alternatives, const std::vector<FirstSet>& firsts) :
+                alternatives(std::move(alternatives)), routes(firsts)
+            { }
+
+            // Parses as the or_ of the alternatives
+            ParseResult<T, input_atom_t<Input>> parse(Input& input) const {
+                const std::vector<uint32_t>& route = routes(input);
+
+                for (size_t k = 0; ; k++) {
+                    auto starting_input = input.data();
+                    auto result = alternatives[route[k]].parse(input);
+                    if (result || starting_input != input.data() || k + 1 == route.size()) {
+                        return result;
+                    }
+                }
+            }
+
+        private:
+            std::vector<Parser<T, Input>> alternatives;
+            ChoiceRoutes routes;
+
+            static ChoiceTable flattened(const std::vector<Parser<T, Input>>& parsers) {
+                std::vector<Parser<T, Input>> alternatives;
+                std::vector<FirstSet> firsts;
+                for (const Parser<T, Input>& p : parsers) {
+                    flatten(p, alternatives, firsts);
+                }
+                return ChoiceTable(std::move(alternatives), firsts);
+            }
+
+            static void flatten(const Parser<T, Input>& p, std::vector<Parser<T, Input>>& alternatives, std::vector<FirstSet>& firsts) {
+                auto node = p.grammar();
+                if (node->kind == GrammarKind::choice) {
+                    std::vector<Parser<T, Input>> children;
+                    for (const auto& child : node->children) {
+                        if (std::optional<Parser<T, Input>> recorded = Parser<T, Input>::recorded(*child)) {
+                            children.push_back(*std::move(recorded));
+                        }
+                    }
+                    if (children.size() == node->children.size()) {
+                        for (const Parser<T, Input>& child : children) {
+                            flatten(child, alternatives, firsts);
+                        }
+                        return;
+                    }
+                }
+
+                alternatives.push_back(p);
+                firsts.push_back(first_set(*node));
+            }
+        };
+
+        // The ChoiceTable of an or_, built by the parse that makes the choice hot
+        template <typename T, typename Input>
+        class LazyChoiceTable {
+        public:
+            LazyChoiceTable() = default;
+            LazyChoiceTable(const LazyChoiceTable&) { } // copies start cold
+            LazyChoiceTable& operator=(const LazyChoiceTable&) = delete;
+
+            ~LazyChoiceTable() {
+                delete table.load(std::memory_order_acquire);
+            }
+
+            // The table of the choice of left and right, nullptr while the choice is cold
+            const ChoiceTable<T, Input>* get(const Parser<T, Input>& left, const Parser<T, Input>& right) const {
+                if (const ChoiceTable<T, Input>* built = table.load(std::memory_order_acquire)) {
+                    return built;
+                }
+                if (parses.fetch_add(1, std::memory_order_relaxed) + 1 != choice_warmup_parses) {
+                    return nullptr;
+                }
+
+                const ChoiceTable<T, Input>* built = new ChoiceTable<T, Input>(left, right);
+                table.store(built, std::memory_order_release);
+                return built;
+            }
+
+        private:
+            mutable std::atomic<const ChoiceTable<T, Input>*> table = nullptr;
+            mutable std::atomic<uint32_t> parses = 0;
+        };
+    };
+
     // ================================ Parser ================================
 
     // Implementation detail, Parsers take ParseFunctions
     // Use the CPPARSEC_MAKE macro for documented parsers
     template <typename T, typename Input>
     Parser<T, Input>::Parser(ParseFunction&& parser) :
-        parser(std::move(parser))
+        Parser(std::move(parser), detail::OpaqueNode<Atom>{})
+    { }
+
+    // Implementation detail, a parse function and a function making its grammar IR node
+    // Use the CPPARSEC_MAKE and CPPARSEC_MAKE_NODE macros for documented parsers
+    template <typename T, typename Input>
+    template <typename F, typename Describe>
+        requires std::invocable<const F&, Input&>
+    Parser<T, Input>::Parser(F parser, Describe describe) :
+        parser(std::make_shared<const DescribedFunction<F, Describe>>(std::move(parser), std::move(describe)))
     { }
 
     // Top level parser execution, parses a string
     template <typename T, typename Input>
-    ParseResult<T> Parser<T, Input>::parse(const std::string& input) const {
+    Parser<T, Input>::Result Parser<T, Input>::parse(const std::basic_string<Atom>& input) const {
         InputStream view = input;
-        return parser(view);
+        return (*parser)(view);
     }
 
     // Top level parser execution, parses a string_view
     // Parser consumes/modifies string_view
     template <typename T, typename Input>
-    ParseResult<T> Parser<T, Input>::parse(Parser<T, Input>::InputStream& input) const {
+    Parser<T, Input>::Result Parser<T, Input>::parse(Parser<T, Input>::InputStream& input) const {
         InputStream view = input;
-        auto result = parser(view);
+        auto result = (*parser)(view);
         input = view;
         return result;
     }
 
+    // Grammar IR describing this parser, an opaque node if it was never described
+    template <typename T, typename Input>
+    std::shared_ptr<const GrammarNode<typename Parser<T, Input>::Atom>> Parser<T, Input>::grammar() const {
+        const Function& function = *parser;
+        std::call_once(function.described, [this, &function] {
+            GrammarNode<Atom> node = function.describe();
+            node.source = std::shared_ptr<const detail::AnyParseFunction<Input>>(parser);
+            function.node = std::make_shared<const GrammarNode<Atom>>(std::move(node));
+        });
+
+        return function.node;
+    }
+
+    // The parser that recorded node, if it is still alive
+    template <typename T, typename Input>
+    std::optional<Parser<T, Input>> Parser<T, Input>::recorded(const GrammarNode<Atom>& node) {
+        auto source = std::static_pointer_cast<const detail::AnyParseFunction<Input>>(node.source.lock());
+        if (!source) {
+            return std::nullopt;
+        }
+
+        return Parser(std::static_pointer_cast<const Function>(source));
+    }
+
+    // This parser described by the grammar IR node describe() makes
+    template <typename T, typename Input>
+    template <typename Describe>
+    Parser<T, Input> Parser<T, Input>::described(Describe describe) const {
+        return Parser([inner = parser](InputStream& input) { return (*inner)(input); }, std::move(describe));
+    }
+
     // Parses self and other, returns result of other
     template<typename T, typename Input>
     template<typename U>
     Parser<U, Input> Parser<T, Input>::with(Parser<U, Input> other) const {
-        return CPPARSEC_MAKE_METHOD(thisParser, Parser<U, Input>) {
+        return CPPARSEC_MAKE_METHOD_NODE(thisParser, detail::sequence_node(1, thisParser, other), Parser<U, Input>) {
             CPPARSEC_SKIP(thisParser);
             CPPARSEC_SAVE(result, other);
 
@@ -438,7 +1214,7 @@ namespace cpparsec {
     template<typename T, typename Input>
     template<typename U>
     Parser<T, Input> Parser<T, Input>::skip(Parser<U, Input> other) const {
-        return CPPARSEC_MAKE_METHOD(thisParser, Parser<T, Input>) {
+        return CPPARSEC_MAKE_METHOD_NODE(thisParser, detail::sequence_node(0, thisParser, other), Parser<T, Input>) {
             CPPARSEC_SAVE(result, thisParser);
             CPPARSEC_SKIP(other);
 
@@ -451,7 +1227,7 @@ namespace cpparsec {
     template<typename T, typename Input>
     template<typename U>
     Parser<std::pair<T, U>, Input> Parser<T, Input>::pair_with(Parser<U, Input> other) const {
-        return CPPARSEC_MAKE_METHOD(thisParser, Parser<std::pair<T, U>, Input>) {
+        return CPPARSEC_MAKE_METHOD_NODE(thisParser, detail::sequence_node(-1, thisParser, other), Parser<std::pair<T, U>, Input>) {
             CPPARSEC_SAVE(a, thisParser);
             CPPARSEC_SAVE(b, other);
 
@@ -462,8 +1238,8 @@ namespace cpparsec {
     // Parses occurence satisfying a condition
     template<typename T, typename Input>
     Parser<T, Input> Parser<T, Input>::satisfy(std::function<bool(T)> cond) const {
-        return CPPARSEC_MAKE_METHOD(thisParser, Parser<T, Input>) {
-            ParseResult<T> result = thisParser.parse(input);
+        return CPPARSEC_MAKE_METHOD_NODE(thisParser, detail::grammar_node(GrammarKind::satisfy, thisParser), Parser<T, Input>) {
+            auto result = thisParser.parse(input);
             CPPARSEC_FAIL_IF(!result || !cond(*result), ParseError("Failed satisfy"));
 
             return result;
@@ -474,7 +1250,7 @@ namespace cpparsec {
     template<typename T, typename Input>
     template <typename U>
     Parser<U, Input> Parser<T, Input>::success(U item) {
-        return CPPARSEC_MAKE_METHOD(thisParser, Parser<U, Input>) {
+        return CPPARSEC_MAKE_METHOD_NODE(thisParser, detail::success_node(thisParser), Parser<U, Input>) {
             CPPARSEC_SKIP(thisParser);
             return item;
         };
@@ -488,11 +1264,21 @@ namespace cpparsec {
     }
 
     // | "or" operator parses the left parser, then the right parser if the left one fails without consuming
+    // Once hot, a choice over byte atoms parses through its ChoiceTable, going straight to the
+    // alternatives its next atom allows
     template <typename T, typename Input>
     Parser<T, Input> Parser<T, Input>::or_(const Parser<T, Input>& right) const {
-        return CPPARSEC_MAKE_METHOD(thisParser, Parser<T, Input>) {
+        detail::LazyChoiceTable<T, Input> table;
+
+        return CPPARSEC_MAKE_METHOD_NODE(thisParser, detail::grammar_node(GrammarKind::choice, thisParser, right), Parser<T, Input>) {
+            if constexpr (sizeof(Atom) == 1) {
+                if (const detail::ChoiceTable<T, Input>* dispatch = table.get(thisParser, right)) {
+                    return dispatch->parse(input);
+                }
+            }
+
             auto starting_input = input;
-            if (ParseResult<T> result = thisParser.parse(input)) {
+            if (auto result = thisParser.parse(input)) {
                 return result;
             }
             else if (starting_input.data() != input.data()) {
@@ -506,9 +1292,9 @@ namespace cpparsec {
     // Parses p without consuming input on failure
     template<typename T, typename Input>
     Parser<T, Input> Parser<T, Input>::try_() const {
-        return CPPARSEC_MAKE_METHOD(thisParser, Parser<T, Input>) {
+        return CPPARSEC_MAKE_METHOD_NODE(thisParser, detail::grammar_node(GrammarKind::try_, thisParser), Parser<T, Input>) {
             auto starting_input = input;
-            ParseResult<T> result = thisParser.parse(input);
+            auto result = thisParser.parse(input);
             if (!result) {
                 input = starting_input; // undo input consumption
             }
@@ -523,7 +1309,7 @@ namespace cpparsec {
     template <typename Func>
     auto Parser<T, Input>::transform(Func&& func) const {
         using U = typename std::invoke_result_t<Func, T>;
-        return CPPARSEC_MAKE_METHOD(thisParser, Parser<U, Input>) {
+        return CPPARSEC_MAKE_METHOD_NODE(thisParser, detail::grammar_node(GrammarKind::transform, thisParser), Parser<U, Input>) {
             CPPARSEC_SAVE(val, thisParser);
             return func(val);
         };
@@ -535,7 +1321,7 @@ namespace cpparsec {
     // Parses given number of parses
     template<typename T, typename Input>
     Parser<std::vector<T>, Input> count(int n, Parser<T, Input> p) {
-        return CPPARSEC_MAKE(Parser<std::vector<T>, Input>) {
+        return CPPARSEC_MAKE_NODE(detail::count_node(n, p), Parser<std::vector<T>, Input>) {
             std::vector<T> vec(n);
 
             for (int i = 0; i < n; i++) {
@@ -554,7 +1340,16 @@ namespace cpparsec {
             return unexpected<Input, T>();
         }
 
-        return std::ranges::fold_left_first(parsers, std::bit_or<>{}).value();
+        // one choice node over every alternative rather than the nested or_ nodes
+        auto describe = [parsers] {
+            GrammarNode<input_atom_t<Input>> node{ GrammarKind::choice };
+            for (const Parser<T, Input>& p : parsers) {
+                node.children.push_back(p.grammar());
+            }
+            return node;
+        };
+
+        return std::ranges::fold_left_first(parsers, std::bit_or<>{}).value().described(describe);
     }
 
     // Parse occurence between two parses
@@ -570,7 +1365,7 @@ namespace cpparsec {
 
     template<typename O, typename C, typename T, typename Input>
     Parser<T, Input> between3(Parser<O> open, Parser<C> close, Parser<T, Input> p) {
-        return CPPARSEC_MAKE(Parser<T, Input>) {
+        return CPPARSEC_MAKE_NODE(detail::sequence_node(1, open, p, close), Parser<T, Input>) {
             CPPARSEC_SKIP(open);
             CPPARSEC_SAVE(middle, p);
             CPPARSEC_SKIP(close);
@@ -595,7 +1390,7 @@ namespace cpparsec {
     // Parses p without consuming input. If p fails, it will consume input. Wrap p with try_ to avoid this.
     template <typename T, typename Input>
     Parser<T, Input> look_ahead(Parser<T, Input> p) {
-        return CPPARSEC_MAKE(Parser<T, Input>) {
+        return CPPARSEC_MAKE_NODE(detail::grammar_node(GrammarKind::look_ahead, p), Parser<T, Input>) {
             auto input_copy = input;
             CPPARSEC_SAVE(value, p);
             input = input_copy;
@@ -607,9 +1402,9 @@ namespace cpparsec {
     // Succeeds only if p fails to parse. Never consumes input.
     template <typename T, typename Input>
     Parser<std::monostate, Input> not_followed_by(Parser<T, Input> p) {
-        return CPPARSEC_MAKE(Parser<std::monostate, Input>) {
+        return CPPARSEC_MAKE_NODE(detail::grammar_node(GrammarKind::not_followed_by, p), Parser<std::monostate, Input>) {
             auto input_copy = input;
-            ParseResult<T> result = p.parse(input);
+            auto result = p.parse(input);
             input = input_copy;
             CPPARSEC_FAIL_IF(result.has_value(), ParseError("not_followed_by", "not_followed_by"));
 
@@ -620,8 +1415,8 @@ namespace cpparsec {
     // Parses p if p passes a condition, failing if it doesn't
     template<typename T, typename Input>
     Parser<T, Input> satisfy(const Parser<T, Input>& p, auto cond) {
-        return CPPARSEC_MAKE(Parser<T, Input>) {
-            ParseResult<T> result = p.parse(input);
+        return CPPARSEC_MAKE_NODE(detail::grammar_node(GrammarKind::satisfy, p), Parser<T, Input>) {
+            auto result = p.parse(input);
             CPPARSEC_FAIL_IF(!result || !cond(*result), ParseError("Failed satisfy"));
 
             return result;
@@ -632,7 +1427,7 @@ namespace cpparsec {
     // Input type must be specified for custom Input types
     template <typename Input = std::string_view, typename T>
     Parser<T, Input> success(T item) {
-        return CPPARSEC_MAKE(Parser<T, Input>) {
+        return CPPARSEC_MAKE_NODE(GrammarNode<input_atom_t<Input>>{ GrammarKind::success }, Parser<T, Input>) {
             return item;
         };
     }
@@ -641,7 +1436,7 @@ namespace cpparsec {
     // Input type must be specified for custom Input types
     template <typename Input = std::string_view, typename T = std::monostate>
     Parser<T, Input> unexpected() {
-        return CPPARSEC_MAKE(Parser<T, Input>) {
+        return CPPARSEC_MAKE_NODE(GrammarNode<input_atom_t<Input>>{ GrammarKind::unexpected }, Parser<T, Input>) {
             CPPARSEC_FAIL(ParseError("unexpected"));
         };
     }
@@ -650,8 +1445,8 @@ namespace cpparsec {
     // Input type must be specified for custom Input types
     template <typename Input = std::string_view, std::default_initializable T = std::monostate>
     Parser<T, Input> eof() {
-        return CPPARSEC_MAKE(Parser<T, Input>) {
-            CPPARSEC_FAIL_IF(input.size() > 0, ParseError(std::format("{}", *input.begin()), "end of input"));
+        return CPPARSEC_MAKE_NODE(GrammarNode<input_atom_t<Input>>{ GrammarKind::eof }, Parser<T, Input>) {
+            CPPARSEC_FAIL_IF(input.size() > 0, ParseError(detail::atom_to_string(*input.begin()), "end of input"));
             return T{};
         };
     }
@@ -681,15 +1476,21 @@ namespace cpparsec {
     // Parses for an optional p, succeeds if p fails without consuming, skip result
     template<typename T, typename Input>
     Parser<std::monostate, Input> optional_(Parser<T, Input> p) {
-        return p.success(std::monostate{}) | success<Input>(std::monostate{});
+        return CPPARSEC_MAKE_NODE(detail::grammar_node(GrammarKind::optional, p), Parser<std::monostate, Input>) {
+            auto start_point = input.data();
+            auto result = p.parse(input);
+            CPPARSEC_FAIL_IF(!result && start_point != input.data(), result.error());
+
+            return std::monostate{};
+        };
     }
 
     // Parses for an optional p, succeeds if p fails without consuming
     template<typename T, typename Input>
     Parser<std::optional<T>, Input> optional_result(Parser<T, Input> p) {
-        return CPPARSEC_MAKE(Parser<std::optional<T>, Input>) {
+        return CPPARSEC_MAKE_NODE(detail::grammar_node(GrammarKind::optional, p), Parser<std::optional<T>, Input>) {
             auto start_point = input.data();
-            ParseResult<T> result = p.parse(input);
+            auto result = p.parse(input);
             CPPARSEC_FAIL_IF(!result && start_point != input.data(), result.error());
 
             return (result ? std::optional(result.value()) : std::nullopt);
@@ -697,15 +1498,15 @@ namespace cpparsec {
     }
 
     namespace detail {
-        template <typename T, PushBack<T> Container = std::vector<T>, typename Input>
+        template <typename T, PushBack<T> Container = std::vector<T>, typename Input, typename Describe = OpaqueNode<input_atom_t<Input>>>
             requires std::movable<Container>
-        Parser<Container, Input> many_accumulator(Parser<T, Input> p, Container&& init = {}) {
-            return CPPARSEC_MAKE(Parser<Container, Input>) {
+        Parser<Container, Input> many_accumulator(Parser<T, Input> p, Container&& init = {}, Describe describe = {}) {
+            return CPPARSEC_MAKE_NODE(describe(), Parser<Container, Input>) {
                 Container values(init);
 
                 while (true) {
                     auto starting_point = input.data();
-                    if (ParseResult<T> result = p.parse(input)) {
+                    if (auto result = p.parse(input)) {
                         values.push_back(*result);
                         continue;
                     }
@@ -726,13 +1527,13 @@ namespace cpparsec {
     // Parse zero or more parses
     template<typename T, PushBack<T> Container = std::vector<T>, typename Input>
     Parser<Container, Input> many(Parser<T, Input> p) {
-        return detail::many_accumulator<T, Container>(p);
+        return detail::many_accumulator<T, Container>(p, {}, [p] { return detail::grammar_node(GrammarKind::many, p); });
     }
 
     // Parse one or more parses
     template<typename T, PushBack<T> Container = std::vector<T>, typename Input>
     Parser<Container, Input> many1(Parser<T, Input> p) {
-        return CPPARSEC_MAKE(Parser<Container, Input>) {
+        return CPPARSEC_MAKE_NODE(detail::grammar_node(GrammarKind::many1, p), Parser<Container, Input>) {
             CPPARSEC_SAVE(first, p);
             CPPARSEC_SAVE(values, detail::many_accumulator<T, Container>(p, { first }));
 
@@ -741,10 +1542,10 @@ namespace cpparsec {
     }
 
     namespace detail {
-        template <typename T, typename U, PushBack<T> Container = std::vector<T>, typename Input>
+        template <typename T, typename U, PushBack<T> Container = std::vector<T>, typename Input, typename Describe = OpaqueNode<input_atom_t<Input>>>
             requires std::movable<Container>
-        Parser<Container, Input> many_till_accumulator(Parser<T, Input> p, Parser<U, Input> end, Container&& init = {}) {
-            return CPPARSEC_MAKE(Parser<Container, Input>) {
+        Parser<Container, Input> many_till_accumulator(Parser<T, Input> p, Parser<U, Input> end, Container&& init = {}, Describe describe = {}) {
+            return CPPARSEC_MAKE_NODE(describe(), Parser<Container, Input>) {
                 Container values(init);
 
                 while (true) {
@@ -755,7 +1556,7 @@ namespace cpparsec {
                     }
                     CPPARSEC_FAIL_IF(start_point != input.data(), ParseError("many_tillfail", "many_tillfail"));
 
-                    if (ParseResult<T> result = p.parse(input)) {
+                    if (auto result = p.parse(input)) {
                         values.push_back(*result);
                         continue;
                     }
@@ -772,13 +1573,13 @@ namespace cpparsec {
     // Parses p zero or more times until end succeeds, returning the parsed values
     template <typename T, typename U, PushBack<T> Container = std::vector<T>, typename Input>
     Parser<Container, Input> many_till(Parser<T, Input> p, Parser<U, Input> end) {
-        return detail::many_till_accumulator<T, U, Container, Input>(p, end);
+        return detail::many_till_accumulator<T, U, Container, Input>(p, end, {}, [p, end] { return detail::grammar_node(GrammarKind::many_till, p, end); });
     }
 
     // Parses p one or more times until end succeeds, returning the parsed values
     template <typename T, typename U, PushBack<T> Container = std::vector<T>, typename Input>
     Parser<Container, Input> many1_till(Parser<T, Input> p, Parser<U, Input> end) {
-        return CPPARSEC_MAKE(Parser<Container, Input>) {
+        return CPPARSEC_MAKE_NODE(detail::grammar_node(GrammarKind::many1_till, p, end), Parser<Container, Input>) {
             CPPARSEC_SAVE(first, p);
             CPPARSEC_SAVE(values, detail::many_till_accumulator<T, U, Container, Input>(p, end, { first }));
 
@@ -802,7 +1603,7 @@ namespace cpparsec {
     // Parses zero or more instances of p, ignores results
     template <typename T, typename Input>
     Parser<std::monostate, Input> skip_many(Parser<T, Input> p) {
-        return CPPARSEC_MAKE(Parser<std::monostate, Input>) {
+        return CPPARSEC_MAKE_NODE(detail::grammar_node(GrammarKind::skip_many, p), Parser<std::monostate, Input>) {
             while (true) {
                 auto starting_point = input.data();
                 if (!p.parse(input)) {
@@ -815,23 +1616,31 @@ namespace cpparsec {
     }
 
     // Parses one or more instances of p, ignores results
-    template <typename T>
-    Parser<std::monostate> skip_many1(Parser<T> p) {
-        return p >> skip_many(p);
+    template <typename T, typename Input>
+    Parser<std::monostate, Input> skip_many1(Parser<T, Input> p) {
+        Parser<std::monostate, Input> rest = skip_many(p);
+
+        return CPPARSEC_MAKE_NODE(detail::grammar_node(GrammarKind::skip_many1, p), Parser<std::monostate, Input>) {
+            CPPARSEC_SKIP(p);
+            return rest.parse(input);
+        };
     }
 
     // Parse zero or more parses of p separated by sep
     template <typename T, typename U, typename Input>
     Parser<std::vector<T>, Input> sep_by(Parser<T, Input> p, Parser<U, Input> sep) {
-        return sep_by1(p, sep) | success<Input>(std::vector<T>());
+        auto values = sep_by1(p, sep) | success<Input>(std::vector<T>());
+        return values.described([p, sep] { return detail::grammar_node(GrammarKind::sep_by, p, sep); });
     }
 
     // Parse one or more parses of p separated by sep
     template <typename T, typename U, typename Input>
     Parser<std::vector<T>, Input> sep_by1(Parser<T, Input> p, Parser<U, Input> sep) {
-        return CPPARSEC_MAKE(Parser<std::vector<T>, Input>) {
+        Parser<T, Input> next = sep >> p;
+
+        return CPPARSEC_MAKE_NODE(detail::grammar_node(GrammarKind::sep_by1, p, sep), Parser<std::vector<T>, Input>) {
             CPPARSEC_SAVE(first, p);
-            CPPARSEC_SAVE(values, detail::many_accumulator(sep >> p, { first }));
+            CPPARSEC_SAVE(values, detail::many_accumulator(next, { first }));
 
             return values;
         };
@@ -840,50 +1649,134 @@ namespace cpparsec {
     // Parse zero or more parses of p separated by and ending with sep
     template <typename T, typename U>
     Parser<std::vector<T>> end_by(Parser<T> p, Parser<U> sep) {
-        return many(p << sep);
+        return many(p << sep).described([p, sep] { return detail::grammar_node(GrammarKind::end_by, p, sep); });
     }
 
     // Parse one or more parses of p separated by and ending with sep
     template <typename T, typename U>
     Parser<std::vector<T>> end_by1(Parser<T> p, Parser<U> sep) {
-        return many1(p << sep);
+        return many1(p << sep).described([p, sep] { return detail::grammar_node(GrammarKind::end_by1, p, sep); });
+    }
+
+    namespace detail {
+        // Applies an operator returned by the op of a chain to its operands
+        struct InvokeOperator {
+            template <typename Op, typename T>
+            T operator()(const Op& op, T&& a, T&& b) const {
+                return std::invoke(op, std::move(a), std::move(b));
+            }
+        };
     }
 
     // Parse one or more left associative applications of op to p, returning the
     // result of the repeated applications. Can be used to parse 1+2+3+4 as ((1+2)+3)+4
-    template <typename T, typename Input>
-    Parser<T, Input> chainl1(Parser<T, Input> arg, Parser<std::function<T(T, T)>, Input> op) {
-        return CPPARSEC_MAKE(Parser<T, Input>) {
+    template <typename T, typename Op, typename Input>
+        requires std::is_invocable_r_v<T, const Op&, T, T>
+    Parser<T, Input> chainl1(Parser<T, Input> arg, Parser<Op, Input> op) {
+        return chainl1(arg, op, detail::InvokeOperator{});
+    }
+
+    // chainl1 with op returning a tag applied as apply(tag, a, b)
+    // The result is moved through the loop, each operator is applied without type erasure
+    template <typename T, typename Op, typename Input, typename Apply>
+        requires std::is_invocable_r_v<T, const Apply&, Op, T, T>
+    Parser<T, Input> chainl1(Parser<T, Input> arg, Parser<Op, Input> op, Apply apply) {
+        return CPPARSEC_MAKE_NODE(detail::grammar_node(GrammarKind::chainl1, arg, op), Parser<T, Input>) {
             CPPARSEC_SAVE(arg1, arg);
 
             while (true) {
                 auto start_point = input.data();
-                ParseResult<std::function<T(T, T)>> f = op.parse(input);
+                auto f = op.parse(input);
                 if (!f) {
                     CPPARSEC_FAIL_IF(start_point != input.data(), f.error());
                     break;
                 }
                 CPPARSEC_SAVE(arg2, arg);
 
-                arg1 = (*f)(arg1, arg2);
+                arg1 = apply(std::move(*f), std::move(arg1), std::move(arg2));
             }
 
-            return arg1;
+            return std::move(arg1);
         };
     }
 
     // Parse zero or more left associative applications of op to p, returning the
     // result of the repeated applications. If there are zero applications, return backup.
-    template <typename T, typename Input>
-    Parser<T, Input> chainl(Parser<T, Input> arg, Parser<std::function<T(T, T)>, Input> op, T backup) {
-        return chainl1(arg, op) | success(backup);
+    template <typename T, typename Op, typename Input>
+        requires std::is_invocable_r_v<T, const Op&, T, T>
+    Parser<T, Input> chainl(Parser<T, Input> arg, Parser<Op, Input> op, T backup) {
+        return chainl(arg, op, detail::InvokeOperator{}, std::move(backup));
+    }
+
+    // chainl with op returning a tag applied as apply(tag, a, b)
+    template <typename T, typename Op, typename Input, typename Apply>
+        requires std::is_invocable_r_v<T, const Apply&, Op, T, T>
+    Parser<T, Input> chainl(Parser<T, Input> arg, Parser<Op, Input> op, Apply apply, T backup) {
+        auto chain = chainl1(arg, op, apply) | success<Input>(backup);
+        return chain.described([arg, op] { return detail::grammar_node(GrammarKind::chainl, arg, op); });
+    }
+
+    // Parse one or more right associative applications of op to p, returning the
+    // result of the repeated applications. Can be used to parse 2^3^2 as 2^(3^2)
+    template <typename T, typename Op, typename Input>
+        requires std::is_invocable_r_v<T, const Op&, T, T>
+    Parser<T, Input> chainr1(Parser<T, Input> arg, Parser<Op, Input> op) {
+        return chainr1(arg, op, detail::InvokeOperator{});
+    }
+
+    // chainr1 with op returning a tag applied as apply(tag, a, b)
+    // Operands and operators are collected, then folded from the right, so long chains don't recurse
+    template <typename T, typename Op, typename Input, typename Apply>
+        requires std::is_invocable_r_v<T, const Apply&, Op, T, T>
+    Parser<T, Input> chainr1(Parser<T, Input> arg, Parser<Op, Input> op, Apply apply) {
+        return CPPARSEC_MAKE_NODE(detail::grammar_node(GrammarKind::chainr1, arg, op), Parser<T, Input>) {
+            CPPARSEC_SAVE(last, arg);
+            std::vector<T> args;
+            std::vector<Op> ops;
+
+            while (true) {
+                auto start_point = input.data();
+                auto f = op.parse(input);
+                if (!f) {
+                    CPPARSEC_FAIL_IF(start_point != input.data(), f.error());
+                    break;
+                }
+                CPPARSEC_SAVE(next, arg);
+
+                args.push_back(std::move(last));
+                ops.push_back(std::move(*f));
+                last = std::move(next);
+            }
+
+            for (size_t i = ops.size(); i-- > 0; ) {
+                last = apply(std::move(ops[i]), std::move(args[i]), std::move(last));
+            }
+
+            return std::move(last);
+        };
+    }
+
+    // Parse zero or more right associative applications of op to p, returning the
+    // result of the repeated applications. If there are zero applications, return backup.
+    template <typename T, typename Op, typename Input>
+        requires std::is_invocable_r_v<T, const Op&, T, T>
+    Parser<T, Input> chainr(Parser<T, Input> arg, Parser<Op, Input> op, T backup) {
+        return chainr(arg, op, detail::InvokeOperator{}, std::move(backup));
+    }
+
+    // chainr with op returning a tag applied as apply(tag, a, b)
+    template <typename T, typename Op, typename Input, typename Apply>
+        requires std::is_invocable_r_v<T, const Apply&, Op, T, T>
+    Parser<T, Input> chainr(Parser<T, Input> arg, Parser<Op, Input> op, Apply apply, T backup) {
+        auto chain = chainr1(arg, op, apply) | success<Input>(backup);
+        return chain.described([arg, op] { return detail::grammar_node(GrammarKind::chainr, arg, op); });
     }
 
     // Takes a std::function of a parser (not the parser itself) for deferred evaluation
     // Can be used to avoid infinite cycles in mutual recursion
     template<typename T, typename Input>
     Parser<T, Input> lazy(std::function<Parser<T, Input>()> parser_func) {
-        return CPPARSEC_MAKE(Parser<T, Input>) {
+        return CPPARSEC_MAKE_NODE(GrammarNode<input_atom_t<Input>>{ GrammarKind::lazy }, Parser<T, Input>) {
             return parser_func().parse(input);
         };
     }
@@ -892,7 +1785,7 @@ namespace cpparsec {
     // Can be used to avoid infinite cycles in mutual recursion
     template<typename T, typename Input>
     Parser<T, Input> lazy(Parser<T, Input>(*parser_func)()) {
-        return CPPARSEC_MAKE(Parser<T, Input>) {
+        return CPPARSEC_MAKE_NODE(GrammarNode<input_atom_t<Input>>{ GrammarKind::lazy }, Parser<T, Input>) {
             return parser_func().parse(input);
         };
     }
@@ -922,7 +1815,7 @@ namespace cpparsec {
     // & "and" operator joins two parses
     template <typename T, typename U, typename Input>
     Parser<std::tuple<T, U>, Input> operator&(const Parser<T, Input> left, const Parser<U, Input> right) {
-        return CPPARSEC_MAKE(Parser<std::tuple<T, U>, Input>) {
+        return CPPARSEC_MAKE_NODE(detail::sequence_node(-1, left, right), Parser<std::tuple<T, U>, Input>) {
             CPPARSEC_SAVE(a, left);
             CPPARSEC_SAVE(b, right);
 
@@ -933,7 +1826,7 @@ namespace cpparsec {
     // & "and" operator joins a parse and multiple parses
     template<typename T, typename... Ts, typename Input>
     Parser<std::tuple<T, Ts...>, Input> operator&(const Parser<T, Input>& left, const Parser<std::tuple<Ts...>, Input>& right) {
-        return CPPARSEC_MAKE(Parser<std::tuple<T, Ts...>, Input>) {
+        return CPPARSEC_MAKE_NODE(detail::sequence_node(-1, left, right), Parser<std::tuple<T, Ts...>, Input>) {
             CPPARSEC_SAVE(a, left);
             CPPARSEC_SAVE(bs, right);
 
@@ -944,7 +1837,7 @@ namespace cpparsec {
     // & "and" operator joins multiple parses and a parse 
     template<typename T, typename... Ts, typename Input>
     Parser<std::tuple<T, Ts...>, Input> operator&(const Parser<std::tuple<Ts...>, Input>& left, const Parser<T, Input>& right) {
-        return CPPARSEC_MAKE(Parser<std::tuple<T, Ts...>, Input>) {
+        return CPPARSEC_MAKE_NODE(detail::sequence_node(-1, left, right), Parser<std::tuple<T, Ts...>, Input>) {
             CPPARSEC_SAVE(as, left);
             CPPARSEC_SAVE(b, right);
 
@@ -955,7 +1848,7 @@ namespace cpparsec {
     // & "and" operator joins multiple parses and multiple parses
     template<typename... Ts, typename... Us, typename Input>
     Parser<std::tuple<Ts..., Us...>, Input> operator&(const Parser<std::tuple<Ts...>, Input>& left, const Parser<std::tuple<Us...>, Input>& right) {
-        return CPPARSEC_MAKE(Parser<std::tuple<Ts..., Us...>, Input>) {
+        return CPPARSEC_MAKE_NODE(detail::sequence_node(-1, left, right), Parser<std::tuple<Ts..., Us...>, Input>) {
             CPPARSEC_SAVE(as, left);
             CPPARSEC_SAVE(bs, right);
 
@@ -968,8 +1861,8 @@ namespace cpparsec {
     template <typename T, typename Input>
     Parser<T, Input> operator^(Parser<T, Input>&& p, std::string&& msg) {
         //return p;
-        return CPPARSEC_MAKE(Parser<T, Input>) {
-            ParseResult<T> result = p.parse(input);
+        return CPPARSEC_MAKE_NODE(detail::label_node(msg, p), Parser<T, Input>) {
+            auto result = p.parse(input);
             if (!result) {
                 ParseError err = result.error();
                 err.add_error({ msg });
@@ -983,8 +1876,8 @@ namespace cpparsec {
     // Designed for debugging, poor performance
     template <typename T, typename Input>
     Parser<T, Input> operator%(Parser<T, Input> p, std::string&& msg) {
-        return CPPARSEC_MAKE(Parser<T, Input>) {
-            ParseResult<T> result = p.parse(input);
+        return CPPARSEC_MAKE_NODE(detail::label_node(msg, p), Parser<T, Input>) {
+            auto result = p.parse(input);
             if (!result.has_value()) {
                 CPPARSEC_FAIL(ParseError({ msg }));
             }
@@ -995,18 +1888,18 @@ namespace cpparsec {
 };
 
 // needs to be outside namespace to be seen by fmt
-template <>
-struct std::formatter<typename cpparsec::ParseError<>::ErrorContent> {
+template <cpparsec::ErrorAtom T>
+struct std::formatter<cpparsec::ParseErrorContent<T>> {
     constexpr auto parse(std::format_parse_context& ctx) {
         return ctx.end();
     }
 
-    template <std::formattable<char> T = char>
-    auto format(const typename cpparsec::ParseError<T>::ErrorContent& error, std::format_context& ctx) const {
+    auto format(const cpparsec::ParseErrorContent<T>& error, std::format_context& ctx) const {
         return std::visit([&ctx](auto&& err) {
             using V = std::decay_t<decltype(err)>;
             if constexpr (std::is_same_v<V, std::pair<T, T>>) {
-                return std::format_to(ctx.out(), "Expected '{}', found '{}'", err.first, err.second);
+                return std::format_to(ctx.out(), "Expected '{}', found '{}'",
+                    cpparsec::detail::atom_to_string(err.first), cpparsec::detail::atom_to_string(err.second));
             }
             else if constexpr (std::is_same_v<V, std::pair<std::string, std::string>>) {
                 return std::format_to(ctx.out(), "Expected \"{}\", found \"{}\"", err.first, err.second);
@@ -1021,4 +1914,17 @@ struct std::formatter<typename cpparsec::ParseError<>::ErrorContent> {
     }
 };
 
+template <typename Atom>
+struct std::formatter<cpparsec::GrammarNode<Atom>> {
+    constexpr auto parse(std::format_parse_context& ctx) {
+        return ctx.begin();
+    }
+
+    auto format(const cpparsec::GrammarNode<Atom>& node, std::format_context& ctx) const {
+        std::string out;
+        cpparsec::detail::format_grammar(out, node);
+        return std::format_to(ctx.out(), "{}", out);
+    }
+};
+
 #endif /* CPPARSEC_CORE_H */
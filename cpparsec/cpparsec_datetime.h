@@ -0,0 +1,200 @@
+#ifndef CPPARSEC_DATETIME_H
+#define CPPARSEC_DATETIME_H
+
+#include <chrono>
+#include "cpparsec.h"
+
+namespace cpparsec {
+
+    // ============================ TIMESTAMP PARSERS =============================
+
+    // A UTC point in time with nanosecond resolution, roughly the years 1678 to 2261
+    using Timestamp = std::chrono::sys_time<std::chrono::nanoseconds>;
+
+    // Timestamp parsers decode the fixed "YYYY-MM-DDTHH:MM:SS" layout with a SWAR kernel,
+    // see detail::date_time_fields, and never allocate on success
+    // A misplaced digit or separator fails without consuming, an impossible date or time
+    // (e.g. "2023-02-29") or one outside the Timestamp range consumes it and fails
+    // A leap second ":60" is accepted and counts as the first second of the next minute
+
+    // Parses an RFC 3339 date-time, e.g. "1985-04-12T23:20:50.52Z" or "1996-12-19T16:39:57-08:00"
+    // The 'T' and 'Z' may be lowercase, an offset is required
+    template <typename Input = std::string_view>
+    Parser<Timestamp, Input> rfc3339();
+
+    // Parses an ISO 8601 extended format date and time, a superset of rfc3339()
+    // Also accepts ' ' for 'T', ',' as the decimal sign, offsets "+HH" and "+HHMM",
+    // and no offset at all, which is read as UTC
+    template <typename Input = std::string_view>
+    Parser<Timestamp, Input> iso8601_timestamp();
+
+    // ============================================================================
+    //
+    // ========================= TEMPLATE IMPLEMENTATIONS =========================
+    //
+    // ============================================================================
+
+    namespace detail {
+        // A timestamp at the start of the input
+        struct TimestampScan {
+            enum Status { ok, malformed, invalid, out_of_range };
+
+            Status status;
+            Timestamp time;
+            size_t length; // bytes of the timestamp, or the offset of the bad byte if malformed
+        };
+
+        // Scans a timestamp, data must have 32 readable bytes and agree with view where they overlap
+        inline TimestampScan scan_timestamp(std::string_view view, const char* data, bool iso8601) {
+            using Scan = TimestampScan;
+            constexpr size_t fields_length = 19;
+
+            std::optional<DateTimeFields> fields = date_time_fields(data);
+            const char separator = data[10];
+            bool separator_ok = separator == 'T' || separator == 't' || (iso8601 && separator == ' ');
+
+            if (!fields || !separator_ok || view.size() < fields_length) {
+                // find the first bad byte for the error message
+                constexpr std::string_view layout = "0000-00-00T00:00:00";
+                size_t i = 0;
+                while (i < view.size() && i < fields_length
+                    && (layout[i] == '0' ? view[i] >= '0' && view[i] <= '9' : i == 10 ? separator_ok : view[i] == layout[i])) {
+                    i++;
+                }
+                return Scan{ Scan::malformed, Timestamp(), i };
+            }
+
+            size_t i = fields_length;
+
+            // fractional seconds, digits past nanoseconds are consumed and ignored
+            int64_t fraction = 0;
+            if (data[i] == '.' || (iso8601 && data[i] == ',')) {
+                uint64_t chunk = load_le64(data + i + 1);
+                size_t digits = leading_digit_count(chunk);
+                if (digits == 0) {
+                    return Scan{ Scan::malformed, Timestamp(), i + 1 };
+                }
+
+                // a shorter run keeps its first digit in the low byte and is refilled with trailing '0's
+                if (digits < 8) {
+                    uint64_t kept = (uint64_t(1) << (8 * digits)) - 1;
+                    chunk = (chunk & kept) | (0x3030303030303030 & ~kept);
+                }
+                fraction = static_cast<int64_t>(parse_eight_digits(chunk)) * 10;
+                i += 1 + digits;
+
+                if (digits == 8) {
+                    if (i < view.size() && view[i] >= '0' && view[i] <= '9') {
+                        fraction += view[i] - '0';
+                    }
+                    while (i < view.size() && view[i] >= '0' && view[i] <= '9') {
+                        i++;
+                    }
+                }
+            }
+
+            // UTC offset in minutes, added to UTC to get the local time
+            int offset = 0;
+            if (i < view.size() && (view[i] == 'Z' || view[i] == 'z')) {
+                i++;
+            }
+            else if (i < view.size() && (view[i] == '+' || view[i] == '-')) {
+                auto digit_pair = [&](size_t at) {
+                    return at + 1 < view.size() && view[at] >= '0' && view[at] <= '9' && view[at + 1] >= '0' && view[at + 1] <= '9';
+                };
+                const int sign = view[i] == '-' ? -1 : 1;
+                const size_t start = i;
+
+                if (!digit_pair(start + 1)) {
+                    return Scan{ Scan::malformed, Timestamp(), start + 1 };
+                }
+                int hours = (view[start + 1] - '0') * 10 + (view[start + 2] - '0');
+                int minutes = 0;
+                i = start + 3;
+
+                if (i < view.size() && view[i] == ':') {
+                    if (!digit_pair(i + 1)) {
+                        return Scan{ Scan::malformed, Timestamp(), i + 1 };
+                    }
+                    minutes = (view[i + 1] - '0') * 10 + (view[i + 2] - '0');
+                    i += 3;
+                }
+                else if (iso8601 && digit_pair(i)) {
+                    minutes = (view[i] - '0') * 10 + (view[i + 1] - '0');
+                    i += 2;
+                }
+                else if (!iso8601) {
+                    return Scan{ Scan::malformed, Timestamp(), i };
+                }
+
+                if (hours > 23 || minutes > 59) {
+                    return Scan{ Scan::invalid, Timestamp(), i };
+                }
+                offset = sign * (hours * 60 + minutes);
+            }
+            else if (!iso8601) {
+                return Scan{ Scan::malformed, Timestamp(), i };
+            }
+
+            using namespace std::chrono;
+            year_month_day date{ year(static_cast<int>(fields->year)), month(fields->month), day(fields->day) };
+            if (!date.ok() || fields->hour > 23 || fields->minute > 59 || fields->second > 60) {
+                return Scan{ Scan::invalid, Timestamp(), i };
+            }
+
+            int64_t seconds = sys_days(date).time_since_epoch().count() * int64_t(86400)
+                + fields->hour * 3600 + fields->minute * 60 + fields->second - offset * 60;
+
+            // whole seconds strictly inside the range, so adding the fraction can't overflow
+            constexpr int64_t second_limit = std::numeric_limits<int64_t>::max() / 1000000000;
+            if (seconds >= second_limit || seconds <= -second_limit) {
+                return Scan{ Scan::out_of_range, Timestamp(), i };
+            }
+
+            return Scan{ Scan::ok, Timestamp(nanoseconds(seconds * 1000000000 + fraction)), i };
+        }
+
+        // Shared by rfc3339 and iso8601_timestamp
+        template <typename Input>
+        Parser<Timestamp, Input> timestamp(bool iso8601, std::string&& name) {
+            return CPPARSEC_MAKE(Parser<Timestamp, Input>) {
+                // 19 field bytes, a '.' and 8 fraction digits must be loadable
+                constexpr size_t readable_bytes = 32;
+                std::string_view view(input.data(), input.size());
+
+                // short input is copied to a zeroed buffer, padded input long enough never is
+                const char* data = view.data();
+                char buffer[readable_bytes] = {};
+                if constexpr (input_padding<Input>() < readable_bytes) {
+                    if (view.size() < readable_bytes - input_padding<Input>()) {
+                        std::memcpy(buffer, view.data(), view.size());
+                        data = buffer;
+                    }
+                }
+
+                TimestampScan scan = scan_timestamp(view, data, iso8601);
+                if (scan.status == scan.malformed) {
+                    CPPARSEC_FAIL(ParseError(name, scan.length < view.size() ? std::string(1, view[scan.length]) : "end of input"));
+                }
+
+                input.remove_prefix(scan.length);
+                CPPARSEC_FAIL_IF(scan.status == scan.invalid, ParseError("valid date and time", std::string(view.substr(0, scan.length))));
+                CPPARSEC_FAIL_IF(scan.status == scan.out_of_range, ParseError("timestamp in range", std::string(view.substr(0, scan.length))));
+
+                return scan.time;
+            };
+        }
+    }
+
+    template <typename Input>
+    Parser<Timestamp, Input> rfc3339() {
+        return detail::timestamp<Input>(false, "RFC 3339 timestamp");
+    }
+
+    template <typename Input>
+    Parser<Timestamp, Input> iso8601_timestamp() {
+        return detail::timestamp<Input>(true, "ISO 8601 timestamp");
+    }
+};
+
+#endif /* CPPARSEC_DATETIME_H */
@@ -0,0 +1,221 @@
+#ifndef CPPARSEC_ENCODING_H
+#define CPPARSEC_ENCODING_H
+
+#include "cpparsec.h"
+
+namespace cpparsec {
+
+    // =========================== DECODING PARSERS ===========================
+
+    // Decoding parsers validate and decode in one pass, appending to a caller buffer
+    // and returning how many bytes were appended, or returning a new buffer
+    // Buffer capacity is reused between parses, std::pmr containers place it in an arena
+    // Invalid encodings fail without consuming, reporting the byte offset of the bad byte
+
+    enum class Base64Alphabet {
+        standard, // RFC 4648 section 4, '+' and '/'
+        url,      // RFC 4648 section 5, '-' and '_'
+    };
+
+    // Decodes the longest run of base64 digits, 16 at a time with SIMD
+    // '=' padding is optional, but when present must complete the last quantum
+    template <typename Input = std::string_view, typename Allocator>
+    Parser<size_t, Input> base64_decode(Base64Alphabet alphabet, std::vector<uint8_t, Allocator>& out);
+
+    // Decodes the longest run of base64 digits, see base64_decode above
+    template <typename Input = std::string_view>
+    Parser<std::vector<uint8_t>, Input> base64_decode(Base64Alphabet alphabet = Base64Alphabet::standard);
+
+    // Decodes %XX escapes up to the first of terminators or the end of input
+    // Runs without escapes are found with SIMD and appended in one copy, and with
+    // plus_as_space '+' decodes to ' ' as in application/x-www-form-urlencoded
+    template <typename Input = std::string_view, typename Traits, typename Allocator>
+    Parser<size_t, Input> percent_decode(const std::string& terminators, std::basic_string<char, Traits, Allocator>& out, bool plus_as_space = false);
+
+    // Decodes %XX escapes up to the first of terminators, see percent_decode above
+    template <typename Input = std::string_view>
+    Parser<std::string, Input> percent_decode(const std::string& terminators = "", bool plus_as_space = false);
+
+    // ========================================================================
+    //
+    // ======================= TEMPLATE IMPLEMENTATIONS =======================
+    //
+    // ========================================================================
+
+    namespace detail {
+        // Error for an invalid encoding at byte offset of view
+        inline ParseError<> invalid_encoding(const std::string& expected, std::string_view view, size_t offset) {
+            if (offset >= view.size()) {
+                return ParseError(expected, std::format("end of input at byte offset {}", offset));
+            }
+
+            unsigned byte = static_cast<unsigned char>(view[offset]);
+            return ParseError(expected, std::format("byte 0x{:02X} at byte offset {}", byte, offset));
+        }
+
+        // Decodes a base64 run onto the end of out
+        // Returns the bytes consumed, or the offset of the first invalid byte
+        template <typename Allocator>
+        std::expected<size_t, size_t> scan_base64(std::string_view view, bool url, std::vector<uint8_t, Allocator>& out) {
+            // out grows a block at a time, so a short run in a long input doesn't reserve the whole input
+            constexpr size_t block_digits = 4096;
+            const size_t old_size = out.size();
+            size_t i = 0;
+
+            while (true) {
+                size_t digits = std::min(block_digits, view.size() - i) / 4 * 4;
+                size_t size = out.size();
+                out.resize(size + digits / 4 * 3);
+
+                size_t decoded = base64_decode_quanta(view.substr(i, digits), url, out.data() + size);
+                out.resize(size + decoded / 4 * 3);
+                i += decoded;
+
+                if (decoded < digits || digits == 0) {
+                    break;
+                }
+            }
+
+            // at most 3 digits are left, then optional padding
+            const std::array<uint8_t, 256>& table = url ? base64_url_table : base64_table;
+            size_t digits = 0;
+            uint32_t bits = 0;
+            while (digits < 3 && i + digits < view.size() && table[static_cast<unsigned char>(view[i + digits])] != 0xFF) {
+                bits = (bits << 6) | table[static_cast<unsigned char>(view[i + digits])];
+                digits++;
+            }
+
+            if (digits == 1) {
+                out.resize(old_size);
+                return std::unexpected(i + 1);
+            }
+            if (digits == 2) {
+                out.push_back(static_cast<uint8_t>(bits >> 4));
+            }
+            if (digits == 3) {
+                out.push_back(static_cast<uint8_t>(bits >> 10));
+                out.push_back(static_cast<uint8_t>(bits >> 2));
+            }
+            i += digits;
+
+            if (digits > 0 && i < view.size() && view[i] == '=') {
+                for (size_t pad = digits; pad < 4; pad++, i++) {
+                    if (i >= view.size() || view[i] != '=') {
+                        out.resize(old_size);
+                        return std::unexpected(i);
+                    }
+                }
+            }
+
+            return i;
+        }
+
+        // Decodes a percent encoded run onto the end of out
+        // stops holds the terminators, '%' and with plus_as_space '+'
+        // Returns the bytes consumed, or the offset of the first invalid byte
+        template <typename String>
+        std::expected<size_t, size_t> scan_percent(std::string_view view, const ByteClass& stops, bool plus_as_space, String& out) {
+            const size_t old_size = out.size();
+            size_t i = 0;
+
+            while (true) {
+                size_t run = stops.find(view.substr(i));
+                out.append(view.data() + i, run);
+                i += run;
+
+                if (i == view.size()) {
+                    return i;
+                }
+                if (view[i] == '%') {
+                    uint8_t high = i + 1 < view.size() ? hex_digit_value(view[i + 1]) : 0xFF;
+                    uint8_t low = i + 2 < view.size() ? hex_digit_value(view[i + 2]) : 0xFF;
+                    if ((high | low) == 0xFF) {
+                        out.resize(old_size);
+                        return std::unexpected(high == 0xFF ? i + 1 : i + 2);
+                    }
+                    out.push_back(static_cast<char>((high << 4) | low));
+                    i += 3;
+                }
+                else if (view[i] == '+' && plus_as_space) {
+                    out.push_back(' ');
+                    i++;
+                }
+                else {
+                    return i;
+                }
+            }
+        }
+
+        inline ByteClass percent_stops(const std::string& terminators, bool plus_as_space) {
+            return ByteClass(terminators + (plus_as_space ? "%+" : "%"));
+        }
+    }
+
+    template <typename Input, typename Allocator>
+    Parser<size_t, Input> base64_decode(Base64Alphabet alphabet, std::vector<uint8_t, Allocator>& out) {
+        const bool url = alphabet == Base64Alphabet::url;
+        std::vector<uint8_t, Allocator>* bytes = &out;
+
+        return CPPARSEC_MAKE(Parser<size_t, Input>) {
+            std::string_view view(input.data(), input.size());
+            const size_t old_size = bytes->size();
+
+            std::expected<size_t, size_t> scanned = detail::scan_base64(view, url, *bytes);
+            CPPARSEC_FAIL_IF(!scanned, detail::invalid_encoding(url ? "<base64url digit>" : "<base64 digit>", view, scanned.error()));
+
+            input.remove_prefix(*scanned);
+            return bytes->size() - old_size;
+        };
+    }
+
+    template <typename Input>
+    Parser<std::vector<uint8_t>, Input> base64_decode(Base64Alphabet alphabet) {
+        const bool url = alphabet == Base64Alphabet::url;
+
+        return CPPARSEC_MAKE(Parser<std::vector<uint8_t>, Input>) {
+            std::string_view view(input.data(), input.size());
+            std::vector<uint8_t> bytes;
+
+            std::expected<size_t, size_t> scanned = detail::scan_base64(view, url, bytes);
+            CPPARSEC_FAIL_IF(!scanned, detail::invalid_encoding(url ? "<base64url digit>" : "<base64 digit>", view, scanned.error()));
+
+            input.remove_prefix(*scanned);
+            return bytes;
+        };
+    }
+
+    template <typename Input, typename Traits, typename Allocator>
+    Parser<size_t, Input> percent_decode(const std::string& terminators, std::basic_string<char, Traits, Allocator>& out, bool plus_as_space) {
+        detail::ByteClass stops = detail::percent_stops(terminators, plus_as_space);
+        std::basic_string<char, Traits, Allocator>* text = &out;
+
+        return CPPARSEC_MAKE(Parser<size_t, Input>) {
+            std::string_view view(input.data(), input.size());
+            const size_t old_size = text->size();
+
+            std::expected<size_t, size_t> scanned = detail::scan_percent(view, stops, plus_as_space, *text);
+            CPPARSEC_FAIL_IF(!scanned, detail::invalid_encoding("<hex digit>", view, scanned.error()));
+
+            input.remove_prefix(*scanned);
+            return text->size() - old_size;
+        };
+    }
+
+    template <typename Input>
+    Parser<std::string, Input> percent_decode(const std::string& terminators, bool plus_as_space) {
+        detail::ByteClass stops = detail::percent_stops(terminators, plus_as_space);
+
+        return CPPARSEC_MAKE(Parser<std::string, Input>) {
+            std::string_view view(input.data(), input.size());
+            std::string text;
+
+            std::expected<size_t, size_t> scanned = detail::scan_percent(view, stops, plus_as_space, text);
+            CPPARSEC_FAIL_IF(!scanned, detail::invalid_encoding("<hex digit>", view, scanned.error()));
+
+            input.remove_prefix(*scanned);
+            return text;
+        };
+    }
+};
+
+#endif /* CPPARSEC_ENCODING_H */
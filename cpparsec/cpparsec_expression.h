@@ -0,0 +1,240 @@
+#ifndef CPPARSEC_EXPRESSION_H
+#define CPPARSEC_EXPRESSION_H
+
+#include <cctype>
+#include "cpparsec.h"
+
+namespace cpparsec {
+
+    // ========================= OPERATOR PRECEDENCE PARSING ========================
+
+    // expression_parser(operand, table) parses operands joined by the prefix, infix and postfix
+    // operators of table, applying them by precedence, higher binds tighter
+    //
+    //     OperatorTable<int> table;
+    //     table.infix("+", 1, Associativity::left, std::plus{})
+    //          .infix("*", 2, Associativity::left, std::multiplies{})
+    //          .prefix("-", 3, std::negate{})
+    //          .postfix("!", 4, factorial);
+    //     Parser<int> expr = expression_parser(int_() << spaces(), table);
+    //
+    // A prefix operator applies to its operand with the operators after it that bind tighter
+    // Each operand is parsed by one step of a Pratt loop however many precedence levels there are,
+    // and operators are found by the longest symbol at the input in a keyword set
+    // Operators skip the ASCII whitespace after them, operands should skip the whitespace after them
+    // Symbols ending in a letter, digit or _ like "and" don't match the start of a longer word
+
+    enum class Associativity {
+        left,   // a - b - c parses as (a - b) - c
+        right,  // a ^ b ^ c parses as a ^ (b ^ c)
+        none,   // a < b < c fails
+    };
+
+    // Operators of an expression_parser, with precedences from 0
+    // A symbol is at most one prefix operator and one infix or postfix operator, defining it again replaces it
+    template <typename T>
+    class OperatorTable {
+    public:
+        struct Operator {
+            std::string symbol;
+            int precedence = 0;
+            Associativity associativity = Associativity::left;
+            std::function<T(T)> unary;       // prefix and postfix
+            std::function<T(T, T)> binary;   // infix
+        };
+
+        OperatorTable& prefix(std::string symbol, int precedence, std::function<T(T)> apply);
+        OperatorTable& infix(std::string symbol, int precedence, Associativity associativity, std::function<T(T, T)> apply);
+        OperatorTable& postfix(std::string symbol, int precedence, std::function<T(T)> apply);
+
+        // Operators before an operand
+        const std::vector<Operator>& prefix_operators() const { return prefixes; }
+
+        // Infix and postfix operators, after an operand
+        const std::vector<Operator>& trailing_operators() const { return trailing; }
+
+    private:
+        std::vector<Operator> prefixes;
+        std::vector<Operator> trailing;
+
+        static void define(std::vector<Operator>& operators, Operator op);
+    };
+
+    // Parses operands joined by the operators of table, see OperatorTable
+    template <typename T, typename Input>
+        requires (sizeof(input_atom_t<Input>) == 1)
+    Parser<T, Input> expression_parser(const Parser<T, Input>& operand, const OperatorTable<T>& table);
+
+    // ============================================================================
+    //
+    // ========================= TEMPLATE IMPLEMENTATIONS =========================
+    //
+    // ============================================================================
+
+    // ============================= Operator Tables ==============================
+
+    template <typename T>
+    void OperatorTable<T>::define(std::vector<Operator>& operators, Operator op) {
+        for (Operator& defined : operators) {
+            if (defined.symbol == op.symbol) {
+                defined = std::move(op);
+                return;
+            }
+        }
+
+        operators.push_back(std::move(op));
+    }
+
+    template <typename T>
+    OperatorTable<T>& OperatorTable<T>::prefix(std::string symbol, int precedence, std::function<T(T)> apply) {
+        define(prefixes, { std::move(symbol), precedence, Associativity::right, std::move(apply), {} });
+        return *this;
+    }
+
+    template <typename T>
+    OperatorTable<T>& OperatorTable<T>::infix(std::string symbol, int precedence, Associativity associativity, std::function<T(T, T)> apply) {
+        define(trailing, { std::move(symbol), precedence, associativity, {}, std::move(apply) });
+        return *this;
+    }
+
+    template <typename T>
+    OperatorTable<T>& OperatorTable<T>::postfix(std::string symbol, int precedence, std::function<T(T)> apply) {
+        define(trailing, { std::move(symbol), precedence, Associativity::left, std::move(apply), {} });
+        return *this;
+    }
+
+    // ============================ Expression Parsers ============================
+
+    namespace detail {
+        // Symbols of a list of operators
+        template <typename T>
+        std::vector<std::string> operator_symbols(const std::vector<typename OperatorTable<T>::Operator>& operators) {
+            std::vector<std::string> symbols;
+            for (const auto& op : operators) {
+                symbols.push_back(op.symbol);
+            }
+            return symbols;
+        }
+
+        // Operators of an expression parser with their keyword sets, shared by its copies
+        template <typename T>
+        struct ExpressionOperators {
+            using Operator = typename OperatorTable<T>::Operator;
+
+            OperatorTable<T> table;
+            KeywordSet prefix_symbols;
+            KeywordSet trailing_symbols;
+
+            explicit ExpressionOperators(const OperatorTable<T>& table) :
+                table(table),
+                prefix_symbols(operator_symbols<T>(table.prefix_operators()), false),
+                trailing_symbols(operator_symbols<T>(table.trailing_operators()), false)
+            { }
+
+            // The operator of the longest symbol at the start of input, or nullptr, setting length to its symbol's
+            // readable is the number of bytes that may be loaded from input.data()
+            const Operator* find(const std::vector<Operator>& operators, const KeywordSet& symbols, std::string_view input, size_t readable, size_t& length) const {
+                size_t i = symbols.find(input, readable);
+                if (i == KeywordSet::npos) {
+                    return nullptr;
+                }
+
+                const std::string& symbol = operators[i].symbol;
+                auto word = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; };
+                if (symbol.empty() || (word(symbol.back()) && symbol.size() < input.size() && word(input[symbol.size()]))) {
+                    return nullptr;
+                }
+
+                length = symbol.size();
+                while (length < input.size() && std::isspace(static_cast<unsigned char>(input[length]))) {
+                    length++;
+                }
+                return &operators[i];
+            }
+        };
+
+        // Parses an operand, with the operators after it binding at least min_power
+        // An operator of precedence p binds 2p on its left, and 2p + 1 on its right when left associative
+        template <typename T, typename Input>
+        ParseResult<T, input_atom_t<Input>> parse_expression(const ExpressionOperators<T>& ops, const Parser<T, Input>& operand, Input& input, int min_power) {
+            using Operator = typename ExpressionOperators<T>::Operator;
+            const OperatorTable<T>& table = ops.table;
+            size_t length = 0;
+
+            ParseResult<T, input_atom_t<Input>> lhs = [&] {
+                std::string_view view(input.data(), input.size());
+                const Operator* op = ops.find(table.prefix_operators(), ops.prefix_symbols, view, view.size() + input_padding<Input>(), length);
+                if (op == nullptr) {
+                    return operand.parse(input);
+                }
+
+                input.remove_prefix(length);
+                ParseResult<T, input_atom_t<Input>> arg = parse_expression(ops, operand, input, 2 * op->precedence + 1);
+                if (arg) {
+                    *arg = op->unary(std::move(*arg));
+                }
+                return arg;
+            }();
+
+            // a non-associative operator of this precedence was applied last
+            int none_precedence = -1;
+
+            while (lhs) {
+                std::string_view view(input.data(), input.size());
+                const Operator* op = ops.find(table.trailing_operators(), ops.trailing_symbols, view, view.size() + input_padding<Input>(), length);
+                if (op == nullptr || 2 * op->precedence + (op->associativity == Associativity::right) < min_power) {
+                    break;
+                }
+                CPPARSEC_FAIL_IF(op->associativity == Associativity::none && op->precedence == none_precedence,
+                    ParseError("operator of another precedence", "non-associative \"" + op->symbol + "\""));
+
+                input.remove_prefix(length);
+                if (!op->binary) {
+                    *lhs = op->unary(std::move(*lhs));
+                    continue;
+                }
+
+                auto rhs = parse_expression(ops, operand, input, 2 * op->precedence + (op->associativity != Associativity::right));
+                if (!rhs) {
+                    return rhs;
+                }
+
+                *lhs = op->binary(std::move(*lhs), std::move(*rhs));
+                none_precedence = op->associativity == Associativity::none ? op->precedence : -1;
+            }
+
+            return lhs;
+        }
+
+        // Grammar IR node of an expression parser, the operand with the operators as label
+        // atoms are the first atoms of the prefix operators
+        template <typename T, typename Input>
+        GrammarNode<input_atom_t<Input>> expression_node(const Parser<T, Input>& operand, const OperatorTable<T>& table) {
+            GrammarNode<input_atom_t<Input>> node = grammar_node(GrammarKind::expression, operand);
+            for (const auto* operators : { &table.prefix_operators(), &table.trailing_operators() }) {
+                for (const auto& op : *operators) {
+                    node.label += node.label.empty() ? op.symbol : " " + op.symbol;
+                }
+            }
+            for (const auto& op : table.prefix_operators()) {
+                if (!op.symbol.empty()) {
+                    node.atoms.push_back(static_cast<input_atom_t<Input>>(op.symbol[0]));
+                }
+            }
+            return node;
+        }
+    };
+
+    // Parses operands joined by the operators of table, see OperatorTable
+    template <typename T, typename Input>
+        requires (sizeof(input_atom_t<Input>) == 1)
+    Parser<T, Input> expression_parser(const Parser<T, Input>& operand, const OperatorTable<T>& table) {
+        auto ops = std::make_shared<const detail::ExpressionOperators<T>>(table);
+
+        return CPPARSEC_MAKE_NODE(detail::expression_node(operand, table), Parser<T, Input>) {
+            return detail::parse_expression(*ops, operand, input, 0);
+        };
+    }
+};
+
+#endif /* CPPARSEC_EXPRESSION_H */
@@ -0,0 +1,437 @@
+#ifndef CPPARSEC_MEMO_H
+#define CPPARSEC_MEMO_H
+
+#include <bit>
+#include "cpparsec.h"
+
+namespace cpparsec {
+
+    // ============================= PACKRAT PARSING ==============================
+
+    // memo(p) records the result of p and the input it consumed at each position, so a grammar
+    // backtracking through try_ parses each memoized rule at most once per position
+    // Records live in a memo table for one packrat(p) parse, a memo parsed outside of one opens a
+    // table for its own parse. Tables belong to a thread, parsers stay shareable between threads
+    //
+    //     auto name = memo(many1(letter()));
+    //     auto statement = try_(name << char_('(')) | try_(name << char_('=')) | name;
+    //     ParseResult<std::string> result = packrat(statement).parse(input);
+    //
+    // Records are found by the address of the input position, so a parse must not reuse one
+    // position with different input before it, and p must not depend on state outside the input
+
+    struct PackratOptions {
+        // records more than window atoms behind the furthest position recorded are dropped, which
+        // bounds the table on long inputs, a backtrack further than that parses again, 0 keeps all
+        size_t window = 0;
+
+        // memoizes every rule(name, p) as if it were memo(rule(name, p))
+        bool memoize_rules = false;
+    };
+
+    // Parses p, recording its result at each position for the current packrat parse
+    template <typename T, typename Input>
+    Parser<T, Input> memo(const Parser<T, Input>& p);
+
+    // Named nonterminal p, memoized when the current packrat parse memoizes rules
+    template <typename T, typename Input>
+    Parser<T, Input> rule(const std::string& name, const Parser<T, Input>& p);
+
+    // Parses p with a new memo table, see PackratOptions
+    template <typename T, typename Input>
+    Parser<T, Input> packrat(const Parser<T, Input>& p, PackratOptions options = {});
+
+    // ========================== LEFT RECURSIVE RULES ============================
+
+    // A named nonterminal that can refer to itself, directly or through other rules, also as its
+    // leftmost parse, e.g. for left associative operators and postfix chains
+    //
+    //     Rule<int> difference("difference");
+    //     difference = (difference << char_('-') & number).transform(subtract) | number;
+    //
+    // A rule reentered at the position it started at is left recursive there. The reentry parses as
+    // a seed, failing at first, and the body is parsed again with each longer result as the seed
+    // until it stops growing, returning the longest. Rules that are not reentered parse their body once
+    // A Rule is a Parser referring to it, so it must outlive the parsers using it, and be defined
+    // by assigning its body before they parse. Packrat parses memoizing rules memoize it as rule does
+    template <typename T, typename Input = std::string_view>
+    class Rule : public Parser<T, Input> {
+    public:
+        using Result = typename Parser<T, Input>::Result;
+
+        explicit Rule(std::string name);
+
+        Rule(Rule&&) = default;
+        Rule(const Rule&) = delete;
+        Rule& operator=(const Rule&) = delete;
+
+        // Defines the rule as body
+        Rule& operator=(const Parser<T, Input>& body);
+
+    private:
+        struct State {
+            std::string name;
+            std::optional<Parser<T, Input>> body;
+        };
+
+        // A rule growing a seed at a position
+        struct Seed {
+            const State* rule = nullptr;
+            const void* position = nullptr;
+            size_t remaining = 0;
+            size_t depth = 0;                   // growths on this thread including this one, see SeedGrowth
+            bool used = false;                  // reentered, so left recursive here
+            std::optional<Result> result;       // longest result so far, nullopt fails
+            size_t consumed = 0;
+        };
+
+        inline static thread_local std::vector<Seed> seeds;
+
+        std::unique_ptr<State> state;
+
+        explicit Rule(std::unique_ptr<State> state);
+
+        static Parser<T, Input> reference(const State* state);
+        static Result grow(const State& state, Input& input);
+    };
+
+    // ============================================================================
+    //
+    // ========================= TEMPLATE IMPLEMENTATIONS =========================
+    //
+    // ============================================================================
+
+    namespace detail {
+        // Identity of a memoized parser, shared by its copies
+        struct MemoIdentity {
+            char unused = 0;
+        };
+
+        // Results a memoized parser recorded, slots of dropped records are reused
+        struct MemoResultsBase {
+            virtual ~MemoResultsBase() = default;
+            virtual void release(uint32_t slot) = 0;
+        };
+
+        template <typename Result>
+        struct MemoResults final : MemoResultsBase {
+            std::vector<std::optional<Result>> slots;
+            std::vector<uint32_t> free_slots;
+
+            uint32_t add(const Result& result) {
+                if (free_slots.empty()) {
+                    slots.emplace_back(result);
+                    return static_cast<uint32_t>(slots.size() - 1);
+                }
+
+                uint32_t slot = free_slots.back();
+                free_slots.pop_back();
+                slots[slot].emplace(result);
+                return slot;
+            }
+
+            void release(uint32_t slot) override {
+                slots[slot].reset();
+                free_slots.push_back(slot);
+            }
+        };
+
+        // What a memoized parser did at one position
+        struct MemoRecord {
+            const void* rule = nullptr;     // MemoIdentity of the parser, nullptr in an empty bucket
+            const void* position = nullptr; // input.data() before the parse
+            size_t remaining = 0;           // input.size() before the parse
+            size_t consumed = 0;            // input consumed, on success or failure
+            MemoResultsBase* results = nullptr;
+            uint32_t slot = 0;
+        };
+
+        // Records of one packrat parse, an open addressing table with linear probing
+        // Dropping records behind the window happens when the table would grow
+        class MemoTable {
+        public:
+            explicit MemoTable(PackratOptions options) : options(options), buckets(64) { }
+
+            const PackratOptions options;
+
+            // The record of rule at position, nullptr if there is none
+            const MemoRecord* find(const void* rule, const void* position, size_t remaining) const {
+                for (size_t i = bucket(rule, position); ; i = (i + 1) & mask()) {
+                    const MemoRecord& record = buckets[i];
+                    if (record.rule == nullptr) {
+                        return nullptr;
+                    }
+                    if (record.rule == rule && record.position == position && record.remaining == remaining) {
+                        return &record;
+                    }
+                }
+            }
+
+            void insert(const MemoRecord& record) {
+                if ((count + 1) * 4 > buckets.size() * 3) {
+                    rehash();
+                }
+                furthest = std::min(furthest, record.remaining);
+                place(record);
+                count++;
+            }
+
+            // Results recorded by rule, which returns Result
+            template <typename Result>
+            MemoResults<Result>& results(const void* rule) {
+                for (auto& [owner, recorded] : stores) {
+                    if (owner == rule) {
+                        return static_cast<MemoResults<Result>&>(*recorded);
+                    }
+                }
+
+                stores.emplace_back(rule, std::make_unique<MemoResults<Result>>());
+                return static_cast<MemoResults<Result>&>(*stores.back().second);
+            }
+
+        private:
+            std::vector<MemoRecord> buckets; // size is a power of two
+            size_t count = 0;
+            size_t furthest = SIZE_MAX;      // least remaining input of a record
+            std::vector<std::pair<const void*, std::unique_ptr<MemoResultsBase>>> stores;
+
+            size_t mask() const {
+                return buckets.size() - 1;
+            }
+
+            // Fibonacci hashing, the high bits of the product index the table
+            size_t bucket(const void* rule, const void* position) const {
+                uint64_t key = reinterpret_cast<uintptr_t>(position) ^ (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(rule)) << 24);
+                return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> (64 - std::countr_zero(buckets.size())));
+            }
+
+            void place(const MemoRecord& record) {
+                size_t i = bucket(record.rule, record.position);
+                while (buckets[i].rule != nullptr) {
+                    i = (i + 1) & mask();
+                }
+                buckets[i] = record;
+            }
+
+            bool stale(const MemoRecord& record) const {
+                return options.window > 0 && record.remaining - furthest > options.window;
+            }
+
+            // Drops stale records, doubling the table if the rest would still fill half of it
+            void rehash() {
+                std::vector<MemoRecord> old = std::move(buckets);
+                size_t kept = std::ranges::count_if(old, [this](const MemoRecord& record) { return record.rule != nullptr && !stale(record); });
+
+                buckets.assign(kept * 2 > old.size() ? old.size() * 2 : old.size(), MemoRecord{});
+                count = 0;
+                for (const MemoRecord& record : old) {
+                    if (record.rule == nullptr) {
+                        continue;
+                    }
+                    if (stale(record)) {
+                        record.results->release(record.slot);
+                        continue;
+                    }
+                    place(record);
+                    count++;
+                }
+            }
+        };
+
+        // Memo table of the packrat parse running on this thread, nullptr outside of one
+        inline thread_local MemoTable* current_memo_table = nullptr;
+
+        // Left recursive rules growing seeds on this thread, see Rule
+        // A result parsed seeing a seed that is still growing may change, so it isn't recorded
+        struct SeedGrowth {
+            size_t depth = 0;             // growths in progress
+            size_t lowest_hit = SIZE_MAX; // least depth of a seed seen since the innermost memo began
+        };
+
+        inline thread_local SeedGrowth seed_growth;
+
+        // Makes table the memo table of this thread while it lives
+        class MemoScope {
+        public:
+            explicit MemoScope(MemoTable& table) : previous(current_memo_table) {
+                current_memo_table = &table;
+            }
+
+            ~MemoScope() {
+                current_memo_table = previous;
+            }
+
+            MemoScope(const MemoScope&) = delete;
+            MemoScope& operator=(const MemoScope&) = delete;
+
+        private:
+            MemoTable* previous;
+        };
+
+        // Parses p recorded as rule in the current memo table, opening one if there is none
+        template <typename T, typename Input>
+        ParseResult<T, input_atom_t<Input>> parse_memoized(const Parser<T, Input>& p, const void* rule, Input& input) {
+            using Result = ParseResult<T, input_atom_t<Input>>;
+
+            MemoTable* table = current_memo_table;
+            if (table == nullptr) {
+                MemoTable own(PackratOptions{});
+                MemoScope scope(own);
+                return parse_memoized(p, rule, input);
+            }
+
+            if (const MemoRecord* record = table->find(rule, input.data(), input.size())) {
+                input.remove_prefix(record->consumed);
+                return *static_cast<const MemoResults<Result>*>(record->results)->slots[record->slot];
+            }
+
+            const void* position = input.data();
+            const size_t remaining = input.size();
+            const size_t outer_hit = seed_growth.lowest_hit;
+            seed_growth.lowest_hit = SIZE_MAX;
+
+            Result result = p.parse(input);
+
+            const bool seeded = seed_growth.lowest_hit <= seed_growth.depth;
+            seed_growth.lowest_hit = std::min(outer_hit, seed_growth.lowest_hit);
+            if (!seeded) {
+                MemoResults<Result>& results = table->results<Result>(rule);
+                table->insert({ rule, position, remaining, remaining - input.size(), &results, results.add(result) });
+            }
+            return result;
+        }
+
+        // The node of rule(name, p)
+        template <typename T, typename Input>
+        GrammarNode<input_atom_t<Input>> rule_node(const std::string& name, const Parser<T, Input>& p) {
+            GrammarNode<input_atom_t<Input>> node = label_node(name, p);
+            node.kind = GrammarKind::rule;
+            return node;
+        }
+    };
+
+    // Parses p, recording its result at each position for the current packrat parse
+    template <typename T, typename Input>
+    Parser<T, Input> memo(const Parser<T, Input>& p) {
+        auto identity = std::make_shared<const detail::MemoIdentity>();
+
+        return CPPARSEC_MAKE_NODE(detail::grammar_node(GrammarKind::memo, p), Parser<T, Input>) {
+            return detail::parse_memoized(p, identity.get(), input);
+        };
+    }
+
+    // Named nonterminal p, memoized when the current packrat parse memoizes rules
+    template <typename T, typename Input>
+    Parser<T, Input> rule(const std::string& name, const Parser<T, Input>& p) {
+        auto identity = std::make_shared<const detail::MemoIdentity>();
+
+        return CPPARSEC_MAKE_NODE(detail::rule_node(name, p), Parser<T, Input>) {
+            const detail::MemoTable* table = detail::current_memo_table;
+            if (table != nullptr && table->options.memoize_rules) {
+                return detail::parse_memoized(p, identity.get(), input);
+            }
+
+            return p.parse(input);
+        };
+    }
+
+    // Parses p with a new memo table, see PackratOptions
+    template <typename T, typename Input>
+    Parser<T, Input> packrat(const Parser<T, Input>& p, PackratOptions options) {
+        return CPPARSEC_MAKE_NODE(detail::grammar_node(GrammarKind::memo, p), Parser<T, Input>) {
+            detail::MemoTable table(options);
+            detail::MemoScope scope(table);
+
+            return p.parse(input);
+        };
+    }
+
+    // =========================== Left Recursive Rules ===========================
+
+    template <typename T, typename Input>
+    Rule<T, Input>::Rule(std::string name) :
+        Rule(std::make_unique<State>(State{ std::move(name) }))
+    { }
+
+    template <typename T, typename Input>
+    Rule<T, Input>::Rule(std::unique_ptr<State> state) :
+        Parser<T, Input>(reference(state.get())), state(std::move(state))
+    { }
+
+    // Defines the rule as body
+    template <typename T, typename Input>
+    Rule<T, Input>& Rule<T, Input>::operator=(const Parser<T, Input>& body) {
+        state->body = body;
+        return *this;
+    }
+
+    // The parser of a rule, memoized when the packrat parse memoizes rules
+    template <typename T, typename Input>
+    Parser<T, Input> Rule<T, Input>::reference(const State* state) {
+        using Atom = input_atom_t<Input>;
+
+        Parser<T, Input> grown = CPPARSEC_MAKE(Parser<T, Input>) {
+            return grow(*state, input);
+        };
+
+        return CPPARSEC_MAKE_NODE((GrammarNode<Atom>{ .kind = GrammarKind::rule, .label = state->name }), Parser<T, Input>) {
+            const detail::MemoTable* table = detail::current_memo_table;
+            if (table != nullptr && table->options.memoize_rules) {
+                return detail::parse_memoized(grown, state, input);
+            }
+
+            return grown.parse(input);
+        };
+    }
+
+    // Parses the body of a rule, growing a seed where the rule is left recursive
+    template <typename T, typename Input>
+    typename Rule<T, Input>::Result Rule<T, Input>::grow(const State& state, Input& input) {
+        CPPARSEC_FAIL_IF(!state.body, ParseError(state.name, "undefined rule"));
+
+        // reentered where it is growing, the seed stands in for the rule
+        for (size_t i = seeds.size(); i-- > 0; ) {
+            Seed& seed = seeds[i];
+            if (seed.rule == &state && seed.position == input.data() && seed.remaining == input.size()) {
+                seed.used = true;
+                detail::seed_growth.lowest_hit = std::min(detail::seed_growth.lowest_hit, seed.depth);
+                CPPARSEC_FAIL_IF(!seed.result, ParseError(state.name, "left recursion"));
+
+                input.remove_prefix(seed.consumed);
+                return *seed.result;
+            }
+        }
+
+        const Input start = input;
+        const size_t index = seeds.size();
+        seeds.push_back(Seed{ .rule = &state, .position = input.data(), .remaining = input.size(), .depth = ++detail::seed_growth.depth });
+
+        Result grown = state.body->parse(input);
+        while (grown && seeds[index].used) {
+            const size_t consumed = start.size() - input.size();
+            if (seeds[index].result && consumed <= seeds[index].consumed) {
+                break;
+            }
+
+            seeds[index].result = std::move(grown);
+            seeds[index].consumed = consumed;
+            input = start;
+            grown = state.body->parse(input);
+        }
+
+        Seed seed = std::move(seeds[index]);
+        seeds.pop_back();
+        detail::seed_growth.depth--;
+
+        // not left recursive here, or failing before any seed grew
+        if (!seed.result) {
+            return grown;
+        }
+
+        input = start;
+        input.remove_prefix(seed.consumed);
+        return std::move(*seed.result);
+    }
+};
+
+#endif /* CPPARSEC_MEMO_H */
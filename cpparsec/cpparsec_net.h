@@ -0,0 +1,247 @@
+#ifndef CPPARSEC_NET_H
+#define CPPARSEC_NET_H
+
+#include <array>
+#include "cpparsec.h"
+
+namespace cpparsec {
+
+    // ============================ ADDRESS PARSERS =============================
+
+    // Address parsers decode straight into packed binary forms, nothing is allocated
+    // on success. Malformed addresses fail without consuming, reporting the first bad byte
+
+    // An IPv4 or IPv6 network such as "10.0.0.0/8" or "2001:db8::/32"
+    // Host bits past the prefix are kept as written
+    struct Cidr {
+        std::array<uint8_t, 16> address; // network byte order, IPv4 uses the first 4 bytes
+        uint8_t prefix_length;
+        bool is_ipv4;
+
+        bool operator==(const Cidr&) const = default;
+    };
+
+    // Parses a dotted quad IPv4 address, e.g. "192.168.0.1" as 0xC0A80001
+    // Octets are 1 to 3 decimal digits up to 255, leading zeros are rejected as in inet_pton
+    template <typename Input = std::string_view>
+    Parser<uint32_t, Input> ipv4();
+
+    // Parses an IPv6 address in network byte order, e.g. "2001:db8::1"
+    // Accepts one "::" run of zero groups and a dotted quad in the last 32 bits,
+    // as in "::ffff:192.168.0.1", but no zone index
+    template <typename Input = std::string_view>
+    Parser<std::array<uint8_t, 16>, Input> ipv6();
+
+    // Parses an IPv4 or IPv6 address followed by '/' and a prefix length
+    template <typename Input = std::string_view>
+    Parser<Cidr, Input> cidr();
+
+    // ============================================================================
+    //
+    // ========================= TEMPLATE IMPLEMENTATIONS =========================
+    //
+    // ============================================================================
+
+    namespace detail {
+        constexpr bool is_decimal_digit(char c) {
+            return c >= '0' && c <= '9';
+        }
+
+        // Error for a malformed address at offset i of view
+        inline ParseError<> address_error(const std::string& expected, std::string_view view, size_t i) {
+            return ParseError(expected, i < view.size() ? std::string(1, view[i]) : "end of input");
+        }
+
+        // Scans a dotted quad starting at offset i, leaving i past it
+        inline std::expected<uint32_t, ParseError<>> scan_ipv4(std::string_view view, size_t& i) {
+            uint32_t address = 0;
+
+            for (int octet = 0; octet < 4; octet++) {
+                if (octet > 0) {
+                    if (i >= view.size() || view[i] != '.') {
+                        return std::unexpected(address_error("'.'", view, i));
+                    }
+                    i++;
+                }
+                if (i >= view.size() || !is_decimal_digit(view[i])) {
+                    return std::unexpected(address_error("<digit>", view, i));
+                }
+
+                const size_t start = i;
+                unsigned value = 0;
+                while (i < view.size() && i - start < 3 && is_decimal_digit(view[i])) {
+                    value = value * 10 + (view[i] - '0');
+                    i++;
+                }
+
+                const bool too_long = i < view.size() && is_decimal_digit(view[i]);
+                if (too_long || value > 255 || (view[start] == '0' && i - start > 1)) {
+                    return std::unexpected(ParseError("octet in [0, 255]", std::string(view.substr(start, i - start + too_long))));
+                }
+                address = (address << 8) | value;
+            }
+
+            return address;
+        }
+
+        // Scans an IPv6 address starting at offset i, leaving i past it
+        inline std::expected<std::array<uint8_t, 16>, ParseError<>> scan_ipv6(std::string_view view, size_t& i) {
+            std::array<uint16_t, 8> groups{};
+            size_t count = 0;
+            size_t gap = SIZE_MAX; // groups before the "::"
+            size_t gap_offset = 0;
+
+            auto at_hex_digit = [&](size_t at) { return at < view.size() && hex_digit_value(view[at]) != 0xFF; };
+
+            if (view.substr(i, 2) == "::") {
+                gap = 0;
+                gap_offset = i;
+                i += 2;
+            }
+
+            while (count < 8 && (gap != count || at_hex_digit(i))) {
+                size_t digits = 0;
+                unsigned value = 0;
+                while (digits < 4 && at_hex_digit(i + digits)) {
+                    value = (value << 4) | hex_digit_value(view[i + digits]);
+                    digits++;
+                }
+
+                if (digits == 0) {
+                    return std::unexpected(address_error("<hex digit>", view, i));
+                }
+                if (i + digits < view.size() && view[i + digits] == '.') {
+                    // a dotted quad takes the last two groups
+                    if (count > 6) {
+                        return std::unexpected(address_error("':'", view, i + digits));
+                    }
+                    std::expected<uint32_t, ParseError<>> embedded = scan_ipv4(view, i);
+                    if (!embedded) {
+                        return std::unexpected(embedded.error());
+                    }
+                    groups[count++] = static_cast<uint16_t>(*embedded >> 16);
+                    groups[count++] = static_cast<uint16_t>(*embedded);
+                    break;
+                }
+                if (at_hex_digit(i + digits)) {
+                    return std::unexpected(ParseError("group of at most 4 hex digits", std::string(view.substr(i, digits + 1))));
+                }
+
+                groups[count++] = static_cast<uint16_t>(value);
+                i += digits;
+
+                if (count == 8 || i >= view.size() || view[i] != ':') {
+                    break;
+                }
+                if (i + 1 < view.size() && view[i + 1] == ':') {
+                    if (gap != SIZE_MAX) {
+                        return std::unexpected(address_error("<hex digit>", view, i + 1));
+                    }
+                    gap = count;
+                    gap_offset = i;
+                    i += 2;
+                }
+                else {
+                    i++;
+                }
+            }
+
+            if (gap == SIZE_MAX && count < 8) {
+                return std::unexpected(address_error("':'", view, i));
+            }
+            if (gap != SIZE_MAX && count == 8) {
+                // "::" stands for at least one zero group
+                return std::unexpected(ParseError("IPv6 address of 8 groups", std::string(view.substr(gap_offset, i - gap_offset))));
+            }
+
+            // groups after the "::" move to the end
+            if (gap != SIZE_MAX) {
+                std::move_backward(groups.begin() + gap, groups.begin() + count, groups.end());
+                std::fill(groups.begin() + gap, groups.end() - (count - gap), uint16_t(0));
+            }
+
+            std::array<uint8_t, 16> address;
+            for (size_t g = 0; g < 8; g++) {
+                address[2 * g] = static_cast<uint8_t>(groups[g] >> 8);
+                address[2 * g + 1] = static_cast<uint8_t>(groups[g]);
+            }
+            return address;
+        }
+    }
+
+    template <typename Input>
+    Parser<uint32_t, Input> ipv4() {
+        return CPPARSEC_MAKE(Parser<uint32_t, Input>) {
+            std::string_view view(input.data(), input.size());
+            size_t length = 0;
+
+            std::expected<uint32_t, ParseError<>> address = detail::scan_ipv4(view, length);
+            CPPARSEC_FAIL_IF(!address, address.error());
+
+            input.remove_prefix(length);
+            return *address;
+        };
+    }
+
+    template <typename Input>
+    Parser<std::array<uint8_t, 16>, Input> ipv6() {
+        return CPPARSEC_MAKE(Parser<std::array<uint8_t, 16>, Input>) {
+            std::string_view view(input.data(), input.size());
+            size_t length = 0;
+
+            std::expected<std::array<uint8_t, 16>, ParseError<>> address = detail::scan_ipv6(view, length);
+            CPPARSEC_FAIL_IF(!address, address.error());
+
+            input.remove_prefix(length);
+            return *address;
+        };
+    }
+
+    template <typename Input>
+    Parser<Cidr, Input> cidr() {
+        return CPPARSEC_MAKE(Parser<Cidr, Input>) {
+            std::string_view view(input.data(), input.size());
+            size_t length = 0;
+            Cidr network{};
+
+            // an IPv4 network has a '.' before any ':'
+            size_t separator = view.substr(0, 5).find_first_of(".:");
+            network.is_ipv4 = separator != std::string_view::npos && view[separator] == '.';
+
+            if (network.is_ipv4) {
+                std::expected<uint32_t, ParseError<>> address = detail::scan_ipv4(view, length);
+                CPPARSEC_FAIL_IF(!address, address.error());
+                for (size_t b = 0; b < 4; b++) {
+                    network.address[b] = static_cast<uint8_t>(*address >> (24 - 8 * b));
+                }
+            }
+            else {
+                std::expected<std::array<uint8_t, 16>, ParseError<>> address = detail::scan_ipv6(view, length);
+                CPPARSEC_FAIL_IF(!address, address.error());
+                network.address = *address;
+            }
+
+            CPPARSEC_FAIL_IF(length >= view.size() || view[length] != '/', detail::address_error("'/'", view, length));
+            length++;
+
+            const unsigned max_prefix = network.is_ipv4 ? 32 : 128;
+            const size_t start = length;
+            unsigned prefix = 0;
+            while (length < view.size() && length - start < 3 && detail::is_decimal_digit(view[length])) {
+                prefix = prefix * 10 + (view[length] - '0');
+                length++;
+            }
+
+            CPPARSEC_FAIL_IF(length == start, detail::address_error("<digit>", view, length));
+            const bool too_long = length < view.size() && detail::is_decimal_digit(view[length]);
+            CPPARSEC_FAIL_IF(too_long || prefix > max_prefix || (view[start] == '0' && length - start > 1),
+                ParseError(std::format("prefix length in [0, {}]", max_prefix), std::string(view.substr(start, length - start + too_long))));
+
+            network.prefix_length = static_cast<uint8_t>(prefix);
+            input.remove_prefix(length);
+            return network;
+        };
+    }
+};
+
+#endif /* CPPARSEC_NET_H */
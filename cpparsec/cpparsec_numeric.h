@@ -1,27 +1,418 @@
 #ifndef CPPARSEC_NUMERIC_H
 #define CPPARSEC_NUMERIC_H
 
+#include <bit>
+#include <charconv>
+#include <limits>
+#include <optional>
+#include <span>
 #include "cpparsec.h"
+#include "cpparsec_float_tables.h"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
 
 namespace cpparsec {
     namespace detail {
-        int fast_stoi(std::string& s) {
-            int value;
-            std::from_chars(s.data(), s.data() + s.size(), value);
-            return value;
+        inline int fast_stoi(std::string& s) {
+            return static_cast<int>(decimal_run(s, s.size()).value);
         }
     }
 
     // =========================== Numeric Parsers ============================
 
+    // The scanners below read the input as bytes, 8 at a time, so they take char input,
+    // std::string_view or PaddedInput. Wide streams parse numbers with int_()
+
+    namespace detail {
+        // A signed or unsigned integer at the start of the input
+        template <std::integral T>
+        struct IntegerScan {
+            enum Status { ok, no_digits, overflow };
+
+            Status status;
+            T value;
+            size_t length; // bytes of the number, including an overflowing one
+        };
+
+        // Scans an integer with an optional sign, digits are converted by decimal_run
+        // readable is the number of bytes that may be loaded from view.data()
+        template <std::integral T>
+        IntegerScan<T> scan_integer(std::string_view view, size_t readable) {
+            using Scan = IntegerScan<T>;
+
+            size_t sign_length = 0;
+            if (!view.empty() && (view[0] == '+' || (std::is_signed_v<T> && view[0] == '-'))) {
+                sign_length = 1;
+            }
+            if (view.size() <= sign_length || view[sign_length] < '0' || view[sign_length] > '9') {
+                return Scan{ Scan::no_digits, T(), sign_length };
+            }
+
+            DigitRun run = decimal_run(view.substr(sign_length), readable - sign_length);
+            size_t length = sign_length + run.length;
+
+            using U = std::make_unsigned_t<T>;
+            const bool negative = view[0] == '-';
+            // the magnitude of the most negative value is one past max
+            const uint64_t limit = static_cast<uint64_t>(std::numeric_limits<T>::max()) + (negative ? 1 : 0);
+
+            if (run.overflow || run.value > limit) {
+                return Scan{ Scan::overflow, T(), length };
+            }
+
+            U magnitude = static_cast<U>(run.value);
+            return Scan{ Scan::ok, static_cast<T>(negative ? U(0) - magnitude : magnitude), length };
+        }
+
+        // Error for an integer that doesn't fit in T
+        template <std::integral T>
+        ParseError<> integer_range_error(std::string_view text) {
+            return ParseError(
+                std::format("integer in [{}, {}]", +std::numeric_limits<T>::min(), +std::numeric_limits<T>::max()),
+                std::string(text));
+        }
+
+        // Error for a missing integer, after sign_length bytes of sign
+        inline ParseError<> integer_digit_error(std::string_view view, size_t sign_length) {
+            return ParseError("<digit>", view.size() <= sign_length ? "end of input" : std::string(1, view[sign_length]));
+        }
+    }
+
+    // Parses an integer of any width, int8_t through uint64_t, without building a string
+    // Digits are converted 8 at a time by a SWAR kernel, see detail::decimal_run
+    // Accepts a leading '+', and '-' for signed types. Out of range values consume
+    // their digits and fail with a ParseError instead of wrapping or throwing
+    template <std::integral T, typename Input = std::string_view>
+        requires std::same_as<input_atom_t<Input>, char>
+    Parser<T, Input> integer() {
+        return CPPARSEC_MAKE(Parser<T, Input>) {
+            std::string_view view(input.data(), input.size());
+            detail::IntegerScan<T> scan = detail::scan_integer<T>(view, view.size() + input_padding<Input>());
+
+            CPPARSEC_FAIL_IF(scan.status == scan.no_digits, detail::integer_digit_error(view, scan.length));
+            input.remove_prefix(scan.length);
+            CPPARSEC_FAIL_IF(scan.status == scan.overflow, detail::integer_range_error<T>(view.substr(0, scan.length)));
+
+            return scan.value;
+        };
+    }
+
+    namespace detail {
+        // Appends integers separated by runs of separators to out, shared by both int_list parsers
+        // Returns the bytes consumed, or the offset and length of a number that doesn't fit in T
+        template <std::integral T, typename Allocator>
+        std::expected<size_t, std::pair<size_t, size_t>> scan_int_list(
+            std::string_view view, size_t readable, const ByteClass& separators, std::vector<T, Allocator>& out
+        ) {
+            size_t i = 0;
+
+            while (true) {
+                IntegerScan<T> scan = scan_integer<T>(view.substr(i), readable - i);
+                if (scan.status == scan.no_digits) {
+                    return i;
+                }
+                if (scan.status == scan.overflow) {
+                    return std::unexpected(std::pair{ i, scan.length });
+                }
+
+                out.push_back(scan.value);
+                i += scan.length;
+
+                size_t gap = separators.span(view.substr(i));
+                if (gap == 0) {
+                    return i;
+                }
+                i += gap;
+            }
+        }
+    }
+
+    // Parses integers separated by runs of separator characters into a caller vector,
+    // returning how many were appended. The vector's capacity is reused between parses,
+    // and a std::pmr::vector places the values in an arena
+    // int_list<int>(" \t", values) works like many(integer<int>() << skip_many(one of " \t")),
+    // without per-character parsing. Separators after the last integer are consumed
+    // On failure the vector is restored to its size before the parse
+    template <std::integral T, typename Input = std::string_view, typename Allocator>
+        requires std::same_as<input_atom_t<Input>, char>
+    Parser<size_t, Input> int_list(const std::string& separators, std::vector<T, Allocator>& out) {
+        detail::ByteClass separator_class(separators);
+        std::vector<T, Allocator>* values = &out;
+
+        return CPPARSEC_MAKE(Parser<size_t, Input>) {
+            std::string_view view(input.data(), input.size());
+            const size_t old_size = values->size();
+
+            auto scanned = detail::scan_int_list(view, view.size() + input_padding<Input>(), separator_class, *values);
+            if (!scanned) {
+                values->resize(old_size);
+                auto [offset, length] = scanned.error();
+                input.remove_prefix(offset + length);
+                CPPARSEC_FAIL(detail::integer_range_error<T>(view.substr(offset, length)));
+            }
+
+            input.remove_prefix(*scanned);
+            return values->size() - old_size;
+        };
+    }
+
+    // Parses integers separated by runs of separator characters, see int_list above
+    template <std::integral T, typename Input = std::string_view>
+        requires std::same_as<input_atom_t<Input>, char>
+    Parser<std::vector<T>, Input> int_list(const std::string& separators) {
+        detail::ByteClass separator_class(separators);
+
+        return CPPARSEC_MAKE(Parser<std::vector<T>, Input>) {
+            std::string_view view(input.data(), input.size());
+            std::vector<T> values;
+
+            auto scanned = detail::scan_int_list(view, view.size() + input_padding<Input>(), separator_class, values);
+            if (!scanned) {
+                auto [offset, length] = scanned.error();
+                input.remove_prefix(offset + length);
+                CPPARSEC_FAIL(detail::integer_range_error<T>(view.substr(offset, length)));
+            }
+
+            input.remove_prefix(*scanned);
+            return values;
+        };
+    }
+
+    // What decimal does with fraction digits past its scale
+    enum class DecimalRounding {
+        reject,    // fail unless the extra digits are all 0
+        half_up,   // round half away from zero
+        half_even, // round half to even, banker's rounding
+    };
+
+    namespace detail {
+        // Value of up to 19 digits that are known to be there
+        inline uint64_t digit_value(std::string_view digits) {
+            return decimal_run(digits, digits.size()).value;
+        }
+
+        // Unsigned counterpart of a decimal's integer type, make_unsigned_t only knows
+        // __int128 in GNU mode
+        template <typename T>
+        struct DecimalUnsigned {
+            using type = std::make_unsigned_t<T>;
+        };
+
+#ifdef __SIZEOF_INT128__
+        template <>
+        struct DecimalUnsigned<__int128> {
+            using type = unsigned __int128;
+        };
+#endif
+
+        // Appends a run of digits to magnitude 19 at a time, false if the result passes limit
+        template <typename U>
+        bool append_digits(U& magnitude, std::string_view digits, U limit) {
+            for (size_t i = 0; i < digits.size(); i += 19) {
+                std::string_view piece = digits.substr(i, 19);
+                const U scale = static_cast<U>(powers_of_ten_u64[piece.size() - 1]) * 10;
+                const U value = digit_value(piece);
+                if (value > limit || magnitude > (limit - value) / scale) {
+                    return false;
+                }
+                magnitude = magnitude * scale + value;
+            }
+            return true;
+        }
+    }
+
+    // Parses a decimal number into an integer count of 10^-Scale units, e.g. decimal<4>()
+    // reads "-1234.5678" as -12345678, for exact monetary values without a double
+    // Digits go through the same SWAR kernel as integer(), T may be __int128 where the
+    // compiler has it. Fraction digits past Scale are rejected or rounded, see DecimalRounding
+    // Out of range values and rejected digits consume the number and fail with a ParseError
+    template <int Scale, typename T = int64_t, typename Input = std::string_view>
+        requires std::same_as<input_atom_t<Input>, char>
+    Parser<T, Input> decimal(DecimalRounding rounding = DecimalRounding::reject) {
+        static_assert(Scale >= 0 && Scale <= 19, "decimal supports at most 19 fraction digits");
+
+        return CPPARSEC_MAKE(Parser<T, Input>) {
+            using U = typename detail::DecimalUnsigned<T>::type;
+            std::string_view view(input.data(), input.size());
+            const size_t readable = view.size() + input_padding<Input>();
+
+            size_t sign_length = !view.empty() && (view[0] == '+' || view[0] == '-') ? 1 : 0;
+            const bool negative = sign_length == 1 && view[0] == '-';
+            CPPARSEC_FAIL_IF(view.size() <= sign_length || view[sign_length] < '0' || view[sign_length] > '9',
+                detail::integer_digit_error(view, sign_length));
+
+            // the magnitude of the most negative value is one past max
+            const U limit = (U(~U(0)) >> 1) + (negative ? 1 : 0);
+            const U unit = static_cast<U>(detail::powers_of_ten_u64[Scale]);
+            bool in_range = true;
+            U magnitude = 0;
+
+            size_t i = sign_length;
+            detail::DigitRun whole = detail::decimal_run(view.substr(i), readable - i);
+            if (!whole.overflow && static_cast<U>(whole.value) <= limit / unit) {
+                magnitude = static_cast<U>(whole.value) * unit;
+            }
+            else {
+                in_range = detail::append_digits(magnitude, view.substr(i, whole.length), limit / unit);
+                magnitude *= unit;
+            }
+            i += whole.length;
+
+            // a '.' without digits after it isn't part of the number
+            detail::DigitRun fraction{ 0, 0, false };
+            if (i + 1 < view.size() && view[i] == '.' && view[i + 1] >= '0' && view[i + 1] <= '9') {
+                fraction = detail::decimal_run(view.substr(i + 1), readable - i - 1);
+            }
+
+            bool rejected = false;
+            if (fraction.length > 0) {
+                std::string_view digits = view.substr(i + 1, fraction.length);
+                i += 1 + fraction.length;
+
+                const size_t kept = std::min<size_t>(digits.size(), Scale);
+                U value = static_cast<U>(fraction.length <= Scale && !fraction.overflow ? fraction.value : detail::digit_value(digits.substr(0, kept)));
+                value *= static_cast<U>(detail::powers_of_ten_u64[Scale - kept]);
+                in_range = in_range && value <= limit - magnitude;
+                magnitude += value;
+
+                if (digits.size() > kept) {
+                    const char first = digits[kept];
+                    const bool rest_nonzero = digits.find_first_not_of('0', kept + 1) != std::string_view::npos;
+
+                    bool round_up = false;
+                    switch (rounding) {
+                    case DecimalRounding::reject:
+                        rejected = first != '0' || rest_nonzero;
+                        break;
+                    case DecimalRounding::half_up:
+                        round_up = first >= '5';
+                        break;
+                    case DecimalRounding::half_even:
+                        round_up = first > '5' || (first == '5' && (rest_nonzero || (magnitude & 1) == 1));
+                        break;
+                    }
+
+                    in_range = in_range && !(round_up && magnitude == limit);
+                    magnitude += round_up ? 1 : 0;
+                }
+            }
+
+            input.remove_prefix(i);
+            CPPARSEC_FAIL_IF(rejected, ParseError(std::format("at most {} fraction digits", Scale), std::string(view.substr(0, i))));
+            CPPARSEC_FAIL_IF(!in_range, ParseError(std::format("decimal with {} fraction digits in range", Scale), std::string(view.substr(0, i))));
+
+            return static_cast<T>(negative ? U(0) - magnitude : magnitude);
+        };
+    }
+
+    namespace detail {
+        // Shared by hex_integer, oct_integer and bin_integer
+        template <std::integral T, int Bits, typename Input>
+            requires std::same_as<input_atom_t<Input>, char>
+        Parser<T, Input> radix_integer(char prefix, std::string&& name) {
+            return CPPARSEC_MAKE(Parser<T, Input>) {
+                std::string_view view(input.data(), input.size());
+                const size_t readable = view.size() + input_padding<Input>();
+
+                auto is_digit = [](char c) {
+                    return Bits == 4 ? hex_digit_value(c) <= 0xF : (c >= '0' && c < '0' + (1 << Bits));
+                };
+                auto digit_run = [&](size_t at) {
+                    return Bits == 4 ? hex_run(view.substr(at), readable - at) : radix_run(view.substr(at), Bits);
+                };
+
+                // a prefix without a digit after it is just a 0
+                size_t i = 0;
+                if (view.size() > 2 && view[0] == '0' && (view[1] | 0x20) == prefix && is_digit(view[2])) {
+                    i = 2;
+                }
+
+                DigitRun run = digit_run(i);
+                CPPARSEC_FAIL_IF(run.length == 0,
+                    ParseError(std::format("<{} digit>", name), i < view.size() ? std::string(1, view[i]) : "end of input"));
+                i += run.length;
+
+                // '_' separates digit runs and is never leading, trailing or doubled
+                while (i + 1 < view.size() && view[i] == '_' && is_digit(view[i + 1])) {
+                    DigitRun more = digit_run(i + 1);
+                    const size_t bits = more.length * Bits;
+
+                    run.overflow |= more.overflow || (bits >= 64 ? run.value != 0 : (run.value >> (64 - bits)) != 0);
+                    run.value = bits >= 64 ? more.value : (run.value << bits) | more.value;
+                    i += 1 + more.length;
+                }
+
+                if (run.overflow || run.value > static_cast<uint64_t>(std::numeric_limits<T>::max())) {
+                    input.remove_prefix(i);
+                    CPPARSEC_FAIL(ParseError(std::format("{} integer in [0, {}]", name, +std::numeric_limits<T>::max()),
+                        std::string(view.substr(0, i))));
+                }
+
+                input.remove_prefix(i);
+                return static_cast<T>(run.value);
+            };
+        }
+    }
+
+    // Parses a hexadecimal integer in either case, with an optional 0x prefix and '_' digit separators
+    // Hex digits are converted 8 at a time by a SWAR kernel, see detail::hex_run
+    // No sign, values above the max of T consume their digits and fail with a ParseError
+    template <std::integral T, typename Input = std::string_view>
+        requires std::same_as<input_atom_t<Input>, char>
+    Parser<T, Input> hex_integer() {
+        return detail::radix_integer<T, 4, Input>('x', "hex");
+    }
+
+    // Parses an octal integer, with an optional 0o prefix and '_' digit separators
+    template <std::integral T, typename Input = std::string_view>
+        requires std::same_as<input_atom_t<Input>, char>
+    Parser<T, Input> oct_integer() {
+        return detail::radix_integer<T, 3, Input>('o', "octal");
+    }
+
+    // Parses a binary integer, with an optional 0b prefix and '_' digit separators
+    template <std::integral T, typename Input = std::string_view>
+        requires std::same_as<input_atom_t<Input>, char>
+    Parser<T, Input> bin_integer() {
+        return detail::radix_integer<T, 1, Input>('b', "binary");
+    }
+
+    // Parses exactly out.size() * 2 hex digits into a caller buffer, e.g. a SHA-256
+    // digest into a std::array<uint8_t, 32>, returning the filled span
+    // Fails without consuming input, out may be partly written on failure
+    template <typename Input = std::string_view>
+        requires std::same_as<input_atom_t<Input>, char>
+    Parser<std::span<uint8_t>, Input> hex_bytes(std::span<uint8_t> out) {
+        return CPPARSEC_MAKE(Parser<std::span<uint8_t>, Input>) {
+            std::string_view view(input.data(), input.size());
+            const size_t digits = out.size() * 2;
+            CPPARSEC_FAIL_IF(view.size() < digits, ParseError(std::format("{} hex digits", digits), "end of input"));
+
+            size_t invalid = detail::hex_decode(view.substr(0, digits), out.data());
+            CPPARSEC_FAIL_IF(invalid != std::string_view::npos, ParseError("<hex digit>", std::string(1, view[invalid])));
+
+            input.remove_prefix(digits);
+            return out;
+        };
+    }
+
     // Parses an int
-    inline Parser<int> int_() {
-        return CPPARSEC_MAKE(Parser<int>) {
-            CPPARSEC_SAVE(sign, optional_result(char_('-') | char_('+')));
-            CPPARSEC_SAVE(digits_str, many1(digit()));
+    template <typename Input = std::string_view>
+    Parser<int, Input> int_() {
+        return CPPARSEC_MAKE(Parser<int, Input>) {
+            CPPARSEC_SAVE(sign, optional_result(char_<Input>('-') | char_<Input>('+')));
+            CPPARSEC_SAVE(digits_str, many1(digit<Input>()));
 
             int num_sign = (sign.has_value() && sign.value() == '-') ? -1 : 1;
-            return num_sign * std::stoi(digits_str);
+            if constexpr (std::same_as<input_atom_t<Input>, char>) {
+                return num_sign * std::stoi(digits_str);
+            }
+            else {
+                // wide digits are all ASCII, narrow them for std::stoi
+                return num_sign * std::stoi(std::string(digits_str.begin(), digits_str.end()));
+            }
         };
     }
 
@@ -70,10 +461,7 @@ namespace cpparsec {
 
     // Parses an unsigned int
     inline Parser<unsigned int> uint() {
-        return CPPARSEC_MAKE(Parser<unsigned int>) {
-            CPPARSEC_SAVE(digits_str, many1(digit()));
-            return std::stoi(digits_str);
-        };
+        return integer<unsigned int>();
     }
 
     // Parses an unsigned int
@@ -81,6 +469,290 @@ namespace cpparsec {
         return many1(digit()).transform([](auto&& s) constexpr { return std::stoi(s); });
     }
 
+    // ======================== Floating Point Parsers ========================
+
+    // Syntax accepted by the floating point parsers, C syntax by default
+    // C: optional sign, digits with an optional '.' on either side, optional exponent
+    // JSON: no '+', no leading zeros, digits needed on both sides of a '.'
+    struct FloatOptions {
+        bool json = false;
+        bool inf_nan = false; // also accept inf, infinity and nan in any case
+    };
+
+    namespace detail {
+        // A scanned floating point number, the value is mantissa * 10^exponent
+        struct FloatScan {
+            size_t length = 0; // 0 if there is no number
+            bool negative = false;
+            bool exact = true; // mantissa holds every digit and exponent is small
+            bool infinity = false;
+            bool nan = false;
+            uint64_t mantissa = 0;
+            int64_t exponent = 0;
+        };
+
+        // Bounds of Clinger's fast path, where both the mantissa and the power of ten
+        // are exact in T, so one multiply or divide gives the correctly rounded result
+        template <std::floating_point T>
+        struct FastPathLimits {
+            static constexpr uint64_t max_mantissa = 1ull << std::numeric_limits<T>::digits;
+            static constexpr int64_t max_exponent = std::same_as<T, float> ? 10 : 22;
+        };
+
+        inline constexpr double powers_of_ten[] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+
+        // IEEE 754 layout of float and double
+        template <std::floating_point T>
+        struct BinaryFormat;
+
+        template <>
+        struct BinaryFormat<double> {
+            using Bits = uint64_t;
+            static constexpr int mantissa_bits = 52;
+            static constexpr int64_t minimum_exponent = -1023;
+            static constexpr int64_t infinite_power = 0x7FF;
+            static constexpr int64_t smallest_power_of_ten = -342;
+            static constexpr int64_t largest_power_of_ten = 308;
+            static constexpr int64_t min_round_to_even = -4; // outside this range halfway cases can't occur
+            static constexpr int64_t max_round_to_even = 23;
+        };
+
+        template <>
+        struct BinaryFormat<float> {
+            using Bits = uint32_t;
+            static constexpr int mantissa_bits = 23;
+            static constexpr int64_t minimum_exponent = -127;
+            static constexpr int64_t infinite_power = 0xFF;
+            static constexpr int64_t smallest_power_of_ten = -65;
+            static constexpr int64_t largest_power_of_ten = 38;
+            static constexpr int64_t min_round_to_even = -17;
+            static constexpr int64_t max_round_to_even = 10;
+        };
+
+        struct Uint128 {
+            uint64_t low;
+            uint64_t high;
+        };
+
+        // Full 64 x 64 -> 128 bit product
+        inline Uint128 full_multiplication(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+            unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+            return { static_cast<uint64_t>(product), static_cast<uint64_t>(product >> 64) };
+#elif defined(_MSC_VER) && defined(_M_X64)
+            uint64_t high;
+            uint64_t low = _umul128(a, b, &high);
+            return { low, high };
+#else
+            uint64_t a_low = a & 0xFFFFFFFF, a_high = a >> 32;
+            uint64_t b_low = b & 0xFFFFFFFF, b_high = b >> 32;
+            uint64_t low_low = a_low * b_low, low_high = a_low * b_high;
+            uint64_t high_low = a_high * b_low, high_high = a_high * b_high;
+            uint64_t middle = (low_low >> 32) + (low_high & 0xFFFFFFFF) + (high_low & 0xFFFFFFFF);
+            return { (middle << 32) | (low_low & 0xFFFFFFFF), high_high + (low_high >> 32) + (high_low >> 32) + (middle >> 32) };
+#endif
+        }
+
+        // Eisel-Lemire: the correctly rounded value of w * 10^q for a w holding every digit
+        // Multiplies w by a 128 bit approximation of 5^q and keeps the top bits, the
+        // exponent of 2 follows from q. Returns nullopt for subnormal, zero and infinite
+        // results, which the caller hands to the from_chars fallback
+        template <std::floating_point T>
+        std::optional<T> eisel_lemire(uint64_t w, int64_t q) {
+            using Format = BinaryFormat<T>;
+
+            if (w == 0) {
+                return T(0);
+            }
+            if (q < Format::smallest_power_of_ten || q > Format::largest_power_of_ten) {
+                return std::nullopt;
+            }
+
+            int leading_zeros = std::countl_zero(w);
+            w <<= leading_zeros;
+
+            // the second word only matters when the bits below the mantissa are all ones
+            const uint64_t* power = &powers_of_five_128[2 * (q - smallest_power_of_five)];
+            Uint128 product = full_multiplication(w, power[0]);
+            constexpr uint64_t precision_mask = UINT64_MAX >> (Format::mantissa_bits + 3);
+            if ((product.high & precision_mask) == precision_mask) {
+                Uint128 second = full_multiplication(w, power[1]);
+                product.low += second.high;
+                if (second.high > product.low) {
+                    product.high++;
+                }
+            }
+
+            int upper_bit = static_cast<int>(product.high >> 63);
+            int shift = upper_bit + 64 - Format::mantissa_bits - 3;
+            uint64_t mantissa = product.high >> shift;
+            // floor(log2(10^q)) is (217706 * q) >> 16 over the whole table range
+            int64_t power2 = (((152170 + 65536) * q) >> 16) + 63 + upper_bit - leading_zeros - Format::minimum_exponent;
+
+            if (power2 <= 0) {
+                return std::nullopt;
+            }
+
+            // exactly halfway between two values, round to even
+            if (product.low <= 1 && q >= Format::min_round_to_even && q <= Format::max_round_to_even
+                && (mantissa & 3) == 1 && (mantissa << shift) == product.high) {
+                mantissa &= ~uint64_t(1);
+            }
+
+            mantissa += mantissa & 1;
+            mantissa >>= 1;
+            if (mantissa >= (uint64_t(2) << Format::mantissa_bits)) {
+                mantissa = uint64_t(1) << Format::mantissa_bits;
+                power2++;
+            }
+            mantissa &= ~(uint64_t(1) << Format::mantissa_bits);
+
+            if (power2 >= Format::infinite_power) {
+                return std::nullopt;
+            }
+
+            auto bits = static_cast<typename Format::Bits>(mantissa | (static_cast<uint64_t>(power2) << Format::mantissa_bits));
+            return std::bit_cast<T>(bits);
+        }
+
+        // Scans a floating point number without converting it
+        // readable is the number of bytes that may be loaded from s.data()
+        inline FloatScan scan_float(std::string_view s, size_t readable, const FloatOptions& options) {
+            FloatScan scan;
+            size_t i = 0;
+
+            if (!s.empty() && (s[0] == '-' || (s[0] == '+' && !options.json))) {
+                scan.negative = s[0] == '-';
+                i++;
+            }
+
+            if (options.inf_nan) {
+                static const CaseFoldMatcher infinity("infinity"), inf("inf"), nan("nan");
+                for (const CaseFoldMatcher* special : { &infinity, &inf, &nan }) {
+                    if (i + special->size() <= s.size() && special->match(s.data() + i)) {
+                        scan.length = i + special->size();
+                        scan.infinity = special != &nan;
+                        scan.nan = special == &nan;
+                        return scan;
+                    }
+                }
+            }
+
+            DigitRun whole = decimal_run(s.substr(i), readable - i);
+            if (options.json && whole.length > 1 && s[i] == '0') {
+                whole = DigitRun{ 0, 1, false }; // JSON stops after a leading zero
+            }
+            i += whole.length;
+            scan.mantissa = whole.value;
+            scan.exact = !whole.overflow && whole.length <= 19;
+
+            size_t fraction_length = 0;
+            if (i < s.size() && s[i] == '.') {
+                DigitRun fraction = decimal_run(s.substr(i + 1), readable - i - 1);
+
+                // C takes "1." and ".5", JSON needs digits on both sides
+                if (fraction.length > 0 ? (whole.length > 0 || !options.json) : (whole.length > 0 && !options.json)) {
+                    i += 1 + fraction.length;
+                    fraction_length = fraction.length;
+
+                    if (scan.exact && !fraction.overflow && whole.length + fraction.length <= 19) {
+                        scan.mantissa = scan.mantissa * powers_of_ten_u64[fraction.length] + fraction.value;
+                        scan.exponent = -static_cast<int64_t>(fraction.length);
+                    }
+                    else {
+                        scan.exact = false;
+                    }
+                }
+            }
+
+            if (whole.length == 0 && fraction_length == 0) {
+                return FloatScan{};
+            }
+
+            // an exponent without digits is not part of the number, as with strtod
+            if (i < s.size() && (s[i] == 'e' || s[i] == 'E')) {
+                size_t j = i + 1;
+                bool negative_exponent = false;
+                if (j < s.size() && (s[j] == '-' || s[j] == '+')) {
+                    negative_exponent = s[j] == '-';
+                    j++;
+                }
+
+                DigitRun exponent = decimal_run(s.substr(j), readable - j);
+                if (exponent.length > 0) {
+                    i = j + exponent.length;
+                    if (exponent.overflow || exponent.value > 100000) {
+                        scan.exact = false;
+                    }
+                    else {
+                        scan.exponent += negative_exponent ? -static_cast<int64_t>(exponent.value) : static_cast<int64_t>(exponent.value);
+                    }
+                }
+            }
+
+            scan.length = i;
+            return scan;
+        }
+    }
+
+    // Parses a floating point number, correctly rounded to nearest
+    // Numbers with at most 19 digits are converted exactly by Clinger's fast path
+    // or Eisel-Lemire, the rest and subnormals by std::from_chars over the scanned input
+    // Out of range values consume their text and fail with a ParseError
+    template <std::floating_point T, typename Input = std::string_view>
+        requires std::same_as<input_atom_t<Input>, char>
+    Parser<T, Input> floating(FloatOptions options = {}) {
+        return CPPARSEC_MAKE(Parser<T, Input>) {
+            std::string_view view(input.data(), input.size());
+            detail::FloatScan scan = detail::scan_float(view, view.size() + input_padding<Input>(), options);
+            CPPARSEC_FAIL_IF(scan.length == 0, ParseError("<number>", view.empty() ? "end of input" : std::string(1, view[0])));
+
+            T value;
+            if (scan.infinity || scan.nan) {
+                value = scan.nan ? std::numeric_limits<T>::quiet_NaN() : std::numeric_limits<T>::infinity();
+                value = scan.negative ? -value : value;
+            }
+            else if (scan.exact && scan.mantissa <= detail::FastPathLimits<T>::max_mantissa
+                && scan.exponent >= -detail::FastPathLimits<T>::max_exponent && scan.exponent <= detail::FastPathLimits<T>::max_exponent) {
+                value = static_cast<T>(scan.mantissa);
+                T power = static_cast<T>(detail::powers_of_ten[scan.exponent < 0 ? -scan.exponent : scan.exponent]);
+                value = scan.exponent < 0 ? value / power : value * power;
+                value = scan.negative ? -value : value;
+            }
+            else if (std::optional<T> converted = scan.exact ? detail::eisel_lemire<T>(scan.mantissa, scan.exponent) : std::nullopt) {
+                value = scan.negative ? -*converted : *converted;
+            }
+            else {
+                // from_chars takes '-' but not '+'
+                const char* first = view.data() + (view[0] == '+' ? 1 : 0);
+                auto [end, ec] = std::from_chars(first, view.data() + scan.length, value);
+                if (ec == std::errc::result_out_of_range) {
+                    input.remove_prefix(scan.length);
+                    CPPARSEC_FAIL(ParseError("floating point number in range", std::string(view.substr(0, scan.length))));
+                }
+            }
+
+            input.remove_prefix(scan.length);
+            return value;
+        };
+    }
+
+    // Parses a float, see floating
+    template <typename Input = std::string_view>
+        requires std::same_as<input_atom_t<Input>, char>
+    Parser<float, Input> float_(FloatOptions options = {}) {
+        return floating<float, Input>(options);
+    }
+
+    // Parses a double, see floating
+    template <typename Input = std::string_view>
+        requires std::same_as<input_atom_t<Input>, char>
+    Parser<double, Input> double_(FloatOptions options = {}) {
+        return floating<double, Input>(options);
+    }
 };
 
 #endif /* CPPARSEC_NUMERIC_H */
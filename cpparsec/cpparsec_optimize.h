@@ -0,0 +1,924 @@
+#ifndef CPPARSEC_OPTIMIZE_H
+#define CPPARSEC_OPTIMIZE_H
+
+#include <array>
+#include "cpparsec.h"
+
+namespace cpparsec {
+
+    // ============================ GRAMMAR OPTIMIZER =============================
+
+    // optimize reads the grammar IR of a parser (see GrammarNode) and rebuilds it with fewer,
+    // faster steps. The rebuilt parser has the same results, consumed input and errors
+    //
+    //     try_(c), c parsing one atom                       -> c, it never consumes on failure
+    //     char_, char_satisfy and any_char alternatives     -> one class test, a byte table for char
+    //     many, many1, skip_many, skip_many1 of a class     -> a scan loop, SIMD for small classes
+    //     nested sequences (between, with, skip, >>, <<)    -> one flat sequence
+    //     adjacent char_ in a sequence                      -> one literal compare
+    //     dropped results, e.g. skip(many(p)) or a << b     -> recognizers building no values
+    //     many, many1, sep_by, sep_by1 and count            -> one loop over rewritten children, moving values
+    //     many_till(any_char(), string_(lit)), try_ or not  -> a search for lit, as take_until does
+    //     choices over byte atoms                           -> a jump on the next atom, see ChoiceRoutes
+    //
+    // Other nodes keep the parser that recorded them, so labels, transforms and hand-written
+    // parsers behave as before, but grammars behind them (and behind lazy) are not rewritten
+    // char_class and the library classes are tabulated, bytes above 0x7F reaching their predicates as
+    // negative chars (see detail::class_members). char_satisfy predicates are called for each atom tested
+
+    // Rewrites the grammar of p, once, returning a parser to use in its place
+    // The returned parser is opaque to grammar(), keep p to read the grammar
+    template <typename T, typename Input>
+    Parser<T, Input> optimize(const Parser<T, Input>& p);
+
+    // ============================================================================
+    //
+    // ========================= TEMPLATE IMPLEMENTATIONS =========================
+    //
+    // ============================================================================
+
+    namespace detail {
+        template <typename Atom>
+        using NodePtr = std::shared_ptr<const GrammarNode<Atom>>;
+
+        // Parses a rewritten subgrammar whose result is dropped
+        template <typename Input>
+        using Recognizer = std::function<ParseResult<std::monostate, input_atom_t<Input>>(Input&)>;
+
+        template <typename T>
+        constexpr bool is_std_vector = false;
+
+        template <typename T>
+        constexpr bool is_std_vector<std::vector<T>> = true;
+
+        template <typename T>
+        constexpr bool is_std_optional = false;
+
+        template <typename T>
+        constexpr bool is_std_optional<std::optional<T>> = true;
+
+        // True if node parses exactly one atom and never consumes input on failure
+        template <typename Atom>
+        bool is_atom_class(const GrammarNode<Atom>& node) {
+            switch (node.kind) {
+            case GrammarKind::char_:
+            case GrammarKind::char_class:
+            case GrammarKind::any_char:
+                return true;
+            case GrammarKind::try_:
+            case GrammarKind::choice:
+                return std::ranges::all_of(node.children, [](const NodePtr<Atom>& child) { return is_atom_class(*child); });
+            default:
+                return false;
+            }
+        }
+
+        // The atoms accepted by consecutive one atom alternatives, e.g. char_('-') | char_('+') | digit()
+        // Fails with the error of the last alternative, as the choice of them would
+        // A char class is a byte table unless a leaf is a char_satisfy, whose predicate is then called
+        // in order of the alternatives, as the choice would call it
+        template <typename Atom>
+        class AtomClass {
+        public:
+            // alternatives must pass is_atom_class
+            explicit AtomClass(const std::vector<NodePtr<Atom>>& alternatives);
+
+            // True if membership is read from a table, without calling predicates
+            bool tabulated() const;
+
+            bool contains(Atom c) const;
+
+            // Length of the leading run of members of input
+            template <typename Input>
+            size_t span(const Input& input) const;
+
+            // Error of the last alternative at the start of input
+            template <typename Input>
+            ParseError<Atom> error(const Input& input) const;
+
+        private:
+            void add_leaves(const NodePtr<Atom>& node);
+
+            static bool leaf_contains(const GrammarNode<Atom>& leaf, Atom c);
+
+            std::vector<NodePtr<Atom>> leaves;
+
+            // char atoms of pure leaves only, a scan uses SIMD when the members or the non-members are few
+            bool has_table = false;
+            std::array<bool, 256> table{};
+            ByteClass members{ std::string_view() };
+            ByteClass non_members{ std::string_view() };
+            bool scan_non_members = false;
+        };
+
+        template <typename Input>
+        std::optional<Recognizer<Input>> recognizer(const NodePtr<input_atom_t<Input>>& node);
+
+        template <typename T, typename Input>
+        std::optional<Parser<T, Input>> rewrite(const NodePtr<input_atom_t<Input>>& node);
+    };
+
+    // ============================== Atom Classes ================================
+
+    namespace detail {
+        template <typename Atom>
+        AtomClass<Atom>::AtomClass(const std::vector<NodePtr<Atom>>& alternatives) {
+            for (const NodePtr<Atom>& node : alternatives) {
+                add_leaves(node);
+            }
+
+            if constexpr (std::same_as<Atom, char>) {
+                has_table = std::ranges::none_of(leaves, [](const NodePtr<Atom>& leaf) {
+                    return leaf->kind == GrammarKind::char_class && !leaf->pure;
+                });
+                if (!has_table) {
+                    return;
+                }
+
+                std::bitset<256> bytes;
+                for (const NodePtr<Atom>& leaf : leaves) {
+                    switch (leaf->kind) {
+                    case GrammarKind::char_:
+                        bytes.set(static_cast<unsigned char>(leaf->atoms[0]));
+                        break;
+                    case GrammarKind::char_class:
+                        bytes |= class_members(leaf->predicate);
+                        break;
+                    default:
+                        bytes.set(); // any_char
+                        break;
+                    }
+                }
+
+                std::string in, out;
+                for (int b = 0; b < 256; b++) {
+                    table[b] = bytes[b];
+                    (table[b] ? in : out) += static_cast<char>(b);
+                }
+
+                members = ByteClass(in);
+                non_members = ByteClass(out);
+                scan_non_members = out.size() < in.size();
+            }
+        }
+
+        template <typename Atom>
+        void AtomClass<Atom>::add_leaves(const NodePtr<Atom>& node) {
+            if (node->kind == GrammarKind::try_ || node->kind == GrammarKind::choice) {
+                for (const NodePtr<Atom>& child : node->children) {
+                    add_leaves(child);
+                }
+            }
+            else {
+                leaves.push_back(node);
+            }
+        }
+
+        template <typename Atom>
+        bool AtomClass<Atom>::leaf_contains(const GrammarNode<Atom>& leaf, Atom c) {
+            switch (leaf.kind) {
+            case GrammarKind::char_:
+                return c == leaf.atoms[0];
+            case GrammarKind::char_class:
+                return leaf.predicate(c);
+            default:
+                return true; // any_char
+            }
+        }
+
+        template <typename Atom>
+        bool AtomClass<Atom>::tabulated() const {
+            return has_table;
+        }
+
+        template <typename Atom>
+        bool AtomClass<Atom>::contains(Atom c) const {
+            if constexpr (std::same_as<Atom, char>) {
+                if (has_table) {
+                    return table[static_cast<unsigned char>(c)];
+                }
+            }
+            return std::ranges::any_of(leaves, [c](const NodePtr<Atom>& leaf) { return leaf_contains(*leaf, c); });
+        }
+
+        template <typename Atom>
+        template <typename Input>
+        size_t AtomClass<Atom>::span(const Input& input) const {
+            if constexpr (std::same_as<Atom, char>) {
+                if (has_table) {
+                    std::string_view view(input.data(), input.size());
+                    return scan_non_members ? non_members.find(view) : members.span(view);
+                }
+            }
+
+            size_t n = 0;
+            while (n < input.size() && contains(input[n])) {
+                n++;
+            }
+            return n;
+        }
+
+        // Same errors as char_, char_satisfy and any_char
+        template <typename Atom>
+        template <typename Input>
+        ParseError<Atom> AtomClass<Atom>::error(const Input& input) const {
+            const GrammarNode<Atom>& last = *leaves.back();
+
+            switch (last.kind) {
+            case GrammarKind::char_:
+                if (input.empty()) {
+                    return ParseError<Atom>("end of input", detail::atom_to_string(last.atoms[0]));
+                }
+                return ParseError<Atom>(input[0], last.atoms[0]);
+            case GrammarKind::char_class:
+                if (input.empty()) {
+                    return ParseError<Atom>(last.label, "end of input");
+                }
+                return ParseError<Atom>(last.label, detail::atom_to_string(input[0]));
+            default:
+                return ParseError<Atom>("any_char: end of input");
+            }
+        }
+    };
+
+    // =============================== Recognizers ================================
+
+    namespace detail {
+        // Runs the parser that recorded node, nullopt if there is none
+        template <typename Input>
+        std::optional<Recognizer<Input>> source_recognizer(const GrammarNode<input_atom_t<Input>>& node) {
+            auto source = std::static_pointer_cast<const AnyParseFunction<Input>>(node.source.lock());
+            if (!source) {
+                return std::nullopt;
+            }
+
+            return [source](Input& input) { return source->recognize(input); };
+        }
+
+        template <typename Input>
+        Recognizer<Input> class_recognizer(AtomClass<input_atom_t<Input>> atoms) {
+            using Atom = input_atom_t<Input>;
+
+            return [atoms](Input& input) -> ParseResult<std::monostate, Atom> {
+                CPPARSEC_FAIL_IF(input.empty() || !atoms.contains(input[0]), atoms.error(input));
+
+                input.remove_prefix(1);
+                return std::monostate{};
+            };
+        }
+
+        // Adjacent char_ parsers, consuming and failing as they would one at a time
+        template <typename Input>
+        Recognizer<Input> char_run_recognizer(std::basic_string<input_atom_t<Input>> run) {
+            using Atom = input_atom_t<Input>;
+
+            return [run](Input& input) -> ParseResult<std::monostate, Atom> {
+                if (input.size() >= run.size() && std::equal(run.begin(), run.end(), input.data())) {
+                    input.remove_prefix(run.size());
+                    return std::monostate{};
+                }
+
+                size_t i = 0;
+                while (i < input.size() && input[i] == run[i]) {
+                    i++;
+                }
+                input.remove_prefix(i);
+
+                CPPARSEC_FAIL_IF(input.empty(), ParseError<Atom>("end of input", detail::atom_to_string(run[i])));
+                CPPARSEC_FAIL(ParseError<Atom>(input[0], run[i]));
+            };
+        }
+
+        // Appends the children of a sequence, splicing in nested sequences and leaving out success
+        template <typename Atom>
+        void flatten_sequence(const NodePtr<Atom>& node, std::vector<NodePtr<Atom>>& steps) {
+            if (node->kind == GrammarKind::sequence) {
+                for (const NodePtr<Atom>& child : node->children) {
+                    flatten_sequence(child, steps);
+                }
+            }
+            else if (node->kind != GrammarKind::success) {
+                steps.push_back(node);
+            }
+        }
+
+        // Appends the alternatives of a choice, splicing in nested choices
+        template <typename Atom>
+        void flatten_choice(const NodePtr<Atom>& node, std::vector<NodePtr<Atom>>& alternatives) {
+            if (node->kind == GrammarKind::choice) {
+                for (const NodePtr<Atom>& child : node->children) {
+                    flatten_choice(child, alternatives);
+                }
+            }
+            else {
+                alternatives.push_back(node);
+            }
+        }
+
+        // Recognizers for flattened sequence steps, adjacent char_ steps become one run
+        template <typename Input>
+        std::optional<std::vector<Recognizer<Input>>> step_recognizers(const std::vector<NodePtr<input_atom_t<Input>>>& steps) {
+            using Atom = input_atom_t<Input>;
+            std::vector<Recognizer<Input>> recognizers;
+
+            for (size_t i = 0; i < steps.size(); ) {
+                std::basic_string<Atom> run;
+                while (i < steps.size() && steps[i]->kind == GrammarKind::char_) {
+                    run += steps[i++]->atoms[0];
+                }
+
+                if (run.size() > 1) {
+                    recognizers.push_back(char_run_recognizer<Input>(std::move(run)));
+                    continue;
+                }
+                if (run.size() == 1) {
+                    i--;
+                }
+
+                std::optional<Recognizer<Input>> step = recognizer<Input>(steps[i++]);
+                if (!step) {
+                    return std::nullopt;
+                }
+                recognizers.push_back(std::move(*step));
+            }
+
+            return recognizers;
+        }
+
+        template <typename Input>
+        std::optional<Recognizer<Input>> sequence_recognizer(const NodePtr<input_atom_t<Input>>& node) {
+            using Atom = input_atom_t<Input>;
+
+            std::vector<NodePtr<Atom>> steps;
+            flatten_sequence(node, steps);
+
+            std::optional<std::vector<Recognizer<Input>>> recognizers = step_recognizers<Input>(steps);
+            if (!recognizers) {
+                return std::nullopt;
+            }
+            if (recognizers->size() == 1) {
+                return recognizers->front();
+            }
+
+            return [steps = std::move(*recognizers)](Input& input) -> ParseResult<std::monostate, Atom> {
+                for (const Recognizer<Input>& step : steps) {
+                    if (auto result = step(input); !result) {
+                        return result;
+                    }
+                }
+                return std::monostate{};
+            };
+        }
+
+        // FIRST set of the alternatives in nodes, any atom or none for wide atoms
+        template <typename Atom>
+        FirstSet first_of(const std::vector<NodePtr<Atom>>& nodes) {
+            FirstSet first;
+            if constexpr (sizeof(Atom) == 1) {
+                for (const NodePtr<Atom>& node : nodes) {
+                    first = either_first(first, first_set(*node));
+                }
+            }
+            else {
+                first.atoms.set();
+                first.nullable = true;
+            }
+            return first;
+        }
+
+        // Alternatives of a flattened choice, adjacent one atom alternatives become one class
+        // firsts gets the FIRST set of each alternative
+        template <typename Atom, typename Alternative>
+        std::optional<std::vector<Alternative>> alternatives_of(const NodePtr<Atom>& node, std::vector<FirstSet>& firsts, auto&& lower_class, auto&& lower) {
+            std::vector<NodePtr<Atom>> nodes;
+            flatten_choice(node, nodes);
+
+            std::vector<Alternative> alternatives;
+            for (size_t i = 0; i < nodes.size(); ) {
+                std::vector<NodePtr<Atom>> atoms;
+                while (i < nodes.size() && is_atom_class(*nodes[i])) {
+                    atoms.push_back(nodes[i++]);
+                }
+
+                if (!atoms.empty()) {
+                    alternatives.push_back(lower_class(AtomClass<Atom>(atoms)));
+                    firsts.push_back(first_of(atoms));
+                    continue;
+                }
+
+                std::optional<Alternative> alternative = lower(nodes[i]);
+                if (!alternative) {
+                    return std::nullopt;
+                }
+                alternatives.push_back(std::move(*alternative));
+                firsts.push_back(first_of<Atom>({ nodes[i++] }));
+            }
+
+            return alternatives;
+        }
+
+        template <typename Input>
+        std::optional<Recognizer<Input>> choice_recognizer(const NodePtr<input_atom_t<Input>>& node) {
+            using Atom = input_atom_t<Input>;
+
+            std::vector<FirstSet> firsts;
+            auto alternatives = alternatives_of<Atom, Recognizer<Input>>(node, firsts,
+                [](AtomClass<Atom> atoms) { return class_recognizer<Input>(std::move(atoms)); },
+                [](const NodePtr<Atom>& alternative) { return recognizer<Input>(alternative); });
+            if (!alternatives) {
+                return std::nullopt;
+            }
+            if (alternatives->size() == 1) {
+                return alternatives->front();
+            }
+
+            // as or_, the next alternative runs only if this one failed without consuming
+            return [alternatives = std::move(*alternatives), routes = ChoiceRoutes(firsts)](Input& input) -> ParseResult<std::monostate, Atom> {
+                const std::vector<uint32_t>& route = routes(input);
+                for (size_t k = 0; ; k++) {
+                    auto start = input.data();
+                    auto result = alternatives[route[k]](input);
+                    if (result || start != input.data() || k + 1 == route.size()) {
+                        return result;
+                    }
+                }
+            };
+        }
+
+        // many, many1, skip_many and skip_many1
+        template <typename Input>
+        std::optional<Recognizer<Input>> repeat_recognizer(const GrammarNode<input_atom_t<Input>>& node) {
+            using Atom = input_atom_t<Input>;
+            const bool at_least_one = node.kind == GrammarKind::many1 || node.kind == GrammarKind::skip_many1;
+            const bool skip = node.kind == GrammarKind::skip_many || node.kind == GrammarKind::skip_many1;
+
+            if (is_atom_class(*node.children[0])) {
+                AtomClass<Atom> atoms({ node.children[0] });
+
+                return [atoms, at_least_one](Input& input) -> ParseResult<std::monostate, Atom> {
+                    size_t n = atoms.span(input);
+                    CPPARSEC_FAIL_IF(at_least_one && n == 0, atoms.error(input));
+
+                    input.remove_prefix(n);
+                    return std::monostate{};
+                };
+            }
+
+            std::optional<Recognizer<Input>> p = recognizer<Input>(node.children[0]);
+            if (!p) {
+                return std::nullopt;
+            }
+
+            return [p = std::move(*p), at_least_one, skip](Input& input) -> ParseResult<std::monostate, Atom> {
+                if (at_least_one) {
+                    if (auto first = p(input); !first) {
+                        return first;
+                    }
+                }
+
+                while (true) {
+                    auto start = input.data();
+                    if (auto result = p(input); !result) {
+                        // a consumptive failure fails the repetition
+                        if (start == input.data()) {
+                            return std::monostate{};
+                        }
+                        if (skip) {
+                            CPPARSEC_FAIL(ParseError("skip_many", "skip_many"));
+                        }
+                        return result;
+                    }
+                }
+            };
+        }
+
+        // Recognizer of the rewritten node, nullopt if node can't be run
+        template <typename Input>
+        std::optional<Recognizer<Input>> rewritten_recognizer(const NodePtr<input_atom_t<Input>>& node) {
+            using Atom = input_atom_t<Input>;
+
+            if (is_atom_class(*node)) {
+                return class_recognizer<Input>(AtomClass<Atom>({ node }));
+            }
+
+            switch (node->kind) {
+            case GrammarKind::sequence:
+                return sequence_recognizer<Input>(node);
+            case GrammarKind::choice:
+                return choice_recognizer<Input>(node);
+            case GrammarKind::many:
+            case GrammarKind::many1:
+            case GrammarKind::skip_many:
+            case GrammarKind::skip_many1:
+                return repeat_recognizer<Input>(*node);
+            case GrammarKind::success:
+                return [](Input&) -> ParseResult<std::monostate, Atom> { return std::monostate{}; };
+            default:
+                break;
+            }
+
+            std::optional<Recognizer<Input>> child = node->children.empty() ? std::nullopt : recognizer<Input>(node->children[0]);
+            if (!child) {
+                return std::nullopt;
+            }
+
+            switch (node->kind) {
+            case GrammarKind::try_:
+                return [p = std::move(*child)](Input& input) {
+                    Input start = input;
+                    auto result = p(input);
+                    if (!result) {
+                        input = start;
+                    }
+                    return result;
+                };
+            case GrammarKind::optional:
+                return [p = std::move(*child)](Input& input) -> ParseResult<std::monostate, Atom> {
+                    auto start = input.data();
+                    auto result = p(input);
+                    CPPARSEC_FAIL_IF(!result && start != input.data(), result.error());
+
+                    return std::monostate{};
+                };
+            case GrammarKind::look_ahead:
+                return [p = std::move(*child)](Input& input) {
+                    Input start = input;
+                    auto result = p(input);
+                    if (result) {
+                        input = start;
+                    }
+                    return result;
+                };
+            case GrammarKind::not_followed_by:
+                return [p = std::move(*child)](Input& input) -> ParseResult<std::monostate, Atom> {
+                    Input start = input;
+                    auto result = p(input);
+                    input = start;
+                    CPPARSEC_FAIL_IF(result.has_value(), ParseError("not_followed_by", "not_followed_by"));
+
+                    return std::monostate{};
+                };
+            case GrammarKind::count:
+                return [p = std::move(*child), n = node->count](Input& input) -> ParseResult<std::monostate, Atom> {
+                    for (size_t i = 0; i < n; i++) {
+                        if (auto result = p(input); !result) {
+                            return result;
+                        }
+                    }
+                    return std::monostate{};
+                };
+            default:
+                return std::nullopt;
+            }
+        }
+
+        // Parses node dropping the result, rewritten where possible and by its source otherwise
+        template <typename Input>
+        std::optional<Recognizer<Input>> recognizer(const NodePtr<input_atom_t<Input>>& node) {
+            if (std::optional<Recognizer<Input>> rewritten = rewritten_recognizer<Input>(node)) {
+                return rewritten;
+            }
+            return source_recognizer<Input>(*node);
+        }
+    };
+
+    // ================================= Rewrites =================================
+
+    namespace detail {
+        // Parser<T, Input> running a recognizer, for results that are known without parsing
+        template <typename T, typename Input>
+        Parser<T, Input> recognizing(Recognizer<Input> recognize, T value) {
+            return CPPARSEC_MAKE(Parser<T, Input>) {
+                if (auto result = recognize(input); !result) {
+                    return std::unexpected(std::move(result.error()));
+                }
+                return value;
+            };
+        }
+
+        // The kept child of nested sequences, appending the dropped steps around it
+        template <typename Atom>
+        NodePtr<Atom> kept_step(const GrammarNode<Atom>& node, std::vector<NodePtr<Atom>>& before, std::vector<NodePtr<Atom>>& after) {
+            const size_t keep = static_cast<size_t>(node.keep);
+            for (size_t i = 0; i < keep; i++) {
+                flatten_sequence(node.children[i], before);
+            }
+
+            NodePtr<Atom> kept = node.children[keep];
+            if (kept->kind == GrammarKind::sequence && kept->keep >= 0) {
+                kept = kept_step(*kept, before, after);
+            }
+
+            for (size_t i = keep + 1; i < node.children.size(); i++) {
+                flatten_sequence(node.children[i], after);
+            }
+            return kept;
+        }
+
+        // A flat sequence returning the result of one step
+        template <typename T, typename Input>
+        std::optional<Parser<T, Input>> rewrite_sequence(const GrammarNode<input_atom_t<Input>>& node) {
+            using Atom = input_atom_t<Input>;
+
+            std::vector<NodePtr<Atom>> before, after;
+            NodePtr<Atom> kept = kept_step(node, before, after);
+
+            // a kept char_ is known, so it can join a run with the steps around it
+            if constexpr (std::same_as<T, Atom>) {
+                if (kept->kind == GrammarKind::char_) {
+                    before.push_back(kept);
+                    before.insert(before.end(), after.begin(), after.end());
+
+                    std::optional<std::vector<Recognizer<Input>>> steps = step_recognizers<Input>(before);
+                    if (!steps) {
+                        return std::nullopt;
+                    }
+
+                    const Atom value = kept->atoms[0];
+                    return CPPARSEC_MAKE(Parser<T, Input>) {
+                        for (const Recognizer<Input>& step : *steps) {
+                            if (auto result = step(input); !result) {
+                                return std::unexpected(std::move(result.error()));
+                            }
+                        }
+                        return value;
+                    };
+                }
+            }
+
+            std::optional<std::vector<Recognizer<Input>>> pre = step_recognizers<Input>(before);
+            std::optional<std::vector<Recognizer<Input>>> post = step_recognizers<Input>(after);
+            std::optional<Parser<T, Input>> value = rewrite<T, Input>(kept);
+            if (!pre || !post || !value) {
+                return std::nullopt;
+            }
+
+            return CPPARSEC_MAKE(Parser<T, Input>) {
+                for (const Recognizer<Input>& step : *pre) {
+                    if (auto result = step(input); !result) {
+                        return std::unexpected(std::move(result.error()));
+                    }
+                }
+
+                auto result = value->parse(input);
+                if (!result) {
+                    return result;
+                }
+
+                for (const Recognizer<Input>& step : *post) {
+                    if (auto skipped = step(input); !skipped) {
+                        return std::unexpected(std::move(skipped.error()));
+                    }
+                }
+                return result;
+            };
+        }
+
+        template <typename Input>
+        Parser<input_atom_t<Input>, Input> class_parser(AtomClass<input_atom_t<Input>> atoms) {
+            using Atom = input_atom_t<Input>;
+
+            return CPPARSEC_MAKE(Parser<Atom, Input>) {
+                CPPARSEC_FAIL_IF(input.empty() || !atoms.contains(input[0]), atoms.error(input));
+
+                Atom c = input[0];
+                input.remove_prefix(1);
+                return c;
+            };
+        }
+
+        template <typename T, typename Input>
+        std::optional<Parser<T, Input>> rewrite_choice(const NodePtr<input_atom_t<Input>>& node) {
+            using Atom = input_atom_t<Input>;
+
+            // alternatives parsing one atom return an Atom, so only a choice of Atom has them
+            auto lower_class = [](AtomClass<Atom> atoms) {
+                if constexpr (std::same_as<T, Atom>) {
+                    return class_parser<Input>(std::move(atoms));
+                }
+                else {
+                    return unexpected<Input, T>();
+                }
+            };
+            std::vector<FirstSet> firsts;
+            auto alternatives = alternatives_of<Atom, Parser<T, Input>>(node, firsts, lower_class,
+                [](const NodePtr<Atom>& alternative) { return rewrite<T, Input>(alternative); });
+            if (!alternatives) {
+                return std::nullopt;
+            }
+            if (alternatives->size() == 1) {
+                return alternatives->front();
+            }
+
+            ChoiceTable<T, Input> table(std::move(*alternatives), firsts);
+            return CPPARSEC_MAKE(Parser<T, Input>) {
+                return table.parse(input);
+            };
+        }
+
+        // many_till(any_char(), string_(lit)) and many_till(any_char(), try_(string_(lit))) into a
+        // std::vector or std::string, a search for lit instead of a parse of lit and any_char per byte
+        template <typename T, typename Input>
+        std::optional<Parser<T, Input>> rewrite_many_till(const GrammarNode<input_atom_t<Input>>& node) {
+            if constexpr (std::same_as<input_atom_t<Input>, char> && std::same_as<typename T::value_type, char>) {
+                const GrammarNode<char>& end = *node.children[1];
+                const bool tried = end.kind == GrammarKind::try_;
+                const GrammarNode<char>& literal = tried ? *end.children[0] : end;
+                if (node.children[0]->kind != GrammarKind::any_char || literal.kind != GrammarKind::literal || literal.atoms.empty()) {
+                    return std::nullopt;
+                }
+
+                LiteralSearcher searcher(std::string(literal.atoms.begin(), literal.atoms.end()));
+                return CPPARSEC_MAKE(Parser<T, Input>) {
+                    std::string_view view(input.data(), input.size());
+                    const std::string& lit = searcher.literal();
+
+                    // without try_, the first place lit could start at decides, a partial match consumes and fails
+                    size_t pos = tried ? searcher.find(view) : view.find(lit[0]);
+                    if (pos != std::string_view::npos && pos + lit.size() > view.size()) {
+                        pos = std::string_view::npos;
+                    }
+                    if (pos != std::string_view::npos && !tried) {
+                        size_t matched = 0;
+                        while (matched < lit.size() && view[pos + matched] == lit[matched]) {
+                            matched++;
+                        }
+                        if (matched < lit.size()) {
+                            input.remove_prefix(pos + matched);
+                            CPPARSEC_FAIL(ParseError<char>("many_tillfail", "many_tillfail"));
+                        }
+                    }
+
+                    // not found, any_char fails at the end of input
+                    if (pos == std::string_view::npos) {
+                        input.remove_prefix(view.size());
+                        CPPARSEC_FAIL(ParseError<char>("many_tillfail", "many_tillfail"));
+                    }
+
+                    input.remove_prefix(pos + lit.size());
+                    return T(view.data(), view.data() + pos);
+                };
+            }
+            return std::nullopt;
+        }
+
+        // many, many1, sep_by, sep_by1 and count into a std::vector or a std::basic_string of atoms
+        template <typename T, typename Input>
+        std::optional<Parser<T, Input>> rewrite_repeat(const GrammarNode<input_atom_t<Input>>& node) {
+            using Atom = input_atom_t<Input>;
+            using Item = typename T::value_type;
+
+            const bool at_least_one = node.kind == GrammarKind::many1;
+            if constexpr (std::same_as<Item, Atom>) {
+                if ((node.kind == GrammarKind::many || at_least_one) && is_atom_class(*node.children[0])) {
+                    AtomClass<Atom> atoms({ node.children[0] });
+
+                    return CPPARSEC_MAKE(Parser<T, Input>) {
+                        size_t n = atoms.span(input);
+                        CPPARSEC_FAIL_IF(at_least_one && n == 0, atoms.error(input));
+
+                        T values(input.data(), input.data() + n);
+                        input.remove_prefix(n);
+                        return values;
+                    };
+                }
+            }
+
+            std::optional<Parser<Item, Input>> p = rewrite<Item, Input>(node.children[0]);
+            if (!p) {
+                return std::nullopt;
+            }
+
+            if (node.kind == GrammarKind::count) {
+                if constexpr (is_std_vector<T>) {
+                    return count(static_cast<int>(node.count), *p);
+                }
+                return std::nullopt;
+            }
+
+            // sep_by and sep_by1 drop the separator results, a one atom separator is tested in place
+            // as its error would be dropped too
+            std::optional<Recognizer<Input>> sep;
+            std::optional<AtomClass<Atom>> sep_atoms;
+            if ((node.kind == GrammarKind::sep_by || node.kind == GrammarKind::sep_by1) && is_atom_class(*node.children[1])) {
+                sep_atoms.emplace(std::vector{ node.children[1] });
+            }
+            else if (node.kind == GrammarKind::sep_by || node.kind == GrammarKind::sep_by1) {
+                sep = recognizer<Input>(node.children[1]);
+                if (!sep) {
+                    return std::nullopt;
+                }
+            }
+            const bool first_required = node.kind == GrammarKind::many1 || node.kind == GrammarKind::sep_by1;
+
+            // one loop moving each value in, failing and stopping where the combinators would
+            return CPPARSEC_MAKE(Parser<T, Input>) {
+                T values;
+
+                auto start = input.data();
+                auto first = p->parse(input);
+                if (!first) {
+                    CPPARSEC_FAIL_IF(first_required || start != input.data(), std::move(first.error()));
+                    return values;
+                }
+                values.push_back(std::move(*first));
+
+                while (true) {
+                    start = input.data();
+                    if (sep_atoms) {
+                        if (input.empty() || !sep_atoms->contains(input[0])) {
+                            break;
+                        }
+                        input.remove_prefix(1);
+                    }
+                    else if (sep) {
+                        if (auto skipped = (*sep)(input); !skipped) {
+                            CPPARSEC_FAIL_IF(start != input.data(), std::move(skipped.error()));
+                            break;
+                        }
+                    }
+
+                    auto item = p->parse(input);
+                    if (!item) {
+                        CPPARSEC_FAIL_IF(start != input.data(), std::move(item.error()));
+                        break;
+                    }
+                    values.push_back(std::move(*item));
+                }
+
+                return values;
+            };
+        }
+
+        // node rebuilt as a Parser<T, Input>, node must have been recorded by a Parser<T, Input>
+        // nullopt if it can't be run, e.g. a success step whose value isn't recorded
+        template <typename T, typename Input>
+        std::optional<Parser<T, Input>> rewrite(const NodePtr<input_atom_t<Input>>& node_ptr) {
+            using Atom = input_atom_t<Input>;
+            const GrammarNode<Atom>& node = *node_ptr;
+
+            std::optional<Parser<T, Input>> rewritten;
+            switch (node.kind) {
+            case GrammarKind::sequence:
+            case GrammarKind::choice:
+            case GrammarKind::try_:
+            case GrammarKind::optional:
+            case GrammarKind::many:
+            case GrammarKind::many1:
+            case GrammarKind::skip_many:
+            case GrammarKind::skip_many1:
+            case GrammarKind::sep_by:
+            case GrammarKind::sep_by1:
+            case GrammarKind::count:
+            case GrammarKind::many_till:
+            case GrammarKind::look_ahead:
+            case GrammarKind::not_followed_by:
+                break;
+            default:
+                // leaves are already as fast as a rewrite
+                return Parser<T, Input>::recorded(node);
+            }
+
+            if constexpr (std::same_as<T, std::monostate>) {
+                // the result is known, only the consumed input and errors matter
+                if (std::optional<Recognizer<Input>> recognize = rewritten_recognizer<Input>(node_ptr)) {
+                    rewritten = recognizing<T, Input>(std::move(*recognize), std::monostate{});
+                }
+            }
+            else if (node.kind == GrammarKind::sequence && node.keep >= 0) {
+                rewritten = rewrite_sequence<T, Input>(node);
+            }
+            else if (node.kind == GrammarKind::choice) {
+                rewritten = rewrite_choice<T, Input>(node_ptr);
+            }
+            else if (node.kind == GrammarKind::try_) {
+                std::optional<Parser<T, Input>> p = rewrite<T, Input>(node.children[0]);
+                if (p && is_atom_class(*node.children[0])) {
+                    rewritten = p;
+                }
+                else if (p) {
+                    rewritten = try_(*p);
+                }
+            }
+            else if constexpr (is_std_vector<T> || std::same_as<T, std::basic_string<Atom>>) {
+                if (node.kind == GrammarKind::many || node.kind == GrammarKind::many1 || node.kind == GrammarKind::count
+                    || node.kind == GrammarKind::sep_by || node.kind == GrammarKind::sep_by1) {
+                    rewritten = rewrite_repeat<T, Input>(node);
+                }
+                else if (node.kind == GrammarKind::many_till) {
+                    rewritten = rewrite_many_till<T, Input>(node);
+                }
+            }
+
+            return rewritten ? rewritten : Parser<T, Input>::recorded(node);
+        }
+    };
+
+    template <typename T, typename Input>
+    Parser<T, Input> optimize(const Parser<T, Input>& p) {
+        std::optional<Parser<T, Input>> rewritten = detail::rewrite<T, Input>(p.grammar());
+        return rewritten ? *rewritten : p;
+    }
+};
+
+#endif /* CPPARSEC_OPTIMIZE_H */
@@ -0,0 +1,121 @@
+#ifndef CPPARSEC_PADDED_H
+#define CPPARSEC_PADDED_H
+
+#include <cstring>
+#include <memory>
+#include <fstream>
+#include <filesystem>
+#include "cpparsec_char.h"
+
+namespace cpparsec {
+
+    // ============================ PADDED INPUT ==============================
+
+    // A padded InputStream guarantees PaddedInput::padding readable '\0' bytes
+    // past its logical end. Leaf parsers only check for the end of input when
+    // they see a '\0' or fail, and bulk kernels can load whole chunks near the end.
+    //
+    // PaddedInput is a view, the bytes are owned by a PaddedBuffer
+    //
+    //     PaddedBuffer buffer = PaddedBuffer::from_file("log.txt").value();
+    //     PaddedInput input = buffer.view();
+    //     ParseResult<char> c = char_<PaddedInput>('x').parse(input);
+
+    class PaddedBuffer;
+
+    class PaddedInput {
+    public:
+        // readable zero bytes guaranteed past the end, enough for one cache line
+        static constexpr size_t padding = 64;
+
+        using value_type = char;
+        using const_iterator = std::string_view::const_iterator;
+
+        // functions mirroring std::string_view
+        size_t size() const { return view.size(); }
+        const char* data() const { return view.data(); }
+        bool empty() const { return view.empty(); }
+        const_iterator begin() const { return view.begin(); }
+        const_iterator end() const { return view.end(); }
+        const char& front() const { return view.front(); }
+        const char& back() const { return view.back(); }
+
+        // may read up to padding bytes past size()
+        const char& operator[](size_t n) const { return view.data()[n]; }
+
+        std::string_view substr(size_t offset, size_t count = std::string_view::npos) const { return view.substr(offset, count); }
+        void remove_prefix(size_t n) { view.remove_prefix(n); }
+
+        operator std::string_view() const { return view; }
+        bool operator==(std::string_view other) const { return view == other; }
+
+    private:
+        friend class PaddedBuffer;
+        explicit PaddedInput(std::string_view view) : view(view) { }
+
+        std::string_view view;
+    };
+
+    // Owns input bytes followed by PaddedInput::padding zero bytes
+    class PaddedBuffer {
+    public:
+        // Copies text into a new padded buffer
+        explicit PaddedBuffer(std::string_view text);
+
+        // Loads a whole file into a padded buffer
+        static std::expected<PaddedBuffer, std::string> from_file(const std::filesystem::path& path);
+
+        // A PaddedInput over the whole buffer
+        PaddedInput view() const { return PaddedInput(std::string_view(storage.get(), length)); }
+
+        size_t size() const { return length; }
+
+    private:
+        explicit PaddedBuffer(size_t length);
+
+        std::unique_ptr<char[]> storage;
+        size_t length;
+    };
+
+    template <typename T>
+    using PaddedParser = Parser<T, PaddedInput>;
+
+    // ========================================================================
+    //
+    // =========================== IMPLEMENTATIONS ============================
+    //
+    // ========================================================================
+
+    inline PaddedBuffer::PaddedBuffer(size_t length) :
+        storage(std::make_unique<char[]>(length + PaddedInput::padding)), // value-initialized to '\0'
+        length(length)
+    { }
+
+    // Copies text into a new padded buffer
+    inline PaddedBuffer::PaddedBuffer(std::string_view text) : PaddedBuffer(text.size()) {
+        std::memcpy(storage.get(), text.data(), text.size());
+    }
+
+    // Loads a whole file into a padded buffer
+    inline std::expected<PaddedBuffer, std::string> PaddedBuffer::from_file(const std::filesystem::path& path) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            return std::unexpected(std::format("could not open \"{}\"", path.string()));
+        }
+
+        std::streamsize file_size = file.tellg();
+        if (file_size < 0) {
+            return std::unexpected(std::format("could not read the size of \"{}\"", path.string()));
+        }
+        file.seekg(0);
+
+        PaddedBuffer buffer(static_cast<size_t>(file_size));
+        if (!file.read(buffer.storage.get(), file_size)) {
+            return std::unexpected(std::format("could not read \"{}\"", path.string()));
+        }
+
+        return buffer;
+    }
+};
+
+#endif /* CPPARSEC_PADDED_H */
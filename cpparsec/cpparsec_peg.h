@@ -0,0 +1,903 @@
+#ifndef CPPARSEC_PEG_H
+#define CPPARSEC_PEG_H
+
+#include <bitset>
+#include "cpparsec_vm.h"
+
+namespace cpparsec {
+
+    // ============================== PEG GRAMMARS ================================
+
+    // load_grammar(text) reads a PEG from text at runtime and compiles it to the bytecode machine of
+    // bytecode(p), for formats only known when the program runs
+    //
+    //     # the first rule is the start rule
+    //     entry   <- date:date ' ' level:level ' ' message:.*
+    //     date    <- [0-9]+ '-' [0-9]+ '-' [0-9]+
+    //     level   <- 'INFO' / 'WARN' / 'ERROR'
+    //
+    //     ParseResult<Grammar> grammar = load_grammar(text);
+    //     ParseResult<Fields> entry = grammar->fields().parse(line);
+    //     std::string_view level = (*entry)["level"];
+    //
+    // Definitions are name <- e, name = e, name := e or name ::= e, optionally ending with ;
+    //     e1 / e2, e1 | e2    ordered choice, e2 is tried from where e1 started whatever e1 consumed
+    //     e1 e2               sequence
+    //     &e, !e              look ahead, not followed by, consuming nothing
+    //     e?, e*, e+          optional, greedy repetitions
+    //     'abc', "abc"        literals with the escapes \n \r \t \0 \xHH, others are the escaped character
+    //     [a-z_], [^"]        classes of bytes, with ranges and negation
+    //     .                   any byte
+    //     name:e              a capture named name of the input e matches, e with its suffixes
+    //     ( e )               grouping, # starts a comment to the end of the line
+    //
+    // Classes, choices of bytes and repetitions of them are the classes and spans of hand-written grammars,
+    // choices of literals are keyword sets, and rules used once or small are inlined
+    // Loading fails on syntax errors, undefined and left recursive rules, and repetitions of expressions
+    // that can match nothing
+
+    // A named capture of a match, with the captures inside it
+    // text views the input, name views the grammar, which its parsers keep alive
+    struct Capture {
+        std::string_view name;
+        std::string_view text;
+        std::vector<Capture> children;
+
+        // The first child named name, or nullptr
+        const Capture* find(std::string_view name) const;
+    };
+
+    namespace detail {
+        struct PegProgram;
+    };
+
+    // The text of the named captures of a match, the last one for a name captured again
+    class Fields {
+    public:
+        // The text captured as name, empty if it didn't match
+        std::string_view operator[](std::string_view name) const;
+
+        // True if a capture named name matched
+        bool contains(std::string_view name) const;
+
+    private:
+        friend class Grammar;
+
+        std::shared_ptr<const detail::PegProgram> program;
+        std::vector<std::optional<std::string_view>> texts;  // by capture name index
+    };
+
+    // A loaded PEG, see load_grammar
+    class Grammar {
+    public:
+        // Name of the start rule, the first one defined
+        const std::string& start() const;
+
+        // Parses the start rule, returning a capture of its match named after it
+        Parser<Capture> captures() const;
+
+        // Parses the start rule, returning the named captures without building a tree
+        Parser<Fields> fields() const;
+
+    private:
+        friend ParseResult<Grammar> load_grammar(std::string_view text);
+
+        std::shared_ptr<const detail::PegProgram> program;
+    };
+
+    // Reads and compiles the PEG of text
+    ParseResult<Grammar> load_grammar(std::string_view text);
+
+    // ============================================================================
+    //
+    // ========================= TEMPLATE IMPLEMENTATIONS =========================
+    //
+    // ============================================================================
+
+    // =============================== Grammar IR =================================
+
+    namespace detail {
+        // Expression of a loaded grammar
+        struct PegExpr {
+            enum class Kind {
+                rule,       // rule text, resolved to rule
+                literal,    // text
+                set,        // bytes in set
+                any,
+                sequence,
+                choice,
+                optional,
+                many,
+                many1,
+                and_,
+                not_,
+                capture,    // named text
+            };
+
+            Kind kind = Kind::literal;
+            std::string text;
+            std::bitset<256> set;
+            std::vector<PegExpr> children;
+            size_t rule = 0;
+        };
+
+        struct PegRule {
+            std::string name;
+            PegExpr expr;
+        };
+
+        // A compiled grammar, tag k + 1 opens capture names[k] and tag 0 closes it
+        struct PegProgram {
+            VmProgram<std::string_view> program;
+            std::vector<std::string> names;
+            std::string start;
+
+            size_t name_index(std::string_view name) const {
+                return std::ranges::find(names, name) - names.begin();
+            }
+
+            // Error of a failed match of input, which got as far as position
+            ParseError<char> error(std::string_view input, size_t position) const {
+                return ParseError<char>(start, position < input.size() ? std::string(1, input[position]) : "end of input");
+            }
+        };
+
+        inline PegExpr peg_node(PegExpr::Kind kind, std::vector<PegExpr> children = {}) {
+            PegExpr expr;
+            expr.kind = kind;
+            expr.children = std::move(children);
+            return expr;
+        }
+    };
+
+    // ================================ Syntax ====================================
+
+    namespace detail {
+        // Skips whitespace and comments
+        inline Parser<std::monostate> peg_spacing() {
+            return skip_many(spaces1() | char_('#') >> skip_many(char_satisfy([](char c) { return c != '\n'; })));
+        }
+
+        template <typename T>
+        Parser<T> peg_token(const Parser<T>& p) {
+            return p << peg_spacing();
+        }
+
+        inline Parser<std::string> peg_identifier() {
+            return peg_token(look_ahead(letter() | char_('_')) >> many1(alpha_num() | char_('_')));
+        }
+
+        inline Parser<std::string_view> peg_definition_operator() {
+            return peg_token(keywords({ "<-", "=", ":=", "::=" }));
+        }
+
+        // A character of a literal or class, up to an unescaped end
+        inline Parser<char> peg_character(char end) {
+            Parser<char> hex = char_satisfy([](char c) { return std::isxdigit(static_cast<unsigned char>(c)) != 0; }, "<hex digit>");
+            Parser<char> byte = (char_('x') >> count(2, hex)).transform([](const std::vector<char>& digits) {
+                return static_cast<char>(std::stoi(std::string(digits.begin(), digits.end()), nullptr, 16));
+            });
+            Parser<char> escaped = any_char().transform([](char c) {
+                switch (c) {
+                case 'n': return '\n';
+                case 'r': return '\r';
+                case 't': return '\t';
+                case '0': return '\0';
+                default: return c;
+                }
+            });
+
+            return char_('\\') >> (byte | escaped) | char_satisfy([end](char c) { return c != end && c != '\\'; }, "<character>");
+        }
+
+        inline Parser<PegExpr> peg_literal() {
+            Parser<std::string> single = char_('\'') >> many(peg_character('\'')) << char_('\'');
+            Parser<std::string> double_ = char_('"') >> many(peg_character('"')) << char_('"');
+            return peg_token(single | double_).transform([](std::string text) {
+                PegExpr expr = peg_node(PegExpr::Kind::literal);
+                expr.text = std::move(text);
+                return expr;
+            });
+        }
+
+        inline Parser<PegExpr> peg_class() {
+            Parser<char> member = peg_character(']');
+            Parser<std::optional<char>> range_end = optional_result(try_(char_('-') >> member));
+            Parser<std::optional<char>> negation = optional_result(char_('^'));
+
+            return peg_token(CPPARSEC_MAKE(Parser<PegExpr>) {
+                CPPARSEC_SKIP(char_('['));
+                CPPARSEC_SAVE(negated, negation);
+
+                PegExpr expr = peg_node(PegExpr::Kind::set);
+                while (!input.empty() && input[0] != ']') {
+                    CPPARSEC_SAVE(low, member);
+                    CPPARSEC_SAVE(high, range_end);
+                    const unsigned first = static_cast<unsigned char>(low);
+                    const unsigned last = static_cast<unsigned char>(high.value_or(low));
+                    CPPARSEC_FAIL_IF(first > last, ParseError<char>("class range in order", std::string{ low, '-', *high }));
+                    for (unsigned c = first; c <= last; c++) {
+                        expr.set[c] = true;
+                    }
+                }
+                CPPARSEC_SKIP(char_(']'));
+
+                if (negated) {
+                    expr.set.flip();
+                }
+                return expr;
+            });
+        }
+
+        inline Parser<PegExpr> peg_expression();
+        inline Parser<PegExpr> peg_suffixed();
+
+        inline Parser<PegExpr> peg_primary() {
+            Parser<std::string> capture_name = try_(peg_identifier() << peg_token(char_(':')) << not_followed_by(char_(':') | char_('=')));
+            Parser<PegExpr> capture = (capture_name & lazy(peg_suffixed)).transform([](std::tuple<std::string, PegExpr> parts) {
+                PegExpr expr = peg_node(PegExpr::Kind::capture, { std::move(std::get<1>(parts)) });
+                expr.text = std::move(std::get<0>(parts));
+                return expr;
+            });
+            Parser<PegExpr> reference = try_(peg_identifier() << not_followed_by(peg_definition_operator())).transform([](std::string name) {
+                PegExpr expr = peg_node(PegExpr::Kind::rule);
+                expr.text = std::move(name);
+                return expr;
+            });
+            Parser<PegExpr> group = peg_token(char_('(')) >> lazy(peg_expression) << peg_token(char_(')'));
+            Parser<PegExpr> any = peg_token(char_('.')).transform([](char) { return peg_node(PegExpr::Kind::any); });
+
+            return capture | reference | group | peg_literal() | peg_class() | any;
+        }
+
+        // A primary with its suffixes
+        inline Parser<PegExpr> peg_suffixed() {
+            Parser<char> suffix = peg_token(char_('?') | char_('*') | char_('+'));
+            return (peg_primary() & many(suffix)).transform([](std::tuple<PegExpr, std::string> parts) {
+                PegExpr expr = std::move(std::get<0>(parts));
+                for (char c : std::get<1>(parts)) {
+                    const PegExpr::Kind kind = c == '?' ? PegExpr::Kind::optional : c == '*' ? PegExpr::Kind::many : PegExpr::Kind::many1;
+                    expr = peg_node(kind, { std::move(expr) });
+                }
+                return expr;
+            });
+        }
+
+        // A primary with its suffixes, and a predicate before it
+        inline Parser<PegExpr> peg_prefixed() {
+            Parser<char> predicate = peg_token(char_('&') | char_('!'));
+            return (optional_result(predicate) & peg_suffixed()).transform([](std::tuple<std::optional<char>, PegExpr> parts) {
+                const std::optional<char> predicate = std::get<0>(parts);
+                if (!predicate) {
+                    return std::move(std::get<1>(parts));
+                }
+                return peg_node(*predicate == '&' ? PegExpr::Kind::and_ : PegExpr::Kind::not_, { std::move(std::get<1>(parts)) });
+            });
+        }
+
+        inline Parser<PegExpr> peg_expression() {
+            // a sequence or choice of one expression is that expression
+            auto single = [](PegExpr::Kind kind) {
+                return [kind](std::vector<PegExpr> children) {
+                    return children.size() == 1 ? std::move(children[0]) : peg_node(kind, std::move(children));
+                };
+            };
+            Parser<PegExpr> sequence = many(peg_prefixed()).transform(single(PegExpr::Kind::sequence));
+            return sep_by1(sequence, peg_token(char_('/') | char_('|'))).transform(single(PegExpr::Kind::choice));
+        }
+
+        inline Parser<std::vector<PegRule>> peg_grammar() {
+            Parser<PegRule> definition = ((peg_identifier() << peg_definition_operator()) & peg_expression() << optional_(peg_token(char_(';'))))
+                .transform([](std::tuple<std::string, PegExpr> parts) {
+                    return PegRule{ std::move(std::get<0>(parts)), std::move(std::get<1>(parts)) };
+                });
+            return peg_spacing() >> many1(definition) << eof();
+        }
+    };
+
+    // =============================== Analysis ===================================
+
+    namespace detail {
+        // Resolves the rule references of expr, failing on an undefined one
+        inline ParseResult<std::monostate> peg_resolve(PegExpr& expr, const std::vector<PegRule>& rules, const std::string& rule) {
+            if (expr.kind == PegExpr::Kind::rule) {
+                auto found = std::ranges::find(rules, expr.text, &PegRule::name);
+                CPPARSEC_FAIL_IF(found == rules.end(), ParseError<char>("a rule defined in " + rule, "undefined rule " + expr.text));
+                expr.rule = found - rules.begin();
+            }
+            for (PegExpr& child : expr.children) {
+                if (auto resolved = peg_resolve(child, rules, rule); !resolved) {
+                    return resolved;
+                }
+            }
+            return std::monostate{};
+        }
+
+        // Whether expr can match without consuming input, given whether each rule can
+        inline bool peg_nullable(const PegExpr& expr, const std::vector<bool>& rules) {
+            using Kind = PegExpr::Kind;
+            switch (expr.kind) {
+            case Kind::rule:
+                return rules[expr.rule];
+            case Kind::literal:
+                return expr.text.empty();
+            case Kind::set:
+            case Kind::any:
+                return false;
+            case Kind::sequence:
+                return std::ranges::all_of(expr.children, [&](const PegExpr& child) { return peg_nullable(child, rules); });
+            case Kind::choice:
+                return std::ranges::any_of(expr.children, [&](const PegExpr& child) { return peg_nullable(child, rules); });
+            case Kind::many1:
+            case Kind::capture:
+                return peg_nullable(expr.children[0], rules);
+            default:
+                return true;
+            }
+        }
+
+        // Adds the rules expr may call before consuming input to calls
+        inline void peg_left_calls(const PegExpr& expr, const std::vector<bool>& nullable, std::vector<size_t>& calls) {
+            if (expr.kind == PegExpr::Kind::rule) {
+                calls.push_back(expr.rule);
+            }
+            for (const PegExpr& child : expr.children) {
+                peg_left_calls(child, nullable, calls);
+                if (expr.kind == PegExpr::Kind::sequence && !peg_nullable(child, nullable)) {
+                    break;
+                }
+            }
+        }
+
+        // Adds the rules expr calls to calls
+        inline void peg_calls(const PegExpr& expr, std::vector<size_t>& calls) {
+            if (expr.kind == PegExpr::Kind::rule) {
+                calls.push_back(expr.rule);
+            }
+            for (const PegExpr& child : expr.children) {
+                peg_calls(child, calls);
+            }
+        }
+
+        // Whether to is reachable from from in graph, by at least one edge
+        inline bool peg_reaches(const std::vector<std::vector<size_t>>& graph, size_t from, size_t to) {
+            std::vector<bool> seen(graph.size());
+            std::vector<size_t> pending = graph[from];
+            while (!pending.empty()) {
+                const size_t rule = pending.back();
+                pending.pop_back();
+                if (rule == to) {
+                    return true;
+                }
+                if (!seen[rule]) {
+                    seen[rule] = true;
+                    pending.insert(pending.end(), graph[rule].begin(), graph[rule].end());
+                }
+            }
+            return false;
+        }
+
+        // Fails on a repetition of an expression that can match nothing, which would loop forever
+        inline ParseResult<std::monostate> peg_check_repetitions(const PegExpr& expr, const std::vector<bool>& nullable, const std::string& rule) {
+            const bool repeats = expr.kind == PegExpr::Kind::many || expr.kind == PegExpr::Kind::many1;
+            CPPARSEC_FAIL_IF(repeats && peg_nullable(expr.children[0], nullable),
+                ParseError<char>("a repetition consuming input in " + rule, "a repetition of an expression that can match nothing"));
+            for (const PegExpr& child : expr.children) {
+                if (auto checked = peg_check_repetitions(child, nullable, rule); !checked) {
+                    return checked;
+                }
+            }
+            return std::monostate{};
+        }
+
+        // Resolves and checks the rules of a grammar, returning whether each rule can match nothing
+        inline ParseResult<std::vector<bool>> peg_analyze(std::vector<PegRule>& rules) {
+            for (size_t i = 0; i < rules.size(); i++) {
+                auto defined = std::ranges::find(rules, rules[i].name, &PegRule::name);
+                CPPARSEC_FAIL_IF(defined - rules.begin() != static_cast<ptrdiff_t>(i),
+                    ParseError<char>("one definition of " + rules[i].name, "another definition"));
+                if (auto resolved = peg_resolve(rules[i].expr, rules, rules[i].name); !resolved) {
+                    return std::unexpected(resolved.error());
+                }
+            }
+
+            std::vector<bool> nullable(rules.size());
+            for (bool changed = true; changed; ) {
+                changed = false;
+                for (size_t i = 0; i < rules.size(); i++) {
+                    if (!nullable[i] && peg_nullable(rules[i].expr, nullable)) {
+                        nullable[i] = changed = true;
+                    }
+                }
+            }
+
+            std::vector<std::vector<size_t>> left_calls(rules.size());
+            for (size_t i = 0; i < rules.size(); i++) {
+                peg_left_calls(rules[i].expr, nullable, left_calls[i]);
+            }
+            for (size_t i = 0; i < rules.size(); i++) {
+                CPPARSEC_FAIL_IF(peg_reaches(left_calls, i, i),
+                    ParseError<char>("a rule consuming input before calling itself", "left recursive rule " + rules[i].name));
+                if (auto checked = peg_check_repetitions(rules[i].expr, nullable, rules[i].name); !checked) {
+                    return std::unexpected(checked.error());
+                }
+            }
+            return nullable;
+        }
+    };
+
+    // =============================== Compiler ===================================
+
+    namespace detail {
+        // Compiles the analyzed rules of a grammar to a program matching the first rule
+        class PegCompiler {
+        public:
+            PegProgram peg;
+
+            explicit PegCompiler(const std::vector<PegRule>& rules);
+
+            // Emits the start rule as a capture named after it, then the rules called
+            void compile();
+
+        private:
+            static constexpr uint32_t no_entry = UINT32_MAX;
+
+            const std::vector<PegRule>& rules;
+            std::vector<bool> recursive;
+            std::vector<size_t> references;
+            std::vector<uint32_t> entries;                   // of rules emitted as subroutines
+            std::vector<std::pair<uint32_t, size_t>> calls;  // calls to patch, with the rule they call
+            std::vector<size_t> pending;                     // rules called but not yet emitted
+
+            uint32_t emit(VmOp op, uint32_t arg = 0) {
+                peg.program.code.push_back({ op, arg });
+                return static_cast<uint32_t>(peg.program.code.size() - 1);
+            }
+
+            uint32_t here() const {
+                return static_cast<uint32_t>(peg.program.code.size());
+            }
+
+            // Rules that aren't recursive, and are used once or small, are compiled where they are used
+            bool inlined(size_t rule) const;
+
+            // The bytes of expr if it matches one byte of a set
+            std::optional<std::bitset<256>> byte_set(const PegExpr& expr) const;
+
+            // The text of expr if it matches a literal
+            std::optional<std::string> literal(const PegExpr& expr) const;
+
+            void emit_set(const std::bitset<256>& bytes, VmOp op);
+            void emit_literal(const std::string& text);
+            void emit_capture(const std::string& name, auto&& body);
+
+            void expression(const PegExpr& expr);
+            void sequence(const PegExpr& expr);
+            void choice(const PegExpr& expr);
+            void repetition(const PegExpr& expr);
+            void call(size_t rule);
+        };
+
+        inline size_t peg_size(const PegExpr& expr) {
+            size_t size = 1;
+            for (const PegExpr& child : expr.children) {
+                size += peg_size(child);
+            }
+            return size;
+        }
+
+        // The alternatives of nested choices, or the steps of nested sequences, in order
+        inline void peg_flatten(const PegExpr& expr, PegExpr::Kind kind, std::vector<const PegExpr*>& parts) {
+            if (expr.kind != kind) {
+                parts.push_back(&expr);
+                return;
+            }
+            for (const PegExpr& child : expr.children) {
+                peg_flatten(child, kind, parts);
+            }
+        }
+
+        inline PegCompiler::PegCompiler(const std::vector<PegRule>& rules) :
+            rules(rules),
+            recursive(rules.size()),
+            references(rules.size()),
+            entries(rules.size(), no_entry)
+        {
+            std::vector<std::vector<size_t>> graph(rules.size());
+            for (size_t i = 0; i < rules.size(); i++) {
+                peg_calls(rules[i].expr, graph[i]);
+                for (size_t called : graph[i]) {
+                    references[called]++;
+                }
+            }
+            for (size_t i = 0; i < rules.size(); i++) {
+                recursive[i] = peg_reaches(graph, i, i);
+            }
+        }
+
+        inline bool PegCompiler::inlined(size_t rule) const {
+            return !recursive[rule] && (references[rule] <= 1 || peg_size(rules[rule].expr) <= 8);
+        }
+
+        inline std::optional<std::bitset<256>> PegCompiler::byte_set(const PegExpr& expr) const {
+            using Kind = PegExpr::Kind;
+            switch (expr.kind) {
+            case Kind::set:
+                return expr.set;
+            case Kind::any:
+                return std::bitset<256>().set();
+            case Kind::literal:
+                if (expr.text.size() == 1) {
+                    return std::bitset<256>().set(static_cast<unsigned char>(expr.text[0]));
+                }
+                return std::nullopt;
+            case Kind::rule:
+                if (!recursive[expr.rule]) {
+                    return byte_set(rules[expr.rule].expr);
+                }
+                return std::nullopt;
+            case Kind::choice: {
+                std::bitset<256> bytes;
+                for (const PegExpr& child : expr.children) {
+                    std::optional<std::bitset<256>> alternative = byte_set(child);
+                    if (!alternative) {
+                        return std::nullopt;
+                    }
+                    bytes |= *alternative;
+                }
+                return bytes;
+            }
+            default:
+                return std::nullopt;
+            }
+        }
+
+        inline std::optional<std::string> PegCompiler::literal(const PegExpr& expr) const {
+            if (expr.kind == PegExpr::Kind::literal) {
+                return expr.text;
+            }
+            if (expr.kind == PegExpr::Kind::rule && !recursive[expr.rule]) {
+                return literal(rules[expr.rule].expr);
+            }
+            if (expr.kind == PegExpr::Kind::sequence) {
+                std::string text;
+                for (const PegExpr& child : expr.children) {
+                    std::optional<std::string> step = literal(child);
+                    if (!step) {
+                        return std::nullopt;
+                    }
+                    text += *step;
+                }
+                return text;
+            }
+            return std::nullopt;
+        }
+
+        inline void PegCompiler::emit_set(const std::bitset<256>& bytes, VmOp op) {
+            if (op == VmOp::set && bytes.count() == 1) {
+                unsigned byte = 0;
+                while (!bytes[byte]) {
+                    byte++;
+                }
+                emit(VmOp::atom, byte);
+                return;
+            }
+            if (op == VmOp::set && bytes.all()) {
+                emit(VmOp::any);
+                return;
+            }
+
+            // the class of a char_class node testing the bytes
+            auto node = std::make_shared<GrammarNode<char>>();
+            node->kind = GrammarKind::char_class;
+            node->predicate = [bytes](char c) { return bytes[static_cast<unsigned char>(c)]; };
+            node->label = "<class>";
+            node->pure = true;
+            peg.program.classes.emplace_back(std::vector<NodePtr<char>>{ node });
+            emit(op, static_cast<uint32_t>(peg.program.classes.size() - 1));
+        }
+
+        inline void PegCompiler::emit_literal(const std::string& text) {
+            if (text.size() == 1) {
+                emit(VmOp::atom, static_cast<unsigned char>(text[0]));
+            }
+            else if (!text.empty()) {
+                peg.program.literals.push_back(text);
+                emit(VmOp::literal, static_cast<uint32_t>(peg.program.literals.size() - 1));
+            }
+        }
+
+        inline void PegCompiler::emit_capture(const std::string& name, auto&& body) {
+            size_t index = peg.name_index(name);
+            if (index == peg.names.size()) {
+                peg.names.push_back(name);
+            }
+
+            emit(VmOp::tag, static_cast<uint32_t>(index + 1));
+            emit(VmOp::position);
+            body();
+            emit(VmOp::tag, 0);
+            emit(VmOp::position);
+        }
+
+        inline void PegCompiler::compile() {
+            const size_t start = 0;
+            emit_capture(peg.start, [&] { call(start); });
+            emit(VmOp::end);
+
+            while (!pending.empty()) {
+                const size_t rule = pending.back();
+                pending.pop_back();
+                entries[rule] = here();
+                expression(rules[rule].expr);
+                emit(VmOp::ret);
+            }
+            for (auto [at, rule] : calls) {
+                peg.program.code[at].arg = entries[rule];
+            }
+        }
+
+        inline void PegCompiler::call(size_t rule) {
+            if (inlined(rule)) {
+                expression(rules[rule].expr);
+                return;
+            }
+
+            if (entries[rule] == no_entry && std::ranges::find(pending, rule) == pending.end()) {
+                pending.push_back(rule);
+            }
+            calls.emplace_back(emit(VmOp::call), rule);
+        }
+
+        inline void PegCompiler::expression(const PegExpr& expr) {
+            using Kind = PegExpr::Kind;
+            if (std::optional<std::bitset<256>> bytes = byte_set(expr)) {
+                emit_set(*bytes, VmOp::set);
+                return;
+            }
+            if (std::optional<std::string> text = literal(expr)) {
+                emit_literal(*text);
+                return;
+            }
+
+            switch (expr.kind) {
+            case Kind::rule:
+                call(expr.rule);
+                break;
+            case Kind::sequence:
+                sequence(expr);
+                break;
+            case Kind::choice:
+                choice(expr);
+                break;
+            case Kind::optional: {
+                const uint32_t backtrack = emit(VmOp::backtrack);
+                expression(expr.children[0]);
+                emit(VmOp::commit, here() + 1);
+                peg.program.code[backtrack].arg = here();
+                break;
+            }
+            case Kind::many:
+            case Kind::many1:
+                repetition(expr);
+                break;
+            case Kind::and_:
+                emit(VmOp::look);
+                expression(expr.children[0]);
+                emit(VmOp::end_look);
+                break;
+            case Kind::not_: {
+                const uint32_t not_ = emit(VmOp::not_);
+                expression(expr.children[0]);
+                emit(VmOp::end_not);
+                peg.program.code[not_].arg = here();
+                break;
+            }
+            case Kind::capture:
+                emit_capture(expr.text, [&] { expression(expr.children[0]); });
+                break;
+            default:
+                break;
+            }
+        }
+
+        inline void PegCompiler::sequence(const PegExpr& expr) {
+            // adjacent literals are one literal
+            std::vector<const PegExpr*> steps;
+            peg_flatten(expr, PegExpr::Kind::sequence, steps);
+
+            std::string text;
+            for (const PegExpr* step : steps) {
+                if (std::optional<std::string> literal_step = literal(*step)) {
+                    text += *literal_step;
+                    continue;
+                }
+                emit_literal(text);
+                text.clear();
+                expression(*step);
+            }
+            emit_literal(text);
+        }
+
+        inline void PegCompiler::choice(const PegExpr& expr) {
+            std::vector<const PegExpr*> alternatives;
+            peg_flatten(expr, PegExpr::Kind::choice, alternatives);
+
+            // the first literal matching is the longest when none is a prefix of a later one
+            std::vector<std::string> words;
+            for (const PegExpr* alternative : alternatives) {
+                std::optional<std::string> text = literal(*alternative);
+                const bool prefix = text && std::ranges::any_of(words, [&](const std::string& word) { return text->starts_with(word); });
+                if (!text || text->empty() || prefix) {
+                    break;
+                }
+                words.push_back(*text);
+            }
+            if (words.size() == alternatives.size() && words.size() > 2) {
+                peg.program.keyword_sets.emplace_back(words, false);
+                emit(VmOp::keywords, static_cast<uint32_t>(peg.program.keyword_sets.size() - 1));
+                return;
+            }
+
+            // consecutive one byte alternatives are one set
+            std::vector<std::vector<const PegExpr*>> groups;
+            for (const PegExpr* alternative : alternatives) {
+                if (groups.empty() || !byte_set(*alternative) || !byte_set(*groups.back().back())) {
+                    groups.emplace_back();
+                }
+                groups.back().push_back(alternative);
+            }
+
+            std::vector<uint32_t> commits;
+            for (size_t i = 0; i < groups.size(); i++) {
+                const bool last = i + 1 == groups.size();
+                const uint32_t backtrack = last ? 0 : emit(VmOp::backtrack);
+                if (groups[i].size() > 1) {
+                    std::bitset<256> bytes;
+                    for (const PegExpr* alternative : groups[i]) {
+                        bytes |= *byte_set(*alternative);
+                    }
+                    emit_set(bytes, VmOp::set);
+                }
+                else {
+                    expression(*groups[i][0]);
+                }
+
+                if (!last) {
+                    commits.push_back(emit(VmOp::commit));
+                    peg.program.code[backtrack].arg = here();
+                }
+            }
+            for (uint32_t commit : commits) {
+                peg.program.code[commit].arg = here();
+            }
+        }
+
+        inline void PegCompiler::repetition(const PegExpr& expr) {
+            const PegExpr& p = expr.children[0];
+            if (expr.kind == PegExpr::Kind::many1) {
+                expression(p);
+            }
+
+            // a repetition of a byte set is a span of its class
+            if (std::optional<std::bitset<256>> bytes = byte_set(p)) {
+                emit_set(*bytes, VmOp::span);
+                return;
+            }
+
+            const uint32_t top = emit(VmOp::backtrack);
+            expression(p);
+            emit(VmOp::commit, top);
+            peg.program.code[top].arg = here();
+        }
+    };
+
+    // ============================ Captures and Fields ===========================
+
+    inline const Capture* Capture::find(std::string_view name) const {
+        auto found = std::ranges::find(children, name, &Capture::name);
+        return found == children.end() ? nullptr : &*found;
+    }
+
+    inline std::string_view Fields::operator[](std::string_view name) const {
+        const size_t index = program->name_index(name);
+        return index < texts.size() ? texts[index].value_or(std::string_view()) : std::string_view();
+    }
+
+    inline bool Fields::contains(std::string_view name) const {
+        const size_t index = program->name_index(name);
+        return index < texts.size() && texts[index].has_value();
+    }
+
+    // ================================ Grammars ==================================
+
+    inline const std::string& Grammar::start() const {
+        return program->start;
+    }
+
+    inline Parser<Capture> Grammar::captures() const {
+        std::shared_ptr<const detail::PegProgram> program = this->program;
+        return CPPARSEC_MAKE(Parser<Capture>) {
+            detail::VmStackLease lease;
+            detail::VmStacks& stacks = *lease;
+            size_t position = 0;
+            CPPARSEC_FAIL_IF(!program->program.run(input, stacks, position), program->error(input, position));
+
+            // the captures open with their tag and start, and close with tag 0 and their end
+            Capture root;
+            std::vector<Capture*> open;
+            const std::vector<size_t>& captures = stacks.captures;
+            for (size_t i = 0; i < captures.size(); i += 2) {
+                const size_t tag = captures[i];
+                const size_t at = captures[i + 1];
+                if (tag == 0) {
+                    Capture& closed = *open.back();
+                    closed.text = std::string_view(closed.text.data(), input.data() + at - closed.text.data());
+                    open.pop_back();
+                    continue;
+                }
+
+                Capture& capture = open.empty() ? root : open.back()->children.emplace_back();
+                capture.name = program->names[tag - 1];
+                capture.text = std::string_view(input.data() + at, 0);
+                open.push_back(&capture);
+            }
+
+            input.remove_prefix(position);
+            return root;
+        };
+    }
+
+    inline Parser<Fields> Grammar::fields() const {
+        std::shared_ptr<const detail::PegProgram> program = this->program;
+        return CPPARSEC_MAKE(Parser<Fields>) {
+            detail::VmStackLease lease;
+            detail::VmStacks& stacks = *lease;
+            size_t position = 0;
+            CPPARSEC_FAIL_IF(!program->program.run(input, stacks, position), program->error(input, position));
+
+            Fields fields;
+            fields.program = program;
+            fields.texts.resize(program->names.size());
+
+            // starts of the open captures, with their name index
+            std::vector<std::pair<size_t, size_t>> open;
+            const std::vector<size_t>& captures = stacks.captures;
+            for (size_t i = 0; i < captures.size(); i += 2) {
+                const size_t tag = captures[i];
+                const size_t at = captures[i + 1];
+                if (tag == 0) {
+                    auto [index, start] = open.back();
+                    fields.texts[index] = std::string_view(input.data() + start, at - start);
+                    open.pop_back();
+                }
+                else {
+                    open.emplace_back(tag - 1, at);
+                }
+            }
+
+            input.remove_prefix(position);
+            return fields;
+        };
+    }
+
+    inline ParseResult<Grammar> load_grammar(std::string_view text) {
+        ParseResult<std::vector<detail::PegRule>> rules = detail::peg_grammar().parse(text);
+        if (!rules) {
+            return std::unexpected(rules.error());
+        }
+        if (auto analyzed = detail::peg_analyze(*rules); !analyzed) {
+            return std::unexpected(analyzed.error());
+        }
+
+        detail::PegCompiler compiler(*rules);
+        compiler.peg.start = (*rules)[0].name;
+        compiler.compile();
+
+        Grammar grammar;
+        grammar.program = std::make_shared<const detail::PegProgram>(std::move(compiler.peg));
+        return grammar;
+    }
+};
+
+#endif /* CPPARSEC_PEG_H */
@@ -0,0 +1,1117 @@
+#ifndef CPPARSEC_SIMD_H
+#define CPPARSEC_SIMD_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <expected>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CPPARSEC_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(__SSSE3__) || defined(__AVX__)
+#define CPPARSEC_SSSE3 1
+#include <tmmintrin.h>
+#endif
+
+// cpparsec_simd: low level scanning kernels used by the leaf parsers
+//     SSE2 when available, with a scalar fallback for every kernel
+
+namespace cpparsec::detail {
+
+    // ============================ LITERAL SEARCH ============================
+
+    // Searches for a fixed literal, built once per parser
+    // Short literals use a first-byte-pair SIMD scan verified with memcmp,
+    // long literals use Horspool with a precomputed skip table
+    class LiteralSearcher {
+    public:
+        static constexpr size_t npos = std::string_view::npos;
+
+        // literals longer than this use Horspool
+        static constexpr size_t horspool_threshold = 16;
+
+        LiteralSearcher(std::string needle);
+
+        // Returns the index of the first occurence of the literal, or npos
+        size_t find(std::string_view haystack) const;
+
+        const std::string& literal() const { return needle; }
+
+    private:
+        std::string needle;
+        std::array<size_t, 256> skip{};
+
+        size_t find_pair(std::string_view haystack) const;
+        size_t find_horspool(std::string_view haystack) const;
+    };
+
+    // ============================= CASE FOLDING =============================
+
+    // Matches a fixed literal at a position, optionally ignoring ASCII case
+    // Letters compare as (byte | 0x20) against the lowercased literal, so
+    // one OR and one compare check 16 bytes (SSE2) or 8 bytes (SWAR) at a time
+    class CaseFoldMatcher {
+    public:
+        CaseFoldMatcher(std::string literal, bool fold_case = true);
+
+        // True if the literal matches the first size() bytes of data, which must be readable
+        bool match(const char* data) const;
+
+        size_t size() const { return folded.size(); }
+        const std::string& literal() const { return original; }
+
+    private:
+        std::string original;
+        std::string folded; // letters lowercased when folding case
+        std::string mask;   // 0x20 over letters when folding case, 0 elsewhere
+    };
+
+    // A set of literals matched longest first, bucketed by their first byte
+    class KeywordSet {
+    public:
+        static constexpr size_t npos = std::string_view::npos;
+
+        KeywordSet(const std::vector<std::string>& words, bool fold_case);
+
+        // Returns the length of the longest keyword at the start of input, or npos
+        // readable is the number of bytes that may be loaded from input.data()
+        size_t match(std::string_view input, size_t readable) const;
+
+        // Returns the index in words of the longest keyword at the start of input, or npos
+        size_t find(std::string_view input, size_t readable) const;
+
+        // Keywords listed for error messages
+        const std::string& description() const { return expected; }
+
+    private:
+        std::vector<CaseFoldMatcher> matchers;
+        std::vector<uint32_t> words;          // index in words of each matcher
+        std::array<std::vector<uint32_t>, 256> buckets;
+        size_t empty_word = npos;             // index in words of an empty keyword
+
+        // Index of the longest matcher matching at the start of input, or npos
+        size_t longest(std::string_view input, size_t readable) const;
+        std::string expected;
+    };
+
+    // ============================= BYTE CLASSES ============================
+
+    // A set of bytes, e.g. the separators of a list
+    // Runs of up to 4 distinct members are skipped 16 bytes at a time
+    class ByteClass {
+    public:
+        explicit ByteClass(std::string_view members);
+
+        bool contains(char c) const { return table[static_cast<unsigned char>(c)]; }
+
+        // Returns the length of the leading run of members of s
+        size_t span(std::string_view s) const;
+
+        // Returns the length of the leading run of non-members of s
+        size_t find(std::string_view s) const;
+
+    private:
+        static constexpr size_t simd_members = 4;
+
+        std::array<bool, 256> table{};
+        std::string members;
+    };
+
+    // ============================ DECIMAL DIGITS ============================
+
+    inline constexpr uint64_t powers_of_ten_u64[] = {
+        1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull,
+        1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull,
+        100000000000000ull, 1000000000000000ull, 10000000000000000ull, 100000000000000000ull,
+        1000000000000000000ull, 10000000000000000000ull
+    };
+
+    // A leading run of digits and its value
+    struct DigitRun {
+        uint64_t value;
+        size_t length;
+        bool overflow; // value didn't fit in uint64_t, length still covers every digit
+    };
+
+    // Loads 8 bytes as a little endian word
+    inline uint64_t load_le64(const char* data);
+
+    // Number of leading '0'..'9' bytes of a little endian word
+    constexpr size_t leading_digit_count(uint64_t chunk);
+
+    // True if all 8 bytes of a little endian word are '0'..'9'
+    constexpr bool is_eight_digits(uint64_t chunk);
+
+    // Converts 8 ASCII digits in a little endian word, the first digit in the low byte
+    constexpr uint32_t parse_eight_digits(uint64_t chunk);
+
+    // Parses the leading decimal digits of s, 8 at a time with a SWAR kernel
+    // readable is the number of bytes that may be loaded from s.data(), bytes past
+    // s.size() must not be digits, as with the zero padding of PaddedInput
+    inline DigitRun decimal_run(std::string_view s, size_t readable);
+
+    // ============================== HEX DIGITS ==============================
+
+    // Value of a hex digit in either case, 0xFF for anything else
+    constexpr uint8_t hex_digit_value(char c);
+
+    // Number of leading hex digits of a little endian word
+    constexpr size_t leading_hex_digit_count(uint64_t chunk);
+
+    // Converts 8 ASCII hex digits in a little endian word, the first digit in the low byte
+    constexpr uint32_t parse_eight_hex_digits(uint64_t chunk);
+
+    // Parses the leading hex digits of s, 8 at a time with a SWAR kernel
+    // readable is as for decimal_run
+    inline DigitRun hex_run(std::string_view s, size_t readable);
+
+    // Parses the leading digits of s in base 2^bits, 3 for octal and 1 for binary
+    inline DigitRun radix_run(std::string_view s, int bits);
+
+    // Decodes pairs of hex digits into out, hex.size() / 2 bytes, 16 digits at a time
+    // Returns the index of the first invalid digit, or npos if all of hex was decoded
+    // An unpaired last digit counts as invalid
+    inline size_t hex_decode(std::string_view hex, uint8_t* out);
+
+    // ================================ BASE64 ================================
+
+    // 6 bit values of the standard and URL safe base64 alphabets, 0xFF for other bytes
+    constexpr std::array<uint8_t, 256> make_base64_table(bool url);
+
+    // Decodes whole 4 digit quanta from the start of s into out, 16 digits at a time
+    // Stops at the first quantum that isn't 4 base64 digits and returns the digits decoded,
+    // out must have room for s.size() / 4 * 3 bytes
+    inline size_t base64_decode_quanta(std::string_view s, bool url, uint8_t* out);
+
+    // ============================ QUOTED STRINGS ============================
+
+    // Returns the length of the leading run of s without quote, escape or, with
+    // stop_at_controls, bytes below 0x20, 16 bytes at a time
+    inline size_t plain_string_run(std::string_view s, char quote, char escape, bool stop_at_controls);
+
+    // ============================== DATE TIMES ==============================
+
+    // Fields of a "YYYY-MM-DDTHH:MM:SS" date and time, not range checked
+    struct DateTimeFields {
+        unsigned year, month, day, hour, minute, second;
+    };
+
+    // Decodes the fixed 19 byte layout "YYYY-MM-DDTHH:MM:SS" from three overlapping loads
+    // The '-' and ':' separators are checked in one masked compare, the date/time
+    // separator at offset 10 differs between formats and is left to the caller
+    // 19 bytes must be readable from data
+    inline std::optional<DateTimeFields> date_time_fields(const char* data);
+
+    // ================================ UTF-8 =================================
+
+    struct Utf8Char {
+        char32_t codepoint;
+        size_t length;
+    };
+
+    // Returns the length of the leading run of ASCII bytes
+    inline size_t ascii_prefix_length(std::string_view s);
+
+    // Decodes one UTF-8 sequence, rejecting overlong forms, surrogates and values past U+10FFFF
+    // On failure returns the byte offset of the first invalid byte
+    inline std::expected<Utf8Char, size_t> utf8_decode(std::string_view s);
+
+    // Returns the byte offset of the first invalid byte of s, or npos if s is valid UTF-8
+    inline size_t utf8_validate(std::string_view s);
+
+    // ========================================================================
+    //
+    // ============================ IMPLEMENTATIONS ===========================
+    //
+    // ========================================================================
+
+    inline LiteralSearcher::LiteralSearcher(std::string needle) : needle(std::move(needle)) {
+        const size_t n = this->needle.size();
+        if (n > horspool_threshold) {
+            skip.fill(n);
+            for (size_t i = 0; i + 1 < n; i++) {
+                skip[static_cast<unsigned char>(this->needle[i])] = n - 1 - i;
+            }
+        }
+    }
+
+    // Returns the index of the first occurence of the literal, or npos
+    inline size_t LiteralSearcher::find(std::string_view haystack) const {
+        const size_t n = needle.size();
+
+        if (n == 0) {
+            return 0;
+        }
+        if (n > haystack.size()) {
+            return npos;
+        }
+        if (n == 1) {
+            const void* found = std::memchr(haystack.data(), needle[0], haystack.size());
+            return found ? static_cast<const char*>(found) - haystack.data() : npos;
+        }
+        if (n > horspool_threshold) {
+            return find_horspool(haystack);
+        }
+
+        return find_pair(haystack);
+    }
+
+    // Scans for the first two bytes of the literal at once, verifying candidates
+    inline size_t LiteralSearcher::find_pair(std::string_view haystack) const {
+        const char* data = haystack.data();
+        const size_t n = needle.size();
+        const size_t last = haystack.size() - n; // last valid starting index
+        size_t i = 0;
+
+#ifdef CPPARSEC_SSE2
+        const __m128i first = _mm_set1_epi8(needle[0]);
+        const __m128i second = _mm_set1_epi8(needle[1]);
+
+        // the shifted load reads data[i + 16], so stop one block early
+        for (; i + 16 < haystack.size(); i += 16) {
+            __m128i block0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            __m128i block1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 1));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+                _mm_and_si128(_mm_cmpeq_epi8(block0, first), _mm_cmpeq_epi8(block1, second))));
+
+            while (mask != 0) {
+                size_t pos = i + std::countr_zero(mask);
+                if (pos > last) {
+                    return npos;
+                }
+                if (std::memcmp(data + pos + 2, needle.data() + 2, n - 2) == 0) {
+                    return pos;
+                }
+                mask &= mask - 1;
+            }
+        }
+#endif
+
+        while (i <= last) {
+            const void* found = std::memchr(data + i, needle[0], last - i + 1);
+            if (!found) {
+                return npos;
+            }
+
+            size_t pos = static_cast<const char*>(found) - data;
+            if (data[pos + 1] == needle[1] && std::memcmp(data + pos + 2, needle.data() + 2, n - 2) == 0) {
+                return pos;
+            }
+            i = pos + 1;
+        }
+
+        return npos;
+    }
+
+    // Horspool search, compares the last byte of the window first
+    inline size_t LiteralSearcher::find_horspool(std::string_view haystack) const {
+        const char* data = haystack.data();
+        const size_t n = needle.size();
+        const char last_char = needle[n - 1];
+
+        for (size_t i = 0; i + n <= haystack.size(); ) {
+            char c = data[i + n - 1];
+            if (c == last_char && std::memcmp(data + i, needle.data(), n - 1) == 0) {
+                return i;
+            }
+            i += skip[static_cast<unsigned char>(c)];
+        }
+
+        return npos;
+    }
+
+    // ============================= CASE FOLDING =============================
+
+    inline CaseFoldMatcher::CaseFoldMatcher(std::string literal, bool fold_case) :
+        original(std::move(literal)),
+        folded(original),
+        mask(original.size(), '\0')
+    {
+        if (fold_case) {
+            for (size_t i = 0; i < folded.size(); i++) {
+                char lowered = static_cast<char>(folded[i] | 0x20);
+                if (lowered >= 'a' && lowered <= 'z') {
+                    folded[i] = lowered;
+                    mask[i] = 0x20;
+                }
+            }
+        }
+    }
+
+    // True if the literal matches the first size() bytes of data, which must be readable
+    inline bool CaseFoldMatcher::match(const char* data) const {
+        const size_t n = folded.size();
+        size_t i = 0;
+
+#ifdef CPPARSEC_SSE2
+        for (; i + 16 <= n; i += 16) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask.data() + i));
+            __m128i want = _mm_loadu_si128(reinterpret_cast<const __m128i*>(folded.data() + i));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128(block, bits), want)) != 0xFFFF) {
+                return false;
+            }
+        }
+#endif
+
+        for (; i + 8 <= n; i += 8) {
+            uint64_t block, bits, want;
+            std::memcpy(&block, data + i, 8);
+            std::memcpy(&bits, mask.data() + i, 8);
+            std::memcpy(&want, folded.data() + i, 8);
+            if ((block | bits) != want) {
+                return false;
+            }
+        }
+
+        for (; i < n; i++) {
+            if ((data[i] | mask[i]) != folded[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    inline KeywordSet::KeywordSet(const std::vector<std::string>& words, bool fold_case) {
+        for (uint32_t i = 0; i < words.size(); i++) {
+            const std::string& word = words[i];
+            if (word.empty()) {
+                empty_word = i;
+            }
+            else {
+                matchers.emplace_back(word, fold_case);
+                this->words.push_back(i);
+            }
+
+            expected += expected.empty() ? "one of " : ", ";
+            expected += "\"" + word + "\"";
+        }
+
+        // buckets hold matcher indices longest first, so the first match is the longest
+        for (uint32_t i = 0; i < matchers.size(); i++) {
+            unsigned char first = static_cast<unsigned char>(matchers[i].literal()[0]);
+            buckets[first].push_back(i);
+
+            unsigned char other_case = first ^ 0x20;
+            if (fold_case && (other_case | 0x20) >= 'a' && (other_case | 0x20) <= 'z') {
+                buckets[other_case].push_back(i);
+            }
+        }
+        for (auto& bucket : buckets) {
+            std::ranges::stable_sort(bucket, std::greater{}, [this](uint32_t i) { return matchers[i].size(); });
+        }
+    }
+
+    // Returns the length of the longest keyword at the start of input, or npos
+    inline size_t KeywordSet::match(std::string_view input, size_t readable) const {
+        size_t i = longest(input, readable);
+        if (i != npos) {
+            return matchers[i].size();
+        }
+
+        return empty_word != npos ? 0 : npos;
+    }
+
+    // Returns the index in words of the longest keyword at the start of input, or npos
+    inline size_t KeywordSet::find(std::string_view input, size_t readable) const {
+        size_t i = longest(input, readable);
+        return i != npos ? words[i] : empty_word;
+    }
+
+    // Index of the longest matcher matching at the start of input, or npos
+    inline size_t KeywordSet::longest(std::string_view input, size_t readable) const {
+        if (readable > 0) {
+            for (uint32_t i : buckets[static_cast<unsigned char>(input.data()[0])]) {
+                const CaseFoldMatcher& m = matchers[i];
+                // a match found in padding bytes still has to fit inside the input
+                if (m.size() <= readable && m.match(input.data()) && m.size() <= input.size()) {
+                    return i;
+                }
+            }
+        }
+
+        return npos;
+    }
+
+    // ============================= BYTE CLASSES ============================
+
+    inline ByteClass::ByteClass(std::string_view members) {
+        for (char c : members) {
+            if (!contains(c)) {
+                table[static_cast<unsigned char>(c)] = true;
+                this->members += c;
+            }
+        }
+    }
+
+    // Returns the length of the leading run of members of s
+    inline size_t ByteClass::span(std::string_view s) const {
+        // most runs are a single separator, settle those before any vector work
+        if (s.empty() || !contains(s[0])) {
+            return 0;
+        }
+        if (s.size() < 2 || !contains(s[1])) {
+            return 1;
+        }
+
+        size_t i = 2;
+
+#ifdef CPPARSEC_SSE2
+        if (members.size() <= simd_members) {
+            for (; i + 16 <= s.size(); i += 16) {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s.data() + i));
+                __m128i matches = _mm_setzero_si128();
+                for (char c : members) {
+                    matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, _mm_set1_epi8(c)));
+                }
+
+                unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(matches));
+                if (mask != 0xFFFF) {
+                    return i + std::countr_zero(~mask);
+                }
+            }
+        }
+#endif
+
+        while (i < s.size() && contains(s[i])) {
+            i++;
+        }
+        return i;
+    }
+
+    // Returns the length of the leading run of non-members of s
+    inline size_t ByteClass::find(std::string_view s) const {
+        size_t i = 0;
+
+#ifdef CPPARSEC_SSE2
+        if (members.size() <= simd_members) {
+            for (; i + 16 <= s.size(); i += 16) {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s.data() + i));
+                __m128i matches = _mm_setzero_si128();
+                for (char c : members) {
+                    matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, _mm_set1_epi8(c)));
+                }
+
+                unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(matches));
+                if (mask != 0) {
+                    return i + std::countr_zero(mask);
+                }
+            }
+        }
+#endif
+
+        while (i < s.size() && !contains(s[i])) {
+            i++;
+        }
+        return i;
+    }
+
+    // ============================ DECIMAL DIGITS ============================
+
+    // Loads 8 bytes as a little endian word
+    inline uint64_t load_le64(const char* data) {
+        uint64_t chunk;
+        std::memcpy(&chunk, data, 8);
+        if constexpr (std::endian::native == std::endian::big) {
+            chunk = std::byteswap(chunk);
+        }
+        return chunk;
+    }
+
+    // Number of leading '0'..'9' bytes of a little endian word
+    // Each digit byte maps to 0x33, carries out of non-digits only reach later bytes
+    constexpr size_t leading_digit_count(uint64_t chunk) {
+        uint64_t classes = (chunk & 0xF0F0F0F0F0F0F0F0) | (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4);
+        return static_cast<size_t>(std::countr_zero(classes ^ 0x3333333333333333)) / 8;
+    }
+
+    // True if all 8 bytes of a little endian word are '0'..'9'
+    // Adding 6 carries digits into 0x4_ while keeping '0'..'9' in 0x3_
+    constexpr bool is_eight_digits(uint64_t chunk) {
+        return ((chunk & 0xF0F0F0F0F0F0F0F0) | (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4))
+            == 0x3333333333333333;
+    }
+
+    // Converts 8 ASCII digits in a little endian word, the first digit in the low byte
+    // Combines neighbouring digits into 2 digit, then 4 digit, then 8 digit values
+    constexpr uint32_t parse_eight_digits(uint64_t chunk) {
+        chunk -= 0x3030303030303030;
+        chunk = (chunk * 10) + (chunk >> 8);
+        chunk = (((chunk & 0x000000FF000000FF) * (100 + (1000000ull << 32)))
+            + (((chunk >> 16) & 0x000000FF000000FF) * (1 + (10000ull << 32)))) >> 32;
+        return static_cast<uint32_t>(chunk);
+    }
+
+    // Parses the leading decimal digits of s, 8 at a time with a SWAR kernel
+    inline DigitRun decimal_run(std::string_view s, size_t readable) {
+        constexpr uint64_t max = UINT64_MAX;
+        const char* data = s.data();
+        DigitRun run{ 0, 0, false };
+
+        // below 10^11 another 8 digits can't overflow, so most numbers skip the division
+        while (run.length + 8 <= readable) {
+            uint64_t chunk = load_le64(data + run.length);
+            size_t digits = leading_digit_count(chunk);
+            if (digits == 0) {
+                return run;
+            }
+
+            // a shorter run is shifted to the top and refilled with leading '0's
+            if (digits < 8) {
+                chunk = (chunk << (64 - 8 * digits)) | (0x3030303030303030 >> (8 * digits));
+            }
+
+            uint32_t value = parse_eight_digits(chunk);
+            if (run.value >= 100000000000ull && run.value > (max - value) / powers_of_ten_u64[digits]) {
+                run.overflow = true;
+            }
+            run.value = run.value * powers_of_ten_u64[digits] + value;
+            run.length += digits;
+
+            if (digits < 8) {
+                return run;
+            }
+        }
+
+        while (run.length < s.size() && data[run.length] >= '0' && data[run.length] <= '9') {
+            unsigned digit = data[run.length] - '0';
+            if (run.value >= 1000000000000000000ull && run.value > (max - digit) / 10) {
+                run.overflow = true;
+            }
+            run.value = run.value * 10 + digit;
+            run.length++;
+        }
+
+        return run;
+    }
+
+    // ============================== HEX DIGITS ==============================
+
+    // Value of a hex digit in either case, 0xFF for anything else
+    constexpr uint8_t hex_digit_value(char c) {
+        if (c >= '0' && c <= '9') {
+            return static_cast<uint8_t>(c - '0');
+        }
+        char lower = static_cast<char>(c | 0x20);
+        if (lower >= 'a' && lower <= 'f') {
+            return static_cast<uint8_t>(lower - 'a' + 10);
+        }
+        return 0xFF;
+    }
+
+    // Number of leading hex digits of a little endian word
+    // Range checks add per byte constants, bytes with the top bit set are masked out
+    // and any carry out of them only reaches later bytes
+    constexpr size_t leading_hex_digit_count(uint64_t chunk) {
+        constexpr uint64_t ones = 0x0101010101010101;
+        constexpr uint64_t top_bits = 0x8080808080808080;
+
+        // top bit of each byte is set when lo <= byte <= hi
+        auto in_range = [](uint64_t x, uint64_t lo, uint64_t hi) {
+            return (x + ones * (0x80 - lo)) & ~(x + ones * (0x7F - hi));
+        };
+
+        uint64_t hex = (in_range(chunk, '0', '9') | in_range(chunk | (ones * 0x20), 'a', 'f')) & ~chunk & top_bits;
+        return static_cast<size_t>(std::countr_zero(~hex & top_bits)) / 8;
+    }
+
+    // Converts 8 ASCII hex digits in a little endian word, the first digit in the low byte
+    // Letters have bit 6 set and need 9 added to their low nibble, then neighbouring
+    // nibbles, bytes and 16 bit halves are merged with the earlier digit on top
+    constexpr uint32_t parse_eight_hex_digits(uint64_t chunk) {
+        uint64_t nibbles = (chunk & 0x0F0F0F0F0F0F0F0F) + ((chunk >> 6) & 0x0101010101010101) * 9;
+        nibbles = ((nibbles & 0x00FF00FF00FF00FF) << 4) | ((nibbles >> 8) & 0x00FF00FF00FF00FF);
+        nibbles = ((nibbles & 0x0000FFFF0000FFFF) << 8) | ((nibbles >> 16) & 0x0000FFFF0000FFFF);
+        return static_cast<uint32_t>(((nibbles & 0xFFFFFFFF) << 16) | (nibbles >> 32));
+    }
+
+    // Parses the leading hex digits of s, 8 at a time with a SWAR kernel
+    inline DigitRun hex_run(std::string_view s, size_t readable) {
+        const char* data = s.data();
+        DigitRun run{ 0, 0, false };
+
+        while (run.length + 8 <= readable) {
+            uint64_t chunk = load_le64(data + run.length);
+            size_t digits = leading_hex_digit_count(chunk);
+            if (digits == 0) {
+                return run;
+            }
+
+            // a shorter run is shifted to the top and refilled with leading '0's
+            if (digits < 8) {
+                chunk = (chunk << (64 - 8 * digits)) | (0x3030303030303030 >> (8 * digits));
+            }
+
+            if ((run.value >> (64 - 4 * digits)) != 0) {
+                run.overflow = true;
+            }
+            run.value = (run.value << (4 * digits)) | parse_eight_hex_digits(chunk);
+            run.length += digits;
+
+            if (digits < 8) {
+                return run;
+            }
+        }
+
+        for (; run.length < s.size(); run.length++) {
+            uint8_t digit = hex_digit_value(data[run.length]);
+            if (digit > 0xF) {
+                break;
+            }
+            if ((run.value >> 60) != 0) {
+                run.overflow = true;
+            }
+            run.value = (run.value << 4) | digit;
+        }
+        return run;
+    }
+
+    // Parses the leading digits of s in base 2^bits, 3 for octal and 1 for binary
+    inline DigitRun radix_run(std::string_view s, int bits) {
+        const char max_digit = static_cast<char>('0' + (1 << bits) - 1);
+        DigitRun run{ 0, 0, false };
+
+        for (; run.length < s.size() && s[run.length] >= '0' && s[run.length] <= max_digit; run.length++) {
+            if ((run.value >> (64 - bits)) != 0) {
+                run.overflow = true;
+            }
+            run.value = (run.value << bits) | static_cast<uint64_t>(s[run.length] - '0');
+        }
+        return run;
+    }
+
+    // Decodes pairs of hex digits into out, hex.size() / 2 bytes, 16 digits at a time
+    inline size_t hex_decode(std::string_view hex, uint8_t* out) {
+        const size_t n = hex.size() & ~size_t(1);
+        size_t i = 0;
+
+#ifdef CPPARSEC_SSE2
+        for (; i + 16 <= n; i += 16) {
+            __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hex.data() + i));
+            __m128i lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+            __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(chars, _mm_set1_epi8('9' + 1)));
+            __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+
+            unsigned valid = static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(digit, letter)));
+            if (valid != 0xFFFF) {
+                return i + std::countr_zero(~valid);
+            }
+
+            // the first digit of each pair is the low byte of a 16 bit lane and becomes the high nibble
+            __m128i nibbles = _mm_add_epi8(_mm_and_si128(chars, _mm_set1_epi8(0x0F)), _mm_and_si128(letter, _mm_set1_epi8(9)));
+            __m128i bytes = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0x00FF)), 4), _mm_srli_epi16(nibbles, 8));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i / 2), _mm_packus_epi16(bytes, bytes));
+        }
+#endif
+
+        for (; i < n; i += 2) {
+            uint8_t high = hex_digit_value(hex[i]);
+            uint8_t low = hex_digit_value(hex[i + 1]);
+            if (high > 0xF) {
+                return i;
+            }
+            if (low > 0xF) {
+                return i + 1;
+            }
+            out[i / 2] = static_cast<uint8_t>((high << 4) | low);
+        }
+
+        return n == hex.size() ? std::string_view::npos : n;
+    }
+
+    // ================================ BASE64 ================================
+
+    constexpr std::array<uint8_t, 256> make_base64_table(bool url) {
+        std::array<uint8_t, 256> table{};
+        table.fill(0xFF);
+
+        for (int i = 0; i < 26; i++) {
+            table['A' + i] = static_cast<uint8_t>(i);
+            table['a' + i] = static_cast<uint8_t>(26 + i);
+        }
+        for (int i = 0; i < 10; i++) {
+            table['0' + i] = static_cast<uint8_t>(52 + i);
+        }
+        table[url ? '-' : '+'] = 62;
+        table[url ? '_' : '/'] = 63;
+
+        return table;
+    }
+
+    inline constexpr std::array<uint8_t, 256> base64_table = make_base64_table(false);
+    inline constexpr std::array<uint8_t, 256> base64_url_table = make_base64_table(true);
+
+#ifdef CPPARSEC_SSE2
+    // Maps 16 base64 digits to their 6 bit values by range, returning a movemask of the valid ones
+    inline unsigned base64_sextets(__m128i block, bool url, __m128i& values) {
+        auto between = [&](char low, char high) {
+            return _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8(low - 1)), _mm_cmplt_epi8(block, _mm_set1_epi8(high + 1)));
+        };
+
+        __m128i upper = between('A', 'Z');
+        __m128i lower = between('a', 'z');
+        __m128i digits = between('0', '9');
+        __m128i digit_62 = _mm_cmpeq_epi8(block, _mm_set1_epi8(url ? '-' : '+'));
+        __m128i digit_63 = _mm_cmpeq_epi8(block, _mm_set1_epi8(url ? '_' : '/'));
+
+        // each class is a fixed offset from its ASCII code
+        __m128i offsets = _mm_or_si128(
+            _mm_or_si128(_mm_and_si128(upper, _mm_set1_epi8(-'A')), _mm_and_si128(lower, _mm_set1_epi8(26 - 'a'))),
+            _mm_or_si128(
+                _mm_or_si128(_mm_and_si128(digits, _mm_set1_epi8(52 - '0')), _mm_and_si128(digit_62, _mm_set1_epi8(static_cast<char>(62 - (url ? '-' : '+'))))),
+                _mm_and_si128(digit_63, _mm_set1_epi8(static_cast<char>(63 - (url ? '_' : '/'))))));
+        __m128i valid = _mm_or_si128(_mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digits, digit_62)), digit_63);
+
+        values = _mm_add_epi8(block, offsets);
+        return static_cast<unsigned>(_mm_movemask_epi8(valid));
+    }
+#endif
+
+    inline size_t base64_decode_quanta(std::string_view s, bool url, uint8_t* out) {
+        const std::array<uint8_t, 256>& table = url ? base64_url_table : base64_table;
+        size_t i = 0;
+
+#ifdef CPPARSEC_SSE2
+        for (; i + 16 <= s.size(); i += 16, out += 12) {
+            __m128i values;
+            if (base64_sextets(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s.data() + i)), url, values) != 0xFFFF) {
+                break;
+            }
+
+            // merge digit pairs into 12 bits, then pairs of those into 24 bits per 32 bit lane
+            __m128i pairs = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(values, _mm_set1_epi16(0x00FF)), 6), _mm_srli_epi16(values, 8));
+            __m128i quanta = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(pairs, _mm_set1_epi32(0x0000FFFF)), 12), _mm_srli_epi32(pairs, 16));
+
+            alignas(16) uint8_t bytes[16];
+#ifdef CPPARSEC_SSSE3
+            // the 3 low bytes of each lane, most significant first
+            quanta = _mm_shuffle_epi8(quanta, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+            _mm_store_si128(reinterpret_cast<__m128i*>(bytes), quanta);
+            std::memcpy(out, bytes, 12);
+#else
+            _mm_store_si128(reinterpret_cast<__m128i*>(bytes), quanta);
+            for (int lane = 0; lane < 4; lane++) {
+                out[3 * lane] = bytes[4 * lane + 2];
+                out[3 * lane + 1] = bytes[4 * lane + 1];
+                out[3 * lane + 2] = bytes[4 * lane];
+            }
+#endif
+        }
+#endif
+
+        for (; i + 4 <= s.size(); i += 4, out += 3) {
+            uint32_t a = table[static_cast<unsigned char>(s[i])];
+            uint32_t b = table[static_cast<unsigned char>(s[i + 1])];
+            uint32_t c = table[static_cast<unsigned char>(s[i + 2])];
+            uint32_t d = table[static_cast<unsigned char>(s[i + 3])];
+            if (((a | b | c | d) & 0x80) != 0) {
+                break;
+            }
+
+            uint32_t quantum = (a << 18) | (b << 12) | (c << 6) | d;
+            out[0] = static_cast<uint8_t>(quantum >> 16);
+            out[1] = static_cast<uint8_t>(quantum >> 8);
+            out[2] = static_cast<uint8_t>(quantum);
+        }
+
+        return i;
+    }
+
+    // ============================ QUOTED STRINGS ============================
+
+    inline size_t plain_string_run(std::string_view s, char quote, char escape, bool stop_at_controls) {
+        size_t i = 0;
+
+#ifdef CPPARSEC_SSE2
+        const __m128i quotes = _mm_set1_epi8(quote);
+        const __m128i escapes = _mm_set1_epi8(escape);
+        const __m128i control_max = _mm_set1_epi8(0x1F);
+
+        for (; i + 16 <= s.size(); i += 16) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s.data() + i));
+            __m128i special = _mm_or_si128(_mm_cmpeq_epi8(block, quotes), _mm_cmpeq_epi8(block, escapes));
+            if (stop_at_controls) {
+                // bytes at most 0x1F are the only ones unchanged by an unsigned min with 0x1F
+                special = _mm_or_si128(special, _mm_cmpeq_epi8(_mm_min_epu8(block, control_max), block));
+            }
+
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(special));
+            if (mask != 0) {
+                return i + std::countr_zero(mask);
+            }
+        }
+#endif
+
+        while (i < s.size() && s[i] != quote && s[i] != escape && !(stop_at_controls && static_cast<unsigned char>(s[i]) < 0x20)) {
+            i++;
+        }
+        return i;
+    }
+
+    // ============================== DATE TIMES ==============================
+
+    inline std::optional<DateTimeFields> date_time_fields(const char* data) {
+        constexpr uint64_t zeros = 0x3030303030303030;
+
+        uint64_t date = load_le64(data);        // "YYYY-MM-"
+        uint64_t middle = load_le64(data + 8);  // "DDTHH:MM"
+        uint64_t time = load_le64(data + 11);   // "HH:MM:SS"
+
+        // separator bytes of each word, middle's offset 10 is only excluded from the digits
+        constexpr uint64_t date_mask = 0xFF0000FF00000000;
+        constexpr uint64_t middle_mask = 0x0000FF0000000000;
+        constexpr uint64_t middle_skip = 0x0000FF0000FF0000;
+        constexpr uint64_t time_mask = 0x0000FF0000FF0000;
+
+        uint64_t separators = ((date & date_mask) ^ 0x2D00002D00000000)
+            | ((middle & middle_mask) ^ 0x00003A0000000000)
+            | ((time & time_mask) ^ 0x00003A00003A0000);
+
+        // separators are replaced by '0' so each word is checked as 8 digits
+        date = (date & ~date_mask) | (zeros & date_mask);
+        middle = (middle & ~middle_skip) | (zeros & middle_skip);
+        time = (time & ~time_mask) | (zeros & time_mask);
+
+        if (separators != 0 || !is_eight_digits(date) || !is_eight_digits(middle) || !is_eight_digits(time)) {
+            return std::nullopt;
+        }
+
+        // byte k of each word becomes the 2 digit value of bytes k and k + 1, at most 99 so nothing carries
+        auto pairs = [](uint64_t chunk) {
+            chunk -= zeros;
+            return chunk * 10 + (chunk >> 8);
+        };
+        auto byte = [](uint64_t chunk, int k) { return static_cast<unsigned>((chunk >> (8 * k)) & 0xFF); };
+
+        date = pairs(date);
+        middle = pairs(middle);
+        time = pairs(time);
+
+        return DateTimeFields{
+            .year = byte(date, 0) * 100 + byte(date, 2),
+            .month = byte(date, 5),
+            .day = byte(middle, 0),
+            .hour = byte(middle, 3),
+            .minute = byte(middle, 6),
+            .second = byte(time, 6),
+        };
+    }
+
+    // ================================ UTF-8 =================================
+
+    // Returns the length of the leading run of ASCII bytes
+    inline size_t ascii_prefix_length(std::string_view s) {
+        size_t i = 0;
+
+#ifdef CPPARSEC_SSE2
+        for (; i + 16 <= s.size(); i += 16) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s.data() + i));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(block));
+            if (mask != 0) {
+                return i + std::countr_zero(mask);
+            }
+        }
+#endif
+
+        while (i < s.size() && static_cast<unsigned char>(s[i]) < 0x80) {
+            i++;
+        }
+        return i;
+    }
+
+    // Decodes one UTF-8 sequence, rejecting overlong forms, surrogates and values past U+10FFFF
+    // On failure returns the byte offset of the first invalid byte
+    inline std::expected<Utf8Char, size_t> utf8_decode(std::string_view s) {
+        if (s.empty()) {
+            return std::unexpected(0);
+        }
+
+        unsigned char lead = static_cast<unsigned char>(s[0]);
+        if (lead < 0x80) {
+            return Utf8Char{ lead, 1 };
+        }
+
+        // valid range of the second byte, narrowed for the leads that have overlong/surrogate forms
+        unsigned char low = 0x80, high = 0xBF;
+        size_t length;
+        char32_t c;
+
+        if (lead < 0xC2) {
+            return std::unexpected(0); // continuation byte or overlong 2 byte lead
+        }
+        else if (lead < 0xE0) {
+            length = 2;
+            c = lead & 0x1F;
+        }
+        else if (lead < 0xF0) {
+            length = 3;
+            c = lead & 0x0F;
+            low = (lead == 0xE0) ? 0xA0 : low;
+            high = (lead == 0xED) ? 0x9F : high;
+        }
+        else if (lead < 0xF5) {
+            length = 4;
+            c = lead & 0x07;
+            low = (lead == 0xF0) ? 0x90 : low;
+            high = (lead == 0xF4) ? 0x8F : high;
+        }
+        else {
+            return std::unexpected(0);
+        }
+
+        for (size_t i = 1; i < length; i++) {
+            if (i >= s.size()) {
+                return std::unexpected(i);
+            }
+
+            unsigned char b = static_cast<unsigned char>(s[i]);
+            if (b < low || b > high) {
+                return std::unexpected(i);
+            }
+
+            low = 0x80;
+            high = 0xBF;
+            c = (c << 6) | (b & 0x3F);
+        }
+
+        return Utf8Char{ c, length };
+    }
+
+#ifdef CPPARSEC_SSSE3
+    // Lookup table UTF-8 validation of one block (Keiser and Lemire, "Validating UTF-8 In Less
+    // Than One Instruction Per Byte"), nonzero lanes mark errors ending in input
+    inline __m128i utf8_block_errors(__m128i input, __m128i prev_input) {
+        constexpr char TOO_SHORT = 1 << 0;
+        constexpr char TOO_LONG = 1 << 1;
+        constexpr char OVERLONG_3 = 1 << 2;
+        constexpr char TOO_LARGE = 1 << 3;
+        constexpr char SURROGATE = 1 << 4;
+        constexpr char OVERLONG_2 = 1 << 5;
+        constexpr char TOO_LARGE_1000 = 1 << 6;
+        constexpr char OVERLONG_4 = 1 << 6;
+        constexpr char TWO_CONTS = static_cast<char>(1 << 7);
+        constexpr char CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+        const __m128i byte_1_high_table = _mm_setr_epi8(
+            TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+            TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+            TOO_SHORT | OVERLONG_2,
+            TOO_SHORT,
+            TOO_SHORT | OVERLONG_3 | SURROGATE,
+            TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4);
+        const __m128i byte_1_low_table = _mm_setr_epi8(
+            CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+            CARRY | OVERLONG_2,
+            CARRY,
+            CARRY,
+            CARRY | TOO_LARGE,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000);
+        const __m128i byte_2_high_table = _mm_setr_epi8(
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT);
+
+        const __m128i nibble = _mm_set1_epi8(0x0F);
+        __m128i prev1 = _mm_alignr_epi8(input, prev_input, 15);
+        __m128i byte_1_high = _mm_shuffle_epi8(byte_1_high_table, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+        __m128i byte_1_low = _mm_shuffle_epi8(byte_1_low_table, _mm_and_si128(prev1, nibble));
+        __m128i byte_2_high = _mm_shuffle_epi8(byte_2_high_table, _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+        __m128i special_cases = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+        // third and fourth bytes of a sequence must be continuations
+        __m128i prev2 = _mm_alignr_epi8(input, prev_input, 14);
+        __m128i prev3 = _mm_alignr_epi8(input, prev_input, 13);
+        __m128i is_third_byte = _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+        __m128i is_fourth_byte = _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+        __m128i must_be_continuation = _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte), _mm_set1_epi8(static_cast<char>(0x80)));
+
+        return _mm_xor_si128(must_be_continuation, special_cases);
+    }
+#endif
+
+    // Returns the byte offset of the first invalid byte of s, or npos if s is valid UTF-8
+    inline size_t utf8_validate(std::string_view s) {
+        size_t start = 0; // where the exact scalar scan begins
+
+#ifdef CPPARSEC_SSSE3
+        {
+            const __m128i zero = _mm_setzero_si128();
+            __m128i prev = zero;
+            bool prev_ascii = true;
+            bool valid = true;
+            size_t i = 0;
+
+            for (; i + 16 <= s.size(); i += 16) {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s.data() + i));
+                bool ascii = _mm_movemask_epi8(block) == 0;
+
+                if (!(ascii && prev_ascii) && _mm_movemask_epi8(_mm_cmpeq_epi8(utf8_block_errors(block, prev), zero)) != 0xFFFF) {
+                    valid = false;
+                    break;
+                }
+                prev = block;
+                prev_ascii = ascii;
+            }
+
+            if (valid) {
+                // zero padding after the tail catches sequences truncated by the end of input
+                alignas(16) char tail[16] = {};
+                std::memcpy(tail, s.data() + i, s.size() - i);
+                __m128i block = _mm_load_si128(reinterpret_cast<const __m128i*>(tail));
+                __m128i errors = _mm_or_si128(utf8_block_errors(block, prev), utf8_block_errors(zero, block));
+
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(errors, zero)) == 0xFFFF) {
+                    return std::string_view::npos;
+                }
+            }
+
+            // blocks before the previous one are valid, back up to a sequence boundary there
+            start = (i >= 16) ? i - 16 : 0;
+            for (int back = 0; back < 3 && start > 0 && (static_cast<unsigned char>(s[start]) & 0xC0) == 0x80; back++) {
+                start--;
+            }
+        }
+#endif
+
+        for (size_t i = start; i < s.size(); ) {
+            i += ascii_prefix_length(s.substr(i));
+            if (i == s.size()) {
+                break;
+            }
+
+            auto decoded = utf8_decode(s.substr(i));
+            if (!decoded) {
+                return i + decoded.error();
+            }
+            i += decoded->length;
+        }
+
+        return std::string_view::npos;
+    }
+};
+
+#endif /* CPPARSEC_SIMD_H */
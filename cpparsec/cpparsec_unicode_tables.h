@@ -0,0 +1,413 @@
+#ifndef CPPARSEC_UNICODE_TABLES_H
+#define CPPARSEC_UNICODE_TABLES_H
+
+#include <cstdint>
+
+// Generated from the Unicode 14.0.0 character database, do not edit by hand
+// Each entry is (first codepoint << 5) | GeneralCategory, sorted by codepoint,
+// a category run lasts until the next entry
+
+namespace cpparsec::detail {
+
+    inline constexpr uint32_t general_category_runs[] = {
+        0x0000019, 0x0000416, 0x0000431, 0x0000493, 0x00004b1, 0x000050d, 0x000052e, 0x0000551, 0x0000572, 0x0000591,
+        0x00005ac, 0x00005d1, 0x0000608, 0x0000751, 0x0000792, 0x00007f1, 0x0000820, 0x0000b6d, 0x0000b91, 0x0000bae,
+        0x0000bd4, 0x0000beb, 0x0000c14, 0x0000c21, 0x0000f6d, 0x0000f92, 0x0000fae, 0x0000fd2, 0x0000ff9, 0x0001416,
+        0x0001431, 0x0001453, 0x00014d5, 0x00014f1, 0x0001514, 0x0001535, 0x0001544, 0x000156f, 0x0001592, 0x00015ba,
+        0x00015d5, 0x00015f4, 0x0001615, 0x0001632, 0x000164a, 0x0001694, 0x00016a1, 0x00016d1, 0x0001714, 0x000172a,
+        0x0001744, 0x0001770, 0x000178a, 0x00017f1, 0x0001800, 0x0001af2, 0x0001b00, 0x0001be1, 0x0001ef2, 0x0001f01,
+        0x0002000, 0x0002021, 0x0002040, 0x0002061, 0x0002080, 0x00020a1, 0x00020c0, 0x00020e1, 0x0002100, 0x0002121,
+        0x0002140, 0x0002161, 0x0002180, 0x00021a1, 0x00021c0, 0x00021e1, 0x0002200, 0x0002221, 0x0002240, 0x0002261,
+        0x0002280, 0x00022a1, 0x00022c0, 0x00022e1, 0x0002300, 0x0002321, 0x0002340, 0x0002361, 0x0002380, 0x00023a1,
+        0x00023c0, 0x00023e1, 0x0002400, 0x0002421, 0x0002440, 0x0002461, 0x0002480, 0x00024a1, 0x00024c0, 0x00024e1,
+        0x0002500, 0x0002521, 0x0002540, 0x0002561, 0x0002580, 0x00025a1, 0x00025c0, 0x00025e1, 0x0002600, 0x0002621,
+        0x0002640, 0x0002661, 0x0002680, 0x00026a1, 0x00026c0, 0x00026e1, 0x0002720, 0x0002741, 0x0002760, 0x0002781,
+        0x00027a0, 0x00027c1, 0x00027e0, 0x0002801, 0x0002820, 0x0002841, 0x0002860, 0x0002881, 0x00028a0, 0x00028c1,
+        0x00028e0, 0x0002901, 0x0002940, 0x0002961, 0x0002980, 0x00029a1, 0x00029c0, 0x00029e1, 0x0002a00, 0x0002a21,
+        0x0002a40, 0x0002a61, 0x0002a80, 0x0002aa1, 0x0002ac0, 0x0002ae1, 0x0002b00, 0x0002b21, 0x0002b40, 0x0002b61,
+        0x0002b80, 0x0002ba1, 0x0002bc0, 0x0002be1, 0x0002c00, 0x0002c21, 0x0002c40, 0x0002c61, 0x0002c80, 0x0002ca1,
+        0x0002cc0, 0x0002ce1, 0x0002d00, 0x0002d21, 0x0002d40, 0x0002d61, 0x0002d80, 0x0002da1, 0x0002dc0, 0x0002de1,
+        0x0002e00, 0x0002e21, 0x0002e40, 0x0002e61, 0x0002e80, 0x0002ea1, 0x0002ec0, 0x0002ee1, 0x0002f00, 0x0002f41,
+        0x0002f60, 0x0002f81, 0x0002fa0, 0x0002fc1, 0x0003020, 0x0003061, 0x0003080, 0x00030a1, 0x00030c0, 0x0003101,
+        0x0003120, 0x0003181, 0x00031c0, 0x0003241, 0x0003260, 0x00032a1, 0x00032c0, 0x0003321, 0x0003380, 0x00033c1,
+        0x00033e0, 0x0003421, 0x0003440, 0x0003461, 0x0003480, 0x00034a1, 0x00034c0, 0x0003501, 0x0003520, 0x0003541,
+        0x0003580, 0x00035a1, 0x00035c0, 0x0003601, 0x0003620, 0x0003681, 0x00036a0, 0x00036c1, 0x00036e0, 0x0003721,
+        0x0003764, 0x0003780, 0x00037a1, 0x0003804, 0x0003880, 0x00038a2, 0x00038c1, 0x00038e0, 0x0003902, 0x0003921,
+        0x0003940, 0x0003962, 0x0003981, 0x00039a0, 0x00039c1, 0x00039e0, 0x0003a01, 0x0003a20, 0x0003a41, 0x0003a60,
+        0x0003a81, 0x0003aa0, 0x0003ac1, 0x0003ae0, 0x0003b01, 0x0003b20, 0x0003b41, 0x0003b60, 0x0003b81, 0x0003bc0,
+        0x0003be1, 0x0003c00, 0x0003c21, 0x0003c40, 0x0003c61, 0x0003c80, 0x0003ca1, 0x0003cc0, 0x0003ce1, 0x0003d00,
+        0x0003d21, 0x0003d40, 0x0003d61, 0x0003d80, 0x0003da1, 0x0003dc0, 0x0003de1, 0x0003e20, 0x0003e42, 0x0003e61,
+        0x0003e80, 0x0003ea1, 0x0003ec0, 0x0003f21, 0x0003f40, 0x0003f61, 0x0003f80, 0x0003fa1, 0x0003fc0, 0x0003fe1,
+        0x0004000, 0x0004021, 0x0004040, 0x0004061, 0x0004080, 0x00040a1, 0x00040c0, 0x00040e1, 0x0004100, 0x0004121,
+        0x0004140, 0x0004161, 0x0004180, 0x00041a1, 0x00041c0, 0x00041e1, 0x0004200, 0x0004221, 0x0004240, 0x0004261,
+        0x0004280, 0x00042a1, 0x00042c0, 0x00042e1, 0x0004300, 0x0004321, 0x0004340, 0x0004361, 0x0004380, 0x00043a1,
+        0x00043c0, 0x00043e1, 0x0004400, 0x0004421, 0x0004440, 0x0004461, 0x0004480, 0x00044a1, 0x00044c0, 0x00044e1,
+        0x0004500, 0x0004521, 0x0004540, 0x0004561, 0x0004580, 0x00045a1, 0x00045c0, 0x00045e1, 0x0004600, 0x0004621,
+        0x0004640, 0x0004661, 0x0004740, 0x0004781, 0x00047a0, 0x00047e1, 0x0004820, 0x0004841, 0x0004860, 0x00048e1,
+        0x0004900, 0x0004921, 0x0004940, 0x0004961, 0x0004980, 0x00049a1, 0x00049c0, 0x00049e1, 0x0005284, 0x00052a1,
+        0x0005603, 0x0005854, 0x00058c3, 0x0005a54, 0x0005c03, 0x0005cb4, 0x0005d83, 0x0005db4, 0x0005dc3, 0x0005df4,
+        0x0006005, 0x0006e00, 0x0006e21, 0x0006e40, 0x0006e61, 0x0006e83, 0x0006eb4, 0x0006ec0, 0x0006ee1, 0x0006f1d,
+        0x0006f43, 0x0006f61, 0x0006fd1, 0x0006fe0, 0x000701d, 0x0007094, 0x00070c0, 0x00070f1, 0x0007100, 0x000717d,
+        0x0007180, 0x00071bd, 0x00071c0, 0x0007201, 0x0007220, 0x000745d, 0x0007460, 0x0007581, 0x00079e0, 0x0007a01,
+        0x0007a40, 0x0007aa1, 0x0007b00, 0x0007b21, 0x0007b40, 0x0007b61, 0x0007b80, 0x0007ba1, 0x0007bc0, 0x0007be1,
+        0x0007c00, 0x0007c21, 0x0007c40, 0x0007c61, 0x0007c80, 0x0007ca1, 0x0007cc0, 0x0007ce1, 0x0007d00, 0x0007d21,
+        0x0007d40, 0x0007d61, 0x0007d80, 0x0007da1, 0x0007dc0, 0x0007de1, 0x0007e80, 0x0007ea1, 0x0007ed2, 0x0007ee0,
+        0x0007f01, 0x0007f20, 0x0007f61, 0x0007fa0, 0x0008601, 0x0008c00, 0x0008c21, 0x0008c40, 0x0008c61, 0x0008c80,
+        0x0008ca1, 0x0008cc0, 0x0008ce1, 0x0008d00, 0x0008d21, 0x0008d40, 0x0008d61, 0x0008d80, 0x0008da1, 0x0008dc0,
+        0x0008de1, 0x0008e00, 0x0008e21, 0x0008e40, 0x0008e61, 0x0008e80, 0x0008ea1, 0x0008ec0, 0x0008ee1, 0x0008f00,
+        0x0008f21, 0x0008f40, 0x0008f61, 0x0008f80, 0x0008fa1, 0x0008fc0, 0x0008fe1, 0x0009000, 0x0009021, 0x0009055,
+        0x0009065, 0x0009107, 0x0009140, 0x0009161, 0x0009180, 0x00091a1, 0x00091c0, 0x00091e1, 0x0009200, 0x0009221,
+        0x0009240, 0x0009261, 0x0009280, 0x00092a1, 0x00092c0, 0x00092e1, 0x0009300, 0x0009321, 0x0009340, 0x0009361,
+        0x0009380, 0x00093a1, 0x00093c0, 0x00093e1, 0x0009400, 0x0009421, 0x0009440, 0x0009461, 0x0009480, 0x00094a1,
+        0x00094c0, 0x00094e1, 0x0009500, 0x0009521, 0x0009540, 0x0009561, 0x0009580, 0x00095a1, 0x00095c0, 0x00095e1,
+        0x0009600, 0x0009621, 0x0009640, 0x0009661, 0x0009680, 0x00096a1, 0x00096c0, 0x00096e1, 0x0009700, 0x0009721,
+        0x0009740, 0x0009761, 0x0009780, 0x00097a1, 0x00097c0, 0x00097e1, 0x0009800, 0x0009841, 0x0009860, 0x0009881,
+        0x00098a0, 0x00098c1, 0x00098e0, 0x0009901, 0x0009920, 0x0009941, 0x0009960, 0x0009981, 0x00099a0, 0x00099c1,
+        0x0009a00, 0x0009a21, 0x0009a40, 0x0009a61, 0x0009a80, 0x0009aa1, 0x0009ac0, 0x0009ae1, 0x0009b00, 0x0009b21,
+        0x0009b40, 0x0009b61, 0x0009b80, 0x0009ba1, 0x0009bc0, 0x0009be1, 0x0009c00, 0x0009c21, 0x0009c40, 0x0009c61,
+        0x0009c80, 0x0009ca1, 0x0009cc0, 0x0009ce1, 0x0009d00, 0x0009d21, 0x0009d40, 0x0009d61, 0x0009d80, 0x0009da1,
+        0x0009dc0, 0x0009de1, 0x0009e00, 0x0009e21, 0x0009e40, 0x0009e61, 0x0009e80, 0x0009ea1, 0x0009ec0, 0x0009ee1,
+        0x0009f00, 0x0009f21, 0x0009f40, 0x0009f61, 0x0009f80, 0x0009fa1, 0x0009fc0, 0x0009fe1, 0x000a000, 0x000a021,
+        0x000a040, 0x000a061, 0x000a080, 0x000a0a1, 0x000a0c0, 0x000a0e1, 0x000a100, 0x000a121, 0x000a140, 0x000a161,
+        0x000a180, 0x000a1a1, 0x000a1c0, 0x000a1e1, 0x000a200, 0x000a221, 0x000a240, 0x000a261, 0x000a280, 0x000a2a1,
+        0x000a2c0, 0x000a2e1, 0x000a300, 0x000a321, 0x000a340, 0x000a361, 0x000a380, 0x000a3a1, 0x000a3c0, 0x000a3e1,
+        0x000a400, 0x000a421, 0x000a440, 0x000a461, 0x000a480, 0x000a4a1, 0x000a4c0, 0x000a4e1, 0x000a500, 0x000a521,
+        0x000a540, 0x000a561, 0x000a580, 0x000a5a1, 0x000a5c0, 0x000a5e1, 0x000a61d, 0x000a620, 0x000aafd, 0x000ab23,
+        0x000ab51, 0x000ac01, 0x000b131, 0x000b14c, 0x000b17d, 0x000b1b5, 0x000b1f3, 0x000b21d, 0x000b225, 0x000b7cc,
+        0x000b7e5, 0x000b811, 0x000b825, 0x000b871, 0x000b885, 0x000b8d1, 0x000b8e5, 0x000b91d, 0x000ba04, 0x000bd7d,
+        0x000bde4, 0x000be71, 0x000bebd, 0x000c01a, 0x000c0d2, 0x000c131, 0x000c173, 0x000c191, 0x000c1d5, 0x000c205,
+        0x000c371, 0x000c39a, 0x000c3b1, 0x000c404, 0x000c803, 0x000c824, 0x000c965, 0x000cc08, 0x000cd51, 0x000cdc4,
+        0x000ce05, 0x000ce24, 0x000da91, 0x000daa4, 0x000dac5, 0x000dbba, 0x000dbd5, 0x000dbe5, 0x000dca3, 0x000dce5,
+        0x000dd35, 0x000dd45, 0x000ddc4, 0x000de08, 0x000df44, 0x000dfb5, 0x000dfe4, 0x000e011, 0x000e1dd, 0x000e1fa,
+        0x000e204, 0x000e225, 0x000e244, 0x000e605, 0x000e97d, 0x000e9a4, 0x000f4c5, 0x000f624, 0x000f65d, 0x000f808,
+        0x000f944, 0x000fd65, 0x000fe83, 0x000fed5, 0x000fef1, 0x000ff43, 0x000ff7d, 0x000ffa5, 0x000ffd3, 0x0010004,
+        0x00102c5, 0x0010343, 0x0010365, 0x0010483, 0x00104a5, 0x0010503, 0x0010525, 0x00105dd, 0x0010611, 0x00107fd,
+        0x0010804, 0x0010b25, 0x0010b9d, 0x0010bd1, 0x0010bfd, 0x0010c04, 0x0010d7d, 0x0010e04, 0x0011114, 0x0011124,
+        0x00111fd, 0x001121a, 0x001125d, 0x0011305, 0x0011404, 0x0011923, 0x0011945, 0x0011c5a, 0x0011c65, 0x0012066,
+        0x0012084, 0x0012745, 0x0012766, 0x0012785, 0x00127a4, 0x00127c6, 0x0012825, 0x0012926, 0x00129a5, 0x00129c6,
+        0x0012a04, 0x0012a25, 0x0012b04, 0x0012c45, 0x0012c91, 0x0012cc8, 0x0012e11, 0x0012e23, 0x0012e44, 0x0013025,
+        0x0013046, 0x001309d, 0x00130a4, 0x00131bd, 0x00131e4, 0x001323d, 0x0013264, 0x001353d, 0x0013544, 0x001363d,
+        0x0013644, 0x001367d, 0x00136c4, 0x001375d, 0x0013785, 0x00137a4, 0x00137c6, 0x0013825, 0x00138bd, 0x00138e6,
+        0x001393d, 0x0013966, 0x00139a5, 0x00139c4, 0x00139fd, 0x0013ae6, 0x0013b1d, 0x0013b84, 0x0013bdd, 0x0013be4,
+        0x0013c45, 0x0013c9d, 0x0013cc8, 0x0013e04, 0x0013e53, 0x0013e8a, 0x0013f55, 0x0013f73, 0x0013f84, 0x0013fb1,
+        0x0013fc5, 0x0013ffd, 0x0014025, 0x0014066, 0x001409d, 0x00140a4, 0x001417d, 0x00141e4, 0x001423d, 0x0014264,
+        0x001453d, 0x0014544, 0x001463d, 0x0014644, 0x001469d, 0x00146a4, 0x00146fd, 0x0014704, 0x001475d, 0x0014785,
+        0x00147bd, 0x00147c6, 0x0014825, 0x001487d, 0x00148e5, 0x001493d, 0x0014965, 0x00149dd, 0x0014a25, 0x0014a5d,
+        0x0014b24, 0x0014bbd, 0x0014bc4, 0x0014bfd, 0x0014cc8, 0x0014e05, 0x0014e44, 0x0014ea5, 0x0014ed1, 0x0014efd,
+        0x0015025, 0x0015066, 0x001509d, 0x00150a4, 0x00151dd, 0x00151e4, 0x001525d, 0x0015264, 0x001553d, 0x0015544,
+        0x001563d, 0x0015644, 0x001569d, 0x00156a4, 0x001575d, 0x0015785, 0x00157a4, 0x00157c6, 0x0015825, 0x00158dd,
+        0x00158e5, 0x0015926, 0x001595d, 0x0015966, 0x00159a5, 0x00159dd, 0x0015a04, 0x0015a3d, 0x0015c04, 0x0015c45,
+        0x0015c9d, 0x0015cc8, 0x0015e11, 0x0015e33, 0x0015e5d, 0x0015f24, 0x0015f45, 0x001601d, 0x0016025, 0x0016046,
+        0x001609d, 0x00160a4, 0x00161bd, 0x00161e4, 0x001623d, 0x0016264, 0x001653d, 0x0016544, 0x001663d, 0x0016644,
+        0x001669d, 0x00166a4, 0x001675d, 0x0016785, 0x00167a4, 0x00167c6, 0x00167e5, 0x0016806, 0x0016825, 0x00168bd,
+        0x00168e6, 0x001693d, 0x0016966, 0x00169a5, 0x00169dd, 0x0016aa5, 0x0016ae6, 0x0016b1d, 0x0016b84, 0x0016bdd,
+        0x0016be4, 0x0016c45, 0x0016c9d, 0x0016cc8, 0x0016e15, 0x0016e24, 0x0016e4a, 0x0016f1d, 0x0017045, 0x0017064,
+        0x001709d, 0x00170a4, 0x001717d, 0x00171c4, 0x001723d, 0x0017244, 0x00172dd, 0x0017324, 0x001737d, 0x0017384,
+        0x00173bd, 0x00173c4, 0x001741d, 0x0017464, 0x00174bd, 0x0017504, 0x001757d, 0x00175c4, 0x001775d, 0x00177c6,
+        0x0017805, 0x0017826, 0x001787d, 0x00178c6, 0x001793d, 0x0017946, 0x00179a5, 0x00179dd, 0x0017a04, 0x0017a3d,
+        0x0017ae6, 0x0017b1d, 0x0017cc8, 0x0017e0a, 0x0017e75, 0x0017f33, 0x0017f55, 0x0017f7d, 0x0018005, 0x0018026,
+        0x0018085, 0x00180a4, 0x00181bd, 0x00181c4, 0x001823d, 0x0018244, 0x001853d, 0x0018544, 0x001875d, 0x0018785,
+        0x00187a4, 0x00187c5, 0x0018826, 0x00188bd, 0x00188c5, 0x001893d, 0x0018945, 0x00189dd, 0x0018aa5, 0x0018afd,
+        0x0018b04, 0x0018b7d, 0x0018ba4, 0x0018bdd, 0x0018c04, 0x0018c45, 0x0018c9d, 0x0018cc8, 0x0018e1d, 0x0018ef1,
+        0x0018f0a, 0x0018ff5, 0x0019004, 0x0019025, 0x0019046, 0x0019091, 0x00190a4, 0x00191bd, 0x00191c4, 0x001923d,
+        0x0019244, 0x001953d, 0x0019544, 0x001969d, 0x00196a4, 0x001975d, 0x0019785, 0x00197a4, 0x00197c6, 0x00197e5,
+        0x0019806, 0x00198bd, 0x00198c5, 0x00198e6, 0x001993d, 0x0019946, 0x0019985, 0x00199dd, 0x0019aa6, 0x0019afd,
+        0x0019ba4, 0x0019bfd, 0x0019c04, 0x0019c45, 0x0019c9d, 0x0019cc8, 0x0019e1d, 0x0019e24, 0x0019e7d, 0x001a005,
+        0x001a046, 0x001a084, 0x001a1bd, 0x001a1c4, 0x001a23d, 0x001a244, 0x001a765, 0x001a7a4, 0x001a7c6, 0x001a825,
+        0x001a8bd, 0x001a8c6, 0x001a93d, 0x001a946, 0x001a9a5, 0x001a9c4, 0x001a9f5, 0x001aa1d, 0x001aa84, 0x001aae6,
+        0x001ab0a, 0x001abe4, 0x001ac45, 0x001ac9d, 0x001acc8, 0x001ae0a, 0x001af35, 0x001af44, 0x001b01d, 0x001b025,
+        0x001b046, 0x001b09d, 0x001b0a4, 0x001b2fd, 0x001b344, 0x001b65d, 0x001b664, 0x001b79d, 0x001b7a4, 0x001b7dd,
+        0x001b804, 0x001b8fd, 0x001b945, 0x001b97d, 0x001b9e6, 0x001ba45, 0x001babd, 0x001bac5, 0x001bafd, 0x001bb06,
+        0x001bc1d, 0x001bcc8, 0x001be1d, 0x001be46, 0x001be91, 0x001bebd, 0x001c024, 0x001c625, 0x001c644, 0x001c685,
+        0x001c77d, 0x001c7f3, 0x001c804, 0x001c8c3, 0x001c8e5, 0x001c9f1, 0x001ca08, 0x001cb51, 0x001cb9d, 0x001d024,
+        0x001d07d, 0x001d084, 0x001d0bd, 0x001d0c4, 0x001d17d, 0x001d184, 0x001d49d, 0x001d4a4, 0x001d4dd, 0x001d4e4,
+        0x001d625, 0x001d644, 0x001d685, 0x001d7a4, 0x001d7dd, 0x001d804, 0x001d8bd, 0x001d8c3, 0x001d8fd, 0x001d905,
+        0x001d9dd, 0x001da08, 0x001db5d, 0x001db84, 0x001dc1d, 0x001e004, 0x001e035, 0x001e091, 0x001e275, 0x001e291,
+        0x001e2b5, 0x001e305, 0x001e355, 0x001e408, 0x001e54a, 0x001e695, 0x001e6a5, 0x001e6d5, 0x001e6e5, 0x001e715,
+        0x001e725, 0x001e74d, 0x001e76e, 0x001e78d, 0x001e7ae, 0x001e7c6, 0x001e804, 0x001e91d, 0x001e924, 0x001edbd,
+        0x001ee25, 0x001efe6, 0x001f005, 0x001f0b1, 0x001f0c5, 0x001f104, 0x001f1a5, 0x001f31d, 0x001f325, 0x001f7bd,
+        0x001f7d5, 0x001f8c5, 0x001f8f5, 0x001f9bd, 0x001f9d5, 0x001fa11, 0x001fab5, 0x001fb31, 0x001fb7d, 0x0020004,
+        0x0020566, 0x00205a5, 0x0020626, 0x0020645, 0x0020706, 0x0020725, 0x0020766, 0x00207a5, 0x00207e4, 0x0020808,
+        0x0020951, 0x0020a04, 0x0020ac6, 0x0020b05, 0x0020b44, 0x0020bc5, 0x0020c24, 0x0020c46, 0x0020ca4, 0x0020ce6,
+        0x0020dc4, 0x0020e25, 0x0020ea4, 0x0021045, 0x0021066, 0x00210a5, 0x00210e6, 0x00211a5, 0x00211c4, 0x00211e6,
+        0x0021208, 0x0021346, 0x00213a5, 0x00213d5, 0x0021400, 0x00218dd, 0x00218e0, 0x002191d, 0x00219a0, 0x00219dd,
+        0x0021a01, 0x0021f71, 0x0021f83, 0x0021fa1, 0x0022004, 0x002493d, 0x0024944, 0x00249dd, 0x0024a04, 0x0024afd,
+        0x0024b04, 0x0024b3d, 0x0024b44, 0x0024bdd, 0x0024c04, 0x002513d, 0x0025144, 0x00251dd, 0x0025204, 0x002563d,
+        0x0025644, 0x00256dd, 0x0025704, 0x00257fd, 0x0025804, 0x002583d, 0x0025844, 0x00258dd, 0x0025904, 0x0025afd,
+        0x0025b04, 0x002623d, 0x0026244, 0x00262dd, 0x0026304, 0x0026b7d, 0x0026ba5, 0x0026c11, 0x0026d2a, 0x0026fbd,
+        0x0027004, 0x0027215, 0x002735d, 0x0027400, 0x0027edd, 0x0027f01, 0x0027fdd, 0x002800c, 0x0028024, 0x002cdb5,
+        0x002cdd1, 0x002cde4, 0x002d016, 0x002d024, 0x002d36d, 0x002d38e, 0x002d3bd, 0x002d404, 0x002dd71, 0x002ddc9,
+        0x002de24, 0x002df3d, 0x002e004, 0x002e245, 0x002e2a6, 0x002e2dd, 0x002e3e4, 0x002e645, 0x002e686, 0x002e6b1,
+        0x002e6fd, 0x002e804, 0x002ea45, 0x002ea9d, 0x002ec04, 0x002edbd, 0x002edc4, 0x002ee3d, 0x002ee45, 0x002ee9d,
+        0x002f004, 0x002f685, 0x002f6c6, 0x002f6e5, 0x002f7c6, 0x002f8c5, 0x002f8e6, 0x002f925, 0x002fa91, 0x002fae3,
+        0x002fb11, 0x002fb73, 0x002fb84, 0x002fba5, 0x002fbdd, 0x002fc08, 0x002fd5d, 0x002fe0a, 0x002ff5d, 0x0030011,
+        0x00300cc, 0x00300f1, 0x0030165, 0x00301da, 0x00301e5, 0x0030208, 0x003035d, 0x0030404, 0x0030863, 0x0030884,
+        0x0030f3d, 0x0031004, 0x00310a5, 0x00310e4, 0x0031525, 0x0031544, 0x003157d, 0x0031604, 0x0031edd, 0x0032004,
+        0x00323fd, 0x0032405, 0x0032466, 0x00324e5, 0x0032526, 0x003259d, 0x0032606, 0x0032645, 0x0032666, 0x0032725,
+        0x003279d, 0x0032815, 0x003283d, 0x0032891, 0x00328c8, 0x0032a04, 0x0032ddd, 0x0032e04, 0x0032ebd, 0x0033004,
+        0x003359d, 0x0033604, 0x003395d, 0x0033a08, 0x0033b4a, 0x0033b7d, 0x0033bd5, 0x0034004, 0x00342e5, 0x0034326,
+        0x0034365, 0x003439d, 0x00343d1, 0x0034404, 0x0034aa6, 0x0034ac5, 0x0034ae6, 0x0034b05, 0x0034bfd, 0x0034c05,
+        0x0034c26, 0x0034c45, 0x0034c66, 0x0034ca5, 0x0034da6, 0x0034e65, 0x0034fbd, 0x0034fe5, 0x0035008, 0x003515d,
+        0x0035208, 0x003535d, 0x0035411, 0x00354e3, 0x0035511, 0x00355dd, 0x0035605, 0x00357c7, 0x00357e5, 0x00359fd,
+        0x0036005, 0x0036086, 0x00360a4, 0x0036685, 0x00366a6, 0x00366c5, 0x0036766, 0x0036785, 0x00367a6, 0x0036845,
+        0x0036866, 0x00368a4, 0x00369bd, 0x0036a08, 0x0036b51, 0x0036c35, 0x0036d65, 0x0036e95, 0x0036fb1, 0x0036ffd,
+        0x0037005, 0x0037046, 0x0037064, 0x0037426, 0x0037445, 0x00374c6, 0x0037505, 0x0037546, 0x0037565, 0x00375c4,
+        0x0037608, 0x0037744, 0x0037cc5, 0x0037ce6, 0x0037d05, 0x0037d46, 0x0037da5, 0x0037dc6, 0x0037de5, 0x0037e46,
+        0x0037e9d, 0x0037f91, 0x0038004, 0x0038486, 0x0038585, 0x0038686, 0x00386c5, 0x003871d, 0x0038771, 0x0038808,
+        0x003895d, 0x00389a4, 0x0038a08, 0x0038b44, 0x0038f03, 0x0038fd1, 0x0039001, 0x003913d, 0x0039200, 0x003977d,
+        0x00397a0, 0x0039811, 0x003991d, 0x0039a05, 0x0039a71, 0x0039a85, 0x0039c26, 0x0039c45, 0x0039d24, 0x0039da5,
+        0x0039dc4, 0x0039e85, 0x0039ea4, 0x0039ee6, 0x0039f05, 0x0039f44, 0x0039f7d, 0x003a001, 0x003a583, 0x003ad61,
+        0x003af03, 0x003af21, 0x003b363, 0x003b805, 0x003c000, 0x003c021, 0x003c040, 0x003c061, 0x003c080, 0x003c0a1,
+        0x003c0c0, 0x003c0e1, 0x003c100, 0x003c121, 0x003c140, 0x003c161, 0x003c180, 0x003c1a1, 0x003c1c0, 0x003c1e1,
+        0x003c200, 0x003c221, 0x003c240, 0x003c261, 0x003c280, 0x003c2a1, 0x003c2c0, 0x003c2e1, 0x003c300, 0x003c321,
+        0x003c340, 0x003c361, 0x003c380, 0x003c3a1, 0x003c3c0, 0x003c3e1, 0x003c400, 0x003c421, 0x003c440, 0x003c461,
+        0x003c480, 0x003c4a1, 0x003c4c0, 0x003c4e1, 0x003c500, 0x003c521, 0x003c540, 0x003c561, 0x003c580, 0x003c5a1,
+        0x003c5c0, 0x003c5e1, 0x003c600, 0x003c621, 0x003c640, 0x003c661, 0x003c680, 0x003c6a1, 0x003c6c0, 0x003c6e1,
+        0x003c700, 0x003c721, 0x003c740, 0x003c761, 0x003c780, 0x003c7a1, 0x003c7c0, 0x003c7e1, 0x003c800, 0x003c821,
+        0x003c840, 0x003c861, 0x003c880, 0x003c8a1, 0x003c8c0, 0x003c8e1, 0x003c900, 0x003c921, 0x003c940, 0x003c961,
+        0x003c980, 0x003c9a1, 0x003c9c0, 0x003c9e1, 0x003ca00, 0x003ca21, 0x003ca40, 0x003ca61, 0x003ca80, 0x003caa1,
+        0x003cac0, 0x003cae1, 0x003cb00, 0x003cb21, 0x003cb40, 0x003cb61, 0x003cb80, 0x003cba1, 0x003cbc0, 0x003cbe1,
+        0x003cc00, 0x003cc21, 0x003cc40, 0x003cc61, 0x003cc80, 0x003cca1, 0x003ccc0, 0x003cce1, 0x003cd00, 0x003cd21,
+        0x003cd40, 0x003cd61, 0x003cd80, 0x003cda1, 0x003cdc0, 0x003cde1, 0x003ce00, 0x003ce21, 0x003ce40, 0x003ce61,
+        0x003ce80, 0x003cea1, 0x003cec0, 0x003cee1, 0x003cf00, 0x003cf21, 0x003cf40, 0x003cf61, 0x003cf80, 0x003cfa1,
+        0x003cfc0, 0x003cfe1, 0x003d000, 0x003d021, 0x003d040, 0x003d061, 0x003d080, 0x003d0a1, 0x003d0c0, 0x003d0e1,
+        0x003d100, 0x003d121, 0x003d140, 0x003d161, 0x003d180, 0x003d1a1, 0x003d1c0, 0x003d1e1, 0x003d200, 0x003d221,
+        0x003d240, 0x003d261, 0x003d280, 0x003d2a1, 0x003d3c0, 0x003d3e1, 0x003d400, 0x003d421, 0x003d440, 0x003d461,
+        0x003d480, 0x003d4a1, 0x003d4c0, 0x003d4e1, 0x003d500, 0x003d521, 0x003d540, 0x003d561, 0x003d580, 0x003d5a1,
+        0x003d5c0, 0x003d5e1, 0x003d600, 0x003d621, 0x003d640, 0x003d661, 0x003d680, 0x003d6a1, 0x003d6c0, 0x003d6e1,
+        0x003d700, 0x003d721, 0x003d740, 0x003d761, 0x003d780, 0x003d7a1, 0x003d7c0, 0x003d7e1, 0x003d800, 0x003d821,
+        0x003d840, 0x003d861, 0x003d880, 0x003d8a1, 0x003d8c0, 0x003d8e1, 0x003d900, 0x003d921, 0x003d940, 0x003d961,
+        0x003d980, 0x003d9a1, 0x003d9c0, 0x003d9e1, 0x003da00, 0x003da21, 0x003da40, 0x003da61, 0x003da80, 0x003daa1,
+        0x003dac0, 0x003dae1, 0x003db00, 0x003db21, 0x003db40, 0x003db61, 0x003db80, 0x003dba1, 0x003dbc0, 0x003dbe1,
+        0x003dc00, 0x003dc21, 0x003dc40, 0x003dc61, 0x003dc80, 0x003dca1, 0x003dcc0, 0x003dce1, 0x003dd00, 0x003dd21,
+        0x003dd40, 0x003dd61, 0x003dd80, 0x003dda1, 0x003ddc0, 0x003dde1, 0x003de00, 0x003de21, 0x003de40, 0x003de61,
+        0x003de80, 0x003dea1, 0x003dec0, 0x003dee1, 0x003df00, 0x003df21, 0x003df40, 0x003df61, 0x003df80, 0x003dfa1,
+        0x003dfc0, 0x003dfe1, 0x003e100, 0x003e201, 0x003e2dd, 0x003e300, 0x003e3dd, 0x003e401, 0x003e500, 0x003e601,
+        0x003e700, 0x003e801, 0x003e8dd, 0x003e900, 0x003e9dd, 0x003ea01, 0x003eb1d, 0x003eb20, 0x003eb5d, 0x003eb60,
+        0x003eb9d, 0x003eba0, 0x003ebdd, 0x003ebe0, 0x003ec01, 0x003ed00, 0x003ee01, 0x003efdd, 0x003f001, 0x003f102,
+        0x003f201, 0x003f302, 0x003f401, 0x003f502, 0x003f601, 0x003f6bd, 0x003f6c1, 0x003f700, 0x003f782, 0x003f7b4,
+        0x003f7c1, 0x003f7f4, 0x003f841, 0x003f8bd, 0x003f8c1, 0x003f900, 0x003f982, 0x003f9b4, 0x003fa01, 0x003fa9d,
+        0x003fac1, 0x003fb00, 0x003fb9d, 0x003fbb4, 0x003fc01, 0x003fd00, 0x003fdb4, 0x003fe1d, 0x003fe41, 0x003febd,
+        0x003fec1, 0x003ff00, 0x003ff82, 0x003ffb4, 0x003fffd, 0x0040016, 0x004017a, 0x004020c, 0x00402d1, 0x004030f,
+        0x0040330, 0x004034d, 0x004036f, 0x00403b0, 0x00403cd, 0x00403ef, 0x0040411, 0x0040517, 0x0040538, 0x004055a,
+        0x00405f6, 0x0040611, 0x004072f, 0x0040750, 0x0040771, 0x00407eb, 0x0040831, 0x0040892, 0x00408ad, 0x00408ce,
+        0x00408f1, 0x0040a52, 0x0040a71, 0x0040a8b, 0x0040ab1, 0x0040bf6, 0x0040c1a, 0x0040cbd, 0x0040cda, 0x0040e0a,
+        0x0040e23, 0x0040e5d, 0x0040e8a, 0x0040f52, 0x0040fad, 0x0040fce, 0x0040fe3, 0x004100a, 0x0041152, 0x00411ad,
+        0x00411ce, 0x00411fd, 0x0041203, 0x00413bd, 0x0041413, 0x004183d, 0x0041a05, 0x0041ba7, 0x0041c25, 0x0041c47,
+        0x0041ca5, 0x0041e3d, 0x0042015, 0x0042040, 0x0042075, 0x00420e0, 0x0042115, 0x0042141, 0x0042160, 0x00421c1,
+        0x0042200, 0x0042261, 0x0042295, 0x00422a0, 0x00422d5, 0x0042312, 0x0042320, 0x00423d5, 0x0042480, 0x00424b5,
+        0x00424c0, 0x00424f5, 0x0042500, 0x0042535, 0x0042540, 0x00425d5, 0x00425e1, 0x0042600, 0x0042681, 0x00426a4,
+        0x0042721, 0x0042755, 0x0042781, 0x00427c0, 0x0042812, 0x00428a0, 0x00428c1, 0x0042955, 0x0042972, 0x0042995,
+        0x00429c1, 0x00429f5, 0x0042a0a, 0x0042c09, 0x0043060, 0x0043081, 0x00430a9, 0x004312a, 0x0043155, 0x004319d,
+        0x0043212, 0x00432b5, 0x0043352, 0x0043395, 0x0043412, 0x0043435, 0x0043472, 0x0043495, 0x00434d2, 0x00434f5,
+        0x00435d2, 0x00435f5, 0x00439d2, 0x0043a15, 0x0043a52, 0x0043a75, 0x0043a92, 0x0043ab5, 0x0043e92, 0x0046015,
+        0x004610d, 0x004612e, 0x004614d, 0x004616e, 0x0046195, 0x0046412, 0x0046455, 0x004652d, 0x004654e, 0x0046575,
+        0x0046f92, 0x0046fb5, 0x0047372, 0x0047695, 0x0047b92, 0x0047c55, 0x00484fd, 0x0048815, 0x004897d, 0x0048c0a,
+        0x0049395, 0x0049d4a, 0x004a015, 0x004b6f2, 0x004b715, 0x004b832, 0x004b855, 0x004bf12, 0x004c015, 0x004cdf2,
+        0x004ce15, 0x004ed0d, 0x004ed2e, 0x004ed4d, 0x004ed6e, 0x004ed8d, 0x004edae, 0x004edcd, 0x004edee, 0x004ee0d,
+        0x004ee2e, 0x004ee4d, 0x004ee6e, 0x004ee8d, 0x004eeae, 0x004eeca, 0x004f295, 0x004f812, 0x004f8ad, 0x004f8ce,
+        0x004f8f2, 0x004fccd, 0x004fcee, 0x004fd0d, 0x004fd2e, 0x004fd4d, 0x004fd6e, 0x004fd8d, 0x004fdae, 0x004fdcd,
+        0x004fdee, 0x004fe12, 0x0050015, 0x0052012, 0x005306d, 0x005308e, 0x00530ad, 0x00530ce, 0x00530ed, 0x005310e,
+        0x005312d, 0x005314e, 0x005316d, 0x005318e, 0x00531ad, 0x00531ce, 0x00531ed, 0x005320e, 0x005322d, 0x005324e,
+        0x005326d, 0x005328e, 0x00532ad, 0x00532ce, 0x00532ed, 0x005330e, 0x0053332, 0x0053b0d, 0x0053b2e, 0x0053b4d,
+        0x0053b6e, 0x0053b92, 0x0053f8d, 0x0053fae, 0x0053fd2, 0x0056015, 0x0056612, 0x00568b5, 0x00568f2, 0x00569b5,
+        0x0056e9d, 0x0056ed5, 0x00572dd, 0x00572f5, 0x0058000, 0x0058601, 0x0058c00, 0x0058c21, 0x0058c40, 0x0058ca1,
+        0x0058ce0, 0x0058d01, 0x0058d20, 0x0058d41, 0x0058d60, 0x0058d81, 0x0058da0, 0x0058e21, 0x0058e40, 0x0058e61,
+        0x0058ea0, 0x0058ec1, 0x0058f83, 0x0058fc0, 0x0059021, 0x0059040, 0x0059061, 0x0059080, 0x00590a1, 0x00590c0,
+        0x00590e1, 0x0059100, 0x0059121, 0x0059140, 0x0059161, 0x0059180, 0x00591a1, 0x00591c0, 0x00591e1, 0x0059200,
+        0x0059221, 0x0059240, 0x0059261, 0x0059280, 0x00592a1, 0x00592c0, 0x00592e1, 0x0059300, 0x0059321, 0x0059340,
+        0x0059361, 0x0059380, 0x00593a1, 0x00593c0, 0x00593e1, 0x0059400, 0x0059421, 0x0059440, 0x0059461, 0x0059480,
+        0x00594a1, 0x00594c0, 0x00594e1, 0x0059500, 0x0059521, 0x0059540, 0x0059561, 0x0059580, 0x00595a1, 0x00595c0,
+        0x00595e1, 0x0059600, 0x0059621, 0x0059640, 0x0059661, 0x0059680, 0x00596a1, 0x00596c0, 0x00596e1, 0x0059700,
+        0x0059721, 0x0059740, 0x0059761, 0x0059780, 0x00597a1, 0x00597c0, 0x00597e1, 0x0059800, 0x0059821, 0x0059840,
+        0x0059861, 0x0059880, 0x00598a1, 0x00598c0, 0x00598e1, 0x0059900, 0x0059921, 0x0059940, 0x0059961, 0x0059980,
+        0x00599a1, 0x00599c0, 0x00599e1, 0x0059a00, 0x0059a21, 0x0059a40, 0x0059a61, 0x0059a80, 0x0059aa1, 0x0059ac0,
+        0x0059ae1, 0x0059b00, 0x0059b21, 0x0059b40, 0x0059b61, 0x0059b80, 0x0059ba1, 0x0059bc0, 0x0059be1, 0x0059c00,
+        0x0059c21, 0x0059c40, 0x0059c61, 0x0059cb5, 0x0059d60, 0x0059d81, 0x0059da0, 0x0059dc1, 0x0059de5, 0x0059e40,
+        0x0059e61, 0x0059e9d, 0x0059f31, 0x0059faa, 0x0059fd1, 0x005a001, 0x005a4dd, 0x005a4e1, 0x005a51d, 0x005a5a1,
+        0x005a5dd, 0x005a604, 0x005ad1d, 0x005ade3, 0x005ae11, 0x005ae3d, 0x005afe5, 0x005b004, 0x005b2fd, 0x005b404,
+        0x005b4fd, 0x005b504, 0x005b5fd, 0x005b604, 0x005b6fd, 0x005b704, 0x005b7fd, 0x005b804, 0x005b8fd, 0x005b904,
+        0x005b9fd, 0x005ba04, 0x005bafd, 0x005bb04, 0x005bbfd, 0x005bc05, 0x005c011, 0x005c04f, 0x005c070, 0x005c08f,
+        0x005c0b0, 0x005c0d1, 0x005c12f, 0x005c150, 0x005c171, 0x005c18f, 0x005c1b0, 0x005c1d1, 0x005c2ec, 0x005c311,
+        0x005c34c, 0x005c371, 0x005c38f, 0x005c3b0, 0x005c3d1, 0x005c40f, 0x005c430, 0x005c44d, 0x005c46e, 0x005c48d,
+        0x005c4ae, 0x005c4cd, 0x005c4ee, 0x005c50d, 0x005c52e, 0x005c551, 0x005c5e3, 0x005c611, 0x005c74c, 0x005c791,
+        0x005c80c, 0x005c831, 0x005c84d, 0x005c871, 0x005ca15, 0x005ca51, 0x005caad, 0x005cace, 0x005caed, 0x005cb0e,
+        0x005cb2d, 0x005cb4e, 0x005cb6d, 0x005cb8e, 0x005cbac, 0x005cbdd, 0x005d015, 0x005d35d, 0x005d375, 0x005de9d,
+        0x005e015, 0x005fadd, 0x005fe15, 0x005ff9d, 0x0060016, 0x0060031, 0x0060095, 0x00600a3, 0x00600c4, 0x00600e9,
+        0x006010d, 0x006012e, 0x006014d, 0x006016e, 0x006018d, 0x00601ae, 0x00601cd, 0x00601ee, 0x006020d, 0x006022e,
+        0x0060255, 0x006028d, 0x00602ae, 0x00602cd, 0x00602ee, 0x006030d, 0x006032e, 0x006034d, 0x006036e, 0x006038c,
+        0x00603ad, 0x00603ce, 0x0060415, 0x0060429, 0x0060545, 0x00605c6, 0x006060c, 0x0060623, 0x00606d5, 0x0060709,
+        0x0060763, 0x0060784, 0x00607b1, 0x00607d5, 0x006081d, 0x0060824, 0x00612fd, 0x0061325, 0x0061374, 0x00613a3,
+        0x00613e4, 0x006140c, 0x0061424, 0x0061f71, 0x0061f83, 0x0061fe4, 0x006201d, 0x00620a4, 0x006261d, 0x0062624,
+        0x00631fd, 0x0063215, 0x006324a, 0x00632d5, 0x0063404, 0x0063815, 0x0063c9d, 0x0063e04, 0x0064015, 0x00643fd,
+        0x006440a, 0x0064555, 0x006490a, 0x0064a15, 0x0064a2a, 0x0064c15, 0x006500a, 0x0065155, 0x006562a, 0x0065815,
+        0x0068004, 0x009b815, 0x009c004, 0x01402a3, 0x01402c4, 0x01491bd, 0x0149215, 0x01498fd, 0x0149a04, 0x0149f03,
+        0x0149fd1, 0x014a004, 0x014c183, 0x014c1b1, 0x014c204, 0x014c408, 0x014c544, 0x014c59d, 0x014c800, 0x014c821,
+        0x014c840, 0x014c861, 0x014c880, 0x014c8a1, 0x014c8c0, 0x014c8e1, 0x014c900, 0x014c921, 0x014c940, 0x014c961,
+        0x014c980, 0x014c9a1, 0x014c9c0, 0x014c9e1, 0x014ca00, 0x014ca21, 0x014ca40, 0x014ca61, 0x014ca80, 0x014caa1,
+        0x014cac0, 0x014cae1, 0x014cb00, 0x014cb21, 0x014cb40, 0x014cb61, 0x014cb80, 0x014cba1, 0x014cbc0, 0x014cbe1,
+        0x014cc00, 0x014cc21, 0x014cc40, 0x014cc61, 0x014cc80, 0x014cca1, 0x014ccc0, 0x014cce1, 0x014cd00, 0x014cd21,
+        0x014cd40, 0x014cd61, 0x014cd80, 0x014cda1, 0x014cdc4, 0x014cde5, 0x014ce07, 0x014ce71, 0x014ce85, 0x014cfd1,
+        0x014cfe3, 0x014d000, 0x014d021, 0x014d040, 0x014d061, 0x014d080, 0x014d0a1, 0x014d0c0, 0x014d0e1, 0x014d100,
+        0x014d121, 0x014d140, 0x014d161, 0x014d180, 0x014d1a1, 0x014d1c0, 0x014d1e1, 0x014d200, 0x014d221, 0x014d240,
+        0x014d261, 0x014d280, 0x014d2a1, 0x014d2c0, 0x014d2e1, 0x014d300, 0x014d321, 0x014d340, 0x014d361, 0x014d383,
+        0x014d3c5, 0x014d404, 0x014dcc9, 0x014de05, 0x014de51, 0x014df1d, 0x014e014, 0x014e2e3, 0x014e414, 0x014e440,
+        0x014e461, 0x014e480, 0x014e4a1, 0x014e4c0, 0x014e4e1, 0x014e500, 0x014e521, 0x014e540, 0x014e561, 0x014e580,
+        0x014e5a1, 0x014e5c0, 0x014e5e1, 0x014e640, 0x014e661, 0x014e680, 0x014e6a1, 0x014e6c0, 0x014e6e1, 0x014e700,
+        0x014e721, 0x014e740, 0x014e761, 0x014e780, 0x014e7a1, 0x014e7c0, 0x014e7e1, 0x014e800, 0x014e821, 0x014e840,
+        0x014e861, 0x014e880, 0x014e8a1, 0x014e8c0, 0x014e8e1, 0x014e900, 0x014e921, 0x014e940, 0x014e961, 0x014e980,
+        0x014e9a1, 0x014e9c0, 0x014e9e1, 0x014ea00, 0x014ea21, 0x014ea40, 0x014ea61, 0x014ea80, 0x014eaa1, 0x014eac0,
+        0x014eae1, 0x014eb00, 0x014eb21, 0x014eb40, 0x014eb61, 0x014eb80, 0x014eba1, 0x014ebc0, 0x014ebe1, 0x014ec00,
+        0x014ec21, 0x014ec40, 0x014ec61, 0x014ec80, 0x014eca1, 0x014ecc0, 0x014ece1, 0x014ed00, 0x014ed21, 0x014ed40,
+        0x014ed61, 0x014ed80, 0x014eda1, 0x014edc0, 0x014ede1, 0x014ee03, 0x014ee21, 0x014ef20, 0x014ef41, 0x014ef60,
+        0x014ef81, 0x014efa0, 0x014efe1, 0x014f000, 0x014f021, 0x014f040, 0x014f061, 0x014f080, 0x014f0a1, 0x014f0c0,
+        0x014f0e1, 0x014f103, 0x014f134, 0x014f160, 0x014f181, 0x014f1a0, 0x014f1c1, 0x014f1e4, 0x014f200, 0x014f221,
+        0x014f240, 0x014f261, 0x014f2c0, 0x014f2e1, 0x014f300, 0x014f321, 0x014f340, 0x014f361, 0x014f380, 0x014f3a1,
+        0x014f3c0, 0x014f3e1, 0x014f400, 0x014f421, 0x014f440, 0x014f461, 0x014f480, 0x014f4a1, 0x014f4c0, 0x014f4e1,
+        0x014f500, 0x014f521, 0x014f540, 0x014f5e1, 0x014f600, 0x014f6a1, 0x014f6c0, 0x014f6e1, 0x014f700, 0x014f721,
+        0x014f740, 0x014f761, 0x014f780, 0x014f7a1, 0x014f7c0, 0x014f7e1, 0x014f800, 0x014f821, 0x014f840, 0x014f861,
+        0x014f880, 0x014f901, 0x014f920, 0x014f941, 0x014f97d, 0x014fa00, 0x014fa21, 0x014fa5d, 0x014fa61, 0x014fa9d,
+        0x014faa1, 0x014fac0, 0x014fae1, 0x014fb00, 0x014fb21, 0x014fb5d, 0x014fe43, 0x014fea0, 0x014fec1, 0x014fee4,
+        0x014ff03, 0x014ff41, 0x014ff64, 0x0150045, 0x0150064, 0x01500c5, 0x01500e4, 0x0150165, 0x0150184, 0x0150466,
+        0x01504a5, 0x01504e6, 0x0150515, 0x0150585, 0x01505bd, 0x015060a, 0x01506d5, 0x0150713, 0x0150735, 0x015075d,
+        0x0150804, 0x0150e91, 0x0150f1d, 0x0151006, 0x0151044, 0x0151686, 0x0151885, 0x01518dd, 0x01519d1, 0x0151a08,
+        0x0151b5d, 0x0151c05, 0x0151e44, 0x0151f11, 0x0151f64, 0x0151f91, 0x0151fa4, 0x0151fe5, 0x0152008, 0x0152144,
+        0x01524c5, 0x01525d1, 0x0152604, 0x01528e5, 0x0152a46, 0x0152a9d, 0x0152bf1, 0x0152c04, 0x0152fbd, 0x0153005,
+        0x0153066, 0x0153084, 0x0153665, 0x0153686, 0x01536c5, 0x0153746, 0x0153785, 0x01537c6, 0x0153831, 0x01539dd,
+        0x01539e3, 0x0153a08, 0x0153b5d, 0x0153bd1, 0x0153c04, 0x0153ca5, 0x0153cc3, 0x0153ce4, 0x0153e08, 0x0153f44,
+        0x0153ffd, 0x0154004, 0x0154525, 0x01545e6, 0x0154625, 0x0154666, 0x01546a5, 0x01546fd, 0x0154804, 0x0154865,
+        0x0154884, 0x0154985, 0x01549a6, 0x01549dd, 0x0154a08, 0x0154b5d, 0x0154b91, 0x0154c04, 0x0154e03, 0x0154e24,
+        0x0154ef5, 0x0154f44, 0x0154f66, 0x0154f85, 0x0154fa6, 0x0154fc4, 0x0155605, 0x0155624, 0x0155645, 0x01556a4,
+        0x01556e5, 0x0155724, 0x01557c5, 0x0155804, 0x0155825, 0x0155844, 0x015587d, 0x0155b64, 0x0155ba3, 0x0155bd1,
+        0x0155c04, 0x0155d66, 0x0155d85, 0x0155dc6, 0x0155e11, 0x0155e44, 0x0155e63, 0x0155ea6, 0x0155ec5, 0x0155efd,
+        0x0156024, 0x01560fd, 0x0156124, 0x01561fd, 0x0156224, 0x01562fd, 0x0156404, 0x01564fd, 0x0156504, 0x01565fd,
+        0x0156601, 0x0156b74, 0x0156b83, 0x0156c01, 0x0156d23, 0x0156d54, 0x0156d9d, 0x0156e01, 0x0157804, 0x0157c66,
+        0x0157ca5, 0x0157cc6, 0x0157d05, 0x0157d26, 0x0157d71, 0x0157d86, 0x0157da5, 0x0157ddd, 0x0157e08, 0x0157f5d,
+        0x0158004, 0x01af49d, 0x01af604, 0x01af8fd, 0x01af964, 0x01aff9d, 0x01b001b, 0x01c001c, 0x01f2004, 0x01f4ddd,
+        0x01f4e04, 0x01f5b5d, 0x01f6001, 0x01f60fd, 0x01f6261, 0x01f631d, 0x01f63a4, 0x01f63c5, 0x01f63e4, 0x01f6532,
+        0x01f6544, 0x01f66fd, 0x01f6704, 0x01f67bd, 0x01f67c4, 0x01f67fd, 0x01f6804, 0x01f685d, 0x01f6864, 0x01f68bd,
+        0x01f68c4, 0x01f7654, 0x01f787d, 0x01f7a64, 0x01fa7ce, 0x01fa7ed, 0x01fa815, 0x01faa04, 0x01fb21d, 0x01fb244,
+        0x01fb91d, 0x01fb9f5, 0x01fba1d, 0x01fbe04, 0x01fbf93, 0x01fbfb5, 0x01fc005, 0x01fc211, 0x01fc2ed, 0x01fc30e,
+        0x01fc331, 0x01fc35d, 0x01fc405, 0x01fc611, 0x01fc62c, 0x01fc66b, 0x01fc6ad, 0x01fc6ce, 0x01fc6ed, 0x01fc70e,
+        0x01fc72d, 0x01fc74e, 0x01fc76d, 0x01fc78e, 0x01fc7ad, 0x01fc7ce, 0x01fc7ed, 0x01fc80e, 0x01fc82d, 0x01fc84e,
+        0x01fc86d, 0x01fc88e, 0x01fc8b1, 0x01fc8ed, 0x01fc90e, 0x01fc931, 0x01fc9ab, 0x01fca11, 0x01fca7d, 0x01fca91,
+        0x01fcb0c, 0x01fcb2d, 0x01fcb4e, 0x01fcb6d, 0x01fcb8e, 0x01fcbad, 0x01fcbce, 0x01fcbf1, 0x01fcc52, 0x01fcc6c,
+        0x01fcc92, 0x01fccfd, 0x01fcd11, 0x01fcd33, 0x01fcd51, 0x01fcd9d, 0x01fce04, 0x01fcebd, 0x01fcec4, 0x01fdfbd,
+        0x01fdffa, 0x01fe01d, 0x01fe031, 0x01fe093, 0x01fe0b1, 0x01fe10d, 0x01fe12e, 0x01fe151, 0x01fe172, 0x01fe191,
+        0x01fe1ac, 0x01fe1d1, 0x01fe208, 0x01fe351, 0x01fe392, 0x01fe3f1, 0x01fe420, 0x01fe76d, 0x01fe791, 0x01fe7ae,
+        0x01fe7d4, 0x01fe7eb, 0x01fe814, 0x01fe821, 0x01feb6d, 0x01feb92, 0x01febae, 0x01febd2, 0x01febed, 0x01fec0e,
+        0x01fec31, 0x01fec4d, 0x01fec6e, 0x01fec91, 0x01fecc4, 0x01fee03, 0x01fee24, 0x01ff3c3, 0x01ff404, 0x01ff7fd,
+        0x01ff844, 0x01ff91d, 0x01ff944, 0x01ffa1d, 0x01ffa44, 0x01ffb1d, 0x01ffb44, 0x01ffbbd, 0x01ffc13, 0x01ffc52,
+        0x01ffc74, 0x01ffc95, 0x01ffcb3, 0x01ffcfd, 0x01ffd15, 0x01ffd32, 0x01ffdb5, 0x01ffdfd, 0x01fff3a, 0x01fff95,
+        0x01fffdd, 0x0200004, 0x020019d, 0x02001a4, 0x02004fd, 0x0200504, 0x020077d, 0x0200784, 0x02007dd, 0x02007e4,
+        0x02009dd, 0x0200a04, 0x0200bdd, 0x0201004, 0x0201f7d, 0x0202011, 0x020207d, 0x02020ea, 0x020269d, 0x02026f5,
+        0x0202809, 0x0202eaa, 0x0202f35, 0x020314a, 0x0203195, 0x02031fd, 0x0203215, 0x02033bd, 0x0203415, 0x020343d,
+        0x0203a15, 0x0203fa5, 0x0203fdd, 0x0205004, 0x02053bd, 0x0205404, 0x0205a3d, 0x0205c05, 0x0205c2a, 0x0205f9d,
+        0x0206004, 0x020640a, 0x020649d, 0x02065a4, 0x0206829, 0x0206844, 0x0206949, 0x020697d, 0x0206a04, 0x0206ec5,
+        0x0206f7d, 0x0207004, 0x02073dd, 0x02073f1, 0x0207404, 0x020789d, 0x0207904, 0x0207a11, 0x0207a29, 0x0207add,
+        0x0208000, 0x0208501, 0x0208a04, 0x02093dd, 0x0209408, 0x020955d, 0x0209600, 0x0209a9d, 0x0209b01, 0x0209f9d,
+        0x020a004, 0x020a51d, 0x020a604, 0x020ac9d, 0x020adf1, 0x020ae00, 0x020af7d, 0x020af80, 0x020b17d, 0x020b180,
+        0x020b27d, 0x020b280, 0x020b2dd, 0x020b2e1, 0x020b45d, 0x020b461, 0x020b65d, 0x020b661, 0x020b75d, 0x020b761,
+        0x020b7bd, 0x020c004, 0x020e6fd, 0x020e804, 0x020eadd, 0x020ec04, 0x020ed1d, 0x020f003, 0x020f0dd, 0x020f0e3,
+        0x020f63d, 0x020f643, 0x020f77d, 0x0210004, 0x02100dd, 0x0210104, 0x021013d, 0x0210144, 0x02106dd, 0x02106e4,
+        0x021073d, 0x0210784, 0x02107bd, 0x02107e4, 0x0210add, 0x0210af1, 0x0210b0a, 0x0210c04, 0x0210ef5, 0x0210f2a,
+        0x0211004, 0x02113fd, 0x02114ea, 0x021161d, 0x0211c04, 0x0211e7d, 0x0211e84, 0x0211edd, 0x0211f6a, 0x0212004,
+        0x02122ca, 0x021239d, 0x02123f1, 0x0212404, 0x021275d, 0x02127f1, 0x021281d, 0x0213004, 0x021371d, 0x021378a,
+        0x02137c4, 0x021380a, 0x0213a1d, 0x0213a4a, 0x0214004, 0x0214025, 0x021409d, 0x02140a5, 0x02140fd, 0x0214185,
+        0x0214204, 0x021429d, 0x02142a4, 0x021431d, 0x0214324, 0x02146dd, 0x0214705, 0x021477d, 0x02147e5, 0x021480a,
+        0x021493d, 0x0214a11, 0x0214b3d, 0x0214c04, 0x0214faa, 0x0214ff1, 0x0215004, 0x02153aa, 0x021541d, 0x0215804,
+        0x0215915, 0x0215924, 0x0215ca5, 0x0215cfd, 0x0215d6a, 0x0215e11, 0x0215efd, 0x0216004, 0x02166dd, 0x0216731,
+        0x0216804, 0x0216add, 0x0216b0a, 0x0216c04, 0x0216e7d, 0x0216f0a, 0x0217004, 0x021725d, 0x0217331, 0x02173bd,
+        0x021752a, 0x021761d, 0x0218004, 0x021893d, 0x0219000, 0x021967d, 0x0219801, 0x0219e7d, 0x0219f4a, 0x021a004,
+        0x021a485, 0x021a51d, 0x021a608, 0x021a75d, 0x021cc0a, 0x021cffd, 0x021d004, 0x021d55d, 0x021d565, 0x021d5ac,
+        0x021d5dd, 0x021d604, 0x021d65d, 0x021e004, 0x021e3aa, 0x021e4e4, 0x021e51d, 0x021e604, 0x021e8c5, 0x021ea2a,
+        0x021eab1, 0x021eb5d, 0x021ee04, 0x021f045, 0x021f0d1, 0x021f15d, 0x021f604, 0x021f8aa, 0x021f99d, 0x021fc04,
+        0x021fefd, 0x0220006, 0x0220025, 0x0220046, 0x0220064, 0x0220705, 0x02208f1, 0x02209dd, 0x0220a4a, 0x0220cc8,
+        0x0220e05, 0x0220e24, 0x0220e65, 0x0220ea4, 0x0220edd, 0x0220fe5, 0x0221046, 0x0221064, 0x0221606, 0x0221665,
+        0x02216e6, 0x0221725, 0x0221771, 0x02217ba, 0x02217d1, 0x0221845, 0x022187d, 0x02219ba, 0x02219dd, 0x0221a04,
+        0x0221d3d, 0x0221e08, 0x0221f5d, 0x0222005, 0x0222064, 0x02224e5, 0x0222586, 0x02225a5, 0x02226bd, 0x02226c8,
+        0x0222811, 0x0222884, 0x02228a6, 0x02228e4, 0x022291d, 0x0222a04, 0x0222e65, 0x0222e91, 0x0222ec4, 0x0222efd,
+        0x0223005, 0x0223046, 0x0223064, 0x0223666, 0x02236c5, 0x02237e6, 0x0223824, 0x02238b1, 0x0223925, 0x02239b1,
+        0x02239c6, 0x02239e5, 0x0223a08, 0x0223b44, 0x0223b71, 0x0223b84, 0x0223bb1, 0x0223c1d, 0x0223c2a, 0x0223ebd,
+        0x0224004, 0x022425d, 0x0224264, 0x0224586, 0x02245e5, 0x0224646, 0x0224685, 0x02246a6, 0x02246c5, 0x0224711,
+        0x02247c5, 0x02247fd, 0x0225004, 0x02250fd, 0x0225104, 0x022513d, 0x0225144, 0x02251dd, 0x02251e4, 0x02253dd,
+        0x02253e4, 0x0225531, 0x022555d, 0x0225604, 0x0225be5, 0x0225c06, 0x0225c65, 0x0225d7d, 0x0225e08, 0x0225f5d,
+        0x0226005, 0x0226046, 0x022609d, 0x02260a4, 0x02261bd, 0x02261e4, 0x022623d, 0x0226264, 0x022653d, 0x0226544,
+        0x022663d, 0x0226644, 0x022669d, 0x02266a4, 0x022675d, 0x0226765, 0x02267a4, 0x02267c6, 0x0226805, 0x0226826,
+        0x02268bd, 0x02268e6, 0x022693d, 0x0226966, 0x02269dd, 0x0226a04, 0x0226a3d, 0x0226ae6, 0x0226b1d, 0x0226ba4,
+        0x0226c46, 0x0226c9d, 0x0226cc5, 0x0226dbd, 0x0226e05, 0x0226ebd, 0x0228004, 0x02286a6, 0x0228705, 0x0228806,
+        0x0228845, 0x02288a6, 0x02288c5, 0x02288e4, 0x0228971, 0x0228a08, 0x0228b51, 0x0228b9d, 0x0228bb1, 0x0228bc5,
+        0x0228be4, 0x0228c5d, 0x0229004, 0x0229606, 0x0229665, 0x0229726, 0x0229745, 0x0229766, 0x02297e5, 0x0229826,
+        0x0229845, 0x0229884, 0x02298d1, 0x02298e4, 0x022991d, 0x0229a08, 0x0229b5d, 0x022b004, 0x022b5e6, 0x022b645,
+        0x022b6dd, 0x022b706, 0x022b785, 0x022b7c6, 0x022b7e5, 0x022b831, 0x022bb04, 0x022bb85, 0x022bbdd, 0x022c004,
+        0x022c606, 0x022c665, 0x022c766, 0x022c7a5, 0x022c7c6, 0x022c7e5, 0x022c831, 0x022c884, 0x022c8bd, 0x022ca08,
+        0x022cb5d, 0x022cc11, 0x022cdbd, 0x022d004, 0x022d565, 0x022d586, 0x022d5a5, 0x022d5c6, 0x022d605, 0x022d6c6,
+        0x022d6e5, 0x022d704, 0x022d731, 0x022d75d, 0x022d808, 0x022d95d, 0x022e004, 0x022e37d, 0x022e3a5, 0x022e406,
+        0x022e445, 0x022e4c6, 0x022e4e5, 0x022e59d, 0x022e608, 0x022e74a, 0x022e791, 0x022e7f5, 0x022e804, 0x022e8fd,
+        0x0230004, 0x0230586, 0x02305e5, 0x0230706, 0x0230725, 0x0230771, 0x023079d, 0x0231400, 0x0231801, 0x0231c08,
+        0x0231d4a, 0x0231e7d, 0x0231fe4, 0x02320fd, 0x0232124, 0x023215d, 0x0232184, 0x023229d, 0x02322a4, 0x02322fd,
+        0x0232304, 0x0232606, 0x02326dd, 0x02326e6, 0x023273d, 0x0232765, 0x02327a6, 0x02327c5, 0x02327e4, 0x0232806,
+        0x0232824, 0x0232846, 0x0232865, 0x0232891, 0x02328fd, 0x0232a08, 0x0232b5d, 0x0233404, 0x023351d, 0x0233544,
+        0x0233a26, 0x0233a85, 0x0233b1d, 0x0233b45, 0x0233b86, 0x0233c05, 0x0233c24, 0x0233c51, 0x0233c64, 0x0233c86,
+        0x0233cbd, 0x0234004, 0x0234025, 0x0234164, 0x0234665, 0x0234726, 0x0234744, 0x0234765, 0x02347f1, 0x02348e5,
+        0x023491d, 0x0234a04, 0x0234a25, 0x0234ae6, 0x0234b25, 0x0234b84, 0x0235145, 0x02352e6, 0x0235305, 0x0235351,
+        0x02353a4, 0x02353d1, 0x023547d, 0x0235604, 0x0235f3d, 0x0238004, 0x023813d, 0x0238144, 0x02385e6, 0x0238605,
+        0x02386fd, 0x0238705, 0x02387c6, 0x02387e5, 0x0238804, 0x0238831, 0x02388dd, 0x0238a08, 0x0238b4a, 0x0238dbd,
+        0x0238e11, 0x0238e44, 0x023921d, 0x0239245, 0x023951d, 0x0239526, 0x0239545, 0x0239626, 0x0239645, 0x0239686,
+        0x02396a5, 0x02396fd, 0x023a004, 0x023a0fd, 0x023a104, 0x023a15d, 0x023a164, 0x023a625, 0x023a6fd, 0x023a745,
+        0x023a77d, 0x023a785, 0x023a7dd, 0x023a7e5, 0x023a8c4, 0x023a8e5, 0x023a91d, 0x023aa08, 0x023ab5d, 0x023ac04,
+        0x023acdd, 0x023ace4, 0x023ad3d, 0x023ad44, 0x023b146, 0x023b1fd, 0x023b205, 0x023b25d, 0x023b266, 0x023b2a5,
+        0x023b2c6, 0x023b2e5, 0x023b304, 0x023b33d, 0x023b408, 0x023b55d, 0x023dc04, 0x023de65, 0x023dea6, 0x023def1,
+        0x023df3d, 0x023f604, 0x023f63d, 0x023f80a, 0x023fab5, 0x023fbb3, 0x023fc35, 0x023fe5d, 0x023fff1, 0x0240004,
+        0x024735d, 0x0248009, 0x0248dfd, 0x0248e11, 0x0248ebd, 0x0249004, 0x024a89d, 0x025f204, 0x025fe31, 0x025fe7d,
+        0x0260004, 0x02685fd, 0x026861a, 0x026873d, 0x0288004, 0x028c8fd, 0x02d0004, 0x02d473d, 0x02d4804, 0x02d4bfd,
+        0x02d4c08, 0x02d4d5d, 0x02d4dd1, 0x02d4e04, 0x02d57fd, 0x02d5808, 0x02d595d, 0x02d5a04, 0x02d5ddd, 0x02d5e05,
+        0x02d5eb1, 0x02d5edd, 0x02d6004, 0x02d6605, 0x02d66f1, 0x02d6795, 0x02d6803, 0x02d6891, 0x02d68b5, 0x02d68dd,
+        0x02d6a08, 0x02d6b5d, 0x02d6b6a, 0x02d6c5d, 0x02d6c64, 0x02d6f1d, 0x02d6fa4, 0x02d721d, 0x02dc800, 0x02dcc01,
+        0x02dd00a, 0x02dd2f1, 0x02dd37d, 0x02de004, 0x02de97d, 0x02de9e5, 0x02dea04, 0x02dea26, 0x02df11d, 0x02df1e5,
+        0x02df263, 0x02df41d, 0x02dfc03, 0x02dfc51, 0x02dfc63, 0x02dfc85, 0x02dfcbd, 0x02dfe06, 0x02dfe5d, 0x02e0004,
+        0x030ff1d, 0x0310004, 0x0319add, 0x031a004, 0x031a13d, 0x035fe03, 0x035fe9d, 0x035fea3, 0x035ff9d, 0x035ffa3,
+        0x035fffd, 0x0360004, 0x036247d, 0x0362a04, 0x0362a7d, 0x0362c84, 0x0362d1d, 0x0362e04, 0x0365f9d, 0x0378004,
+        0x0378d7d, 0x0378e04, 0x0378fbd, 0x0379004, 0x037913d, 0x0379204, 0x037935d, 0x0379395, 0x03793a5, 0x03793f1,
+        0x037941a, 0x037949d, 0x039e005, 0x039e5dd, 0x039e605, 0x039e8fd, 0x039ea15, 0x039f89d, 0x03a0015, 0x03a1edd,
+        0x03a2015, 0x03a24fd, 0x03a2535, 0x03a2ca6, 0x03a2ce5, 0x03a2d55, 0x03a2da6, 0x03a2e7a, 0x03a2f65, 0x03a3075,
+        0x03a30a5, 0x03a3195, 0x03a3545, 0x03a35d5, 0x03a3d7d, 0x03a4015, 0x03a4845, 0x03a48b5, 0x03a48dd, 0x03a5c0a,
+        0x03a5e9d, 0x03a6015, 0x03a6afd, 0x03a6c0a, 0x03a6f3d, 0x03a8000, 0x03a8341, 0x03a8680, 0x03a89c1, 0x03a8abd,
+        0x03a8ac1, 0x03a8d00, 0x03a9041, 0x03a9380, 0x03a93bd, 0x03a93c0, 0x03a941d, 0x03a9440, 0x03a947d, 0x03a94a0,
+        0x03a94fd, 0x03a9520, 0x03a95bd, 0x03a95c0, 0x03a96c1, 0x03a975d, 0x03a9761, 0x03a979d, 0x03a97a1, 0x03a989d,
+        0x03a98a1, 0x03a9a00, 0x03a9d41, 0x03aa080, 0x03aa0dd, 0x03aa0e0, 0x03aa17d, 0x03aa1a0, 0x03aa2bd, 0x03aa2c0,
+        0x03aa3bd, 0x03aa3c1, 0x03aa700, 0x03aa75d, 0x03aa760, 0x03aa7fd, 0x03aa800, 0x03aa8bd, 0x03aa8c0, 0x03aa8fd,
+        0x03aa940, 0x03aaa3d, 0x03aaa41, 0x03aad80, 0x03ab0c1, 0x03ab400, 0x03ab741, 0x03aba80, 0x03abdc1, 0x03ac100,
+        0x03ac441, 0x03ac780, 0x03acac1, 0x03ace00, 0x03ad141, 0x03ad4dd, 0x03ad500, 0x03ad832, 0x03ad841, 0x03adb72,
+        0x03adb81, 0x03adc40, 0x03adf72, 0x03adf81, 0x03ae2b2, 0x03ae2c1, 0x03ae380, 0x03ae6b2, 0x03ae6c1, 0x03ae9f2,
+        0x03aea01, 0x03aeac0, 0x03aedf2, 0x03aee01, 0x03af132, 0x03af141, 0x03af200, 0x03af532, 0x03af541, 0x03af872,
+        0x03af881, 0x03af940, 0x03af961, 0x03af99d, 0x03af9c8, 0x03b0015, 0x03b4005, 0x03b46f5, 0x03b4765, 0x03b4db5,
+        0x03b4ea5, 0x03b4ed5, 0x03b5085, 0x03b50b5, 0x03b50f1, 0x03b519d, 0x03b5365, 0x03b541d, 0x03b5425, 0x03b561d,
+        0x03be001, 0x03be144, 0x03be161, 0x03be3fd, 0x03c0005, 0x03c00fd, 0x03c0105, 0x03c033d, 0x03c0365, 0x03c045d,
+        0x03c0465, 0x03c04bd, 0x03c04c5, 0x03c057d, 0x03c2004, 0x03c25bd, 0x03c2605, 0x03c26e3, 0x03c27dd, 0x03c2808,
+        0x03c295d, 0x03c29c4, 0x03c29f5, 0x03c2a1d, 0x03c5204, 0x03c55c5, 0x03c55fd, 0x03c5804, 0x03c5d85, 0x03c5e08,
+        0x03c5f5d, 0x03c5ff3, 0x03c601d, 0x03cfc04, 0x03cfcfd, 0x03cfd04, 0x03cfd9d, 0x03cfda4, 0x03cfdfd, 0x03cfe04,
+        0x03cfffd, 0x03d0004, 0x03d18bd, 0x03d18ea, 0x03d1a05, 0x03d1afd, 0x03d2000, 0x03d2441, 0x03d2885, 0x03d2963,
+        0x03d299d, 0x03d2a08, 0x03d2b5d, 0x03d2bd1, 0x03d2c1d, 0x03d8e2a, 0x03d9595, 0x03d95aa, 0x03d9613, 0x03d962a,
+        0x03d96bd, 0x03da02a, 0x03da5d5, 0x03da5ea, 0x03da7dd, 0x03dc004, 0x03dc09d, 0x03dc0a4, 0x03dc41d, 0x03dc424,
+        0x03dc47d, 0x03dc484, 0x03dc4bd, 0x03dc4e4, 0x03dc51d, 0x03dc524, 0x03dc67d, 0x03dc684, 0x03dc71d, 0x03dc724,
+        0x03dc75d, 0x03dc764, 0x03dc79d, 0x03dc844, 0x03dc87d, 0x03dc8e4, 0x03dc91d, 0x03dc924, 0x03dc95d, 0x03dc964,
+        0x03dc99d, 0x03dc9a4, 0x03dca1d, 0x03dca24, 0x03dca7d, 0x03dca84, 0x03dcabd, 0x03dcae4, 0x03dcb1d, 0x03dcb24,
+        0x03dcb5d, 0x03dcb64, 0x03dcb9d, 0x03dcba4, 0x03dcbdd, 0x03dcbe4, 0x03dcc1d, 0x03dcc24, 0x03dcc7d, 0x03dcc84,
+        0x03dccbd, 0x03dcce4, 0x03dcd7d, 0x03dcd84, 0x03dce7d, 0x03dce84, 0x03dcf1d, 0x03dcf24, 0x03dcfbd, 0x03dcfc4,
+        0x03dcffd, 0x03dd004, 0x03dd15d, 0x03dd164, 0x03dd39d, 0x03dd424, 0x03dd49d, 0x03dd4a4, 0x03dd55d, 0x03dd564,
+        0x03dd79d, 0x03dde12, 0x03dde5d, 0x03e0015, 0x03e059d, 0x03e0615, 0x03e129d, 0x03e1415, 0x03e15fd, 0x03e1635,
+        0x03e181d, 0x03e1835, 0x03e1a1d, 0x03e1a35, 0x03e1edd, 0x03e200a, 0x03e21b5, 0x03e35dd, 0x03e3cd5, 0x03e407d,
+        0x03e4215, 0x03e479d, 0x03e4815, 0x03e493d, 0x03e4a15, 0x03e4a5d, 0x03e4c15, 0x03e4cdd, 0x03e6015, 0x03e7f74,
+        0x03e8015, 0x03edb1d, 0x03edbb5, 0x03eddbd, 0x03ede15, 0x03edfbd, 0x03ee015, 0x03eee9d, 0x03ef015, 0x03efb3d,
+        0x03efc15, 0x03efd9d, 0x03efe15, 0x03efe3d, 0x03f0015, 0x03f019d, 0x03f0215, 0x03f091d, 0x03f0a15, 0x03f0b5d,
+        0x03f0c15, 0x03f111d, 0x03f1215, 0x03f15dd, 0x03f1615, 0x03f165d, 0x03f2015, 0x03f4a9d, 0x03f4c15, 0x03f4ddd,
+        0x03f4e15, 0x03f4ebd, 0x03f4f15, 0x03f4fbd, 0x03f5015, 0x03f50fd, 0x03f5215, 0x03f55bd, 0x03f5615, 0x03f577d,
+        0x03f5815, 0x03f58dd, 0x03f5a15, 0x03f5b5d, 0x03f5c15, 0x03f5d1d, 0x03f5e15, 0x03f5efd, 0x03f6015, 0x03f727d,
+        0x03f7295, 0x03f797d, 0x03f7e08, 0x03f7f5d, 0x0400004, 0x054dc1d, 0x054e004, 0x056e73d, 0x056e804, 0x05703dd,
+        0x0570404, 0x059d45d, 0x059d604, 0x05d7c3d, 0x05f0004, 0x05f43dd, 0x0600004, 0x062697d, 0x1c0003a, 0x1c0005d,
+        0x1c0041a, 0x1c0101d, 0x1c02005, 0x1c03e1d, 0x1e0001c, 0x1ffffdd, 0x200001c, 0x21fffdd,
+    };
+};
+
+#endif /* CPPARSEC_UNICODE_TABLES_H */
@@ -0,0 +1,319 @@
+#ifndef CPPARSEC_UTF8_H
+#define CPPARSEC_UTF8_H
+
+#include <array>
+#include "cpparsec_char.h"
+#include "cpparsec_unicode_tables.h"
+
+namespace cpparsec {
+
+    // ========================== UNICODE CATEGORIES ==========================
+
+    // Unicode general categories, grouped so each major class is a contiguous range
+    enum class GeneralCategory : uint8_t {
+        Lu, Ll, Lt, Lm, Lo,             // letters
+        Mn, Mc, Me,                     // marks
+        Nd, Nl, No,                     // numbers
+        Pc, Pd, Ps, Pe, Pi, Pf, Po,     // punctuation
+        Sm, Sc, Sk, So,                 // symbols
+        Zs, Zl, Zp,                     // separators
+        Cc, Cf, Cs, Co, Cn,             // other
+    };
+
+    // Returns the general category of a codepoint
+    constexpr GeneralCategory general_category(char32_t c);
+
+    // Returns the two letter name of a general category, e.g. "Lu"
+    constexpr std::string_view category_name(GeneralCategory category);
+
+    // Unicode character class predicates
+    constexpr bool is_unicode_letter(char32_t c);
+    constexpr bool is_unicode_upper(char32_t c);
+    constexpr bool is_unicode_lower(char32_t c);
+    constexpr bool is_unicode_digit(char32_t c);
+    constexpr bool is_unicode_number(char32_t c);
+    constexpr bool is_unicode_punct(char32_t c);
+    constexpr bool is_unicode_symbol(char32_t c);
+    constexpr bool is_unicode_mark(char32_t c);
+    constexpr bool is_unicode_space(char32_t c);
+
+    // ========================== CODEPOINT PARSERS ===========================
+
+    // Codepoint parsers decode UTF-8 from a char InputStream
+    // Invalid UTF-8 fails without consuming, reporting the byte offset of the invalid byte
+
+    // Parses a single UTF-8 encoded codepoint
+    template <typename Input = std::string_view>
+    Parser<char32_t, Input> codepoint();
+
+    // Parses a single codepoint that satisfies a constraint
+    // ASCII bytes take the same path as char_satisfy
+    template <typename Input = std::string_view>
+    Parser<char32_t, Input> codepoint_satisfy(UnaryPredicate<char32_t> auto cond, std::string&& err_msg = "<codepoint_satisfy>");
+
+    // Parses a single codepoint of the given general category
+    template <typename Input = std::string_view>
+    Parser<char32_t, Input> unicode_category(GeneralCategory category);
+
+    // Parses the longest run of codepoints satisfying cond, returning a view of it
+    // ASCII runs are found 16 bytes at a time and never decoded
+    template <typename Input = std::string_view>
+    Parser<std::string_view, Input> take_while_codepoint(UnaryPredicate<char32_t> auto cond);
+
+    // Parses the rest of the input if it is valid UTF-8, returning a view of it
+    // Validates whole blocks with SIMD, fails with the byte offset of the first invalid byte
+    template <typename Input = std::string_view>
+    Parser<std::string_view, Input> valid_utf8();
+
+    // ======================== UNICODE CLASS PARSERS =========================
+
+    // Parses a single letter, any of Lu Ll Lt Lm Lo
+    template <typename Input = std::string_view>
+    Parser<char32_t, Input> unicode_letter() {
+        return codepoint_satisfy<Input>(is_unicode_letter, "<unicode letter>");
+    }
+
+    // Parses a single uppercase letter, Lu
+    template <typename Input = std::string_view>
+    Parser<char32_t, Input> unicode_upper() {
+        return codepoint_satisfy<Input>(is_unicode_upper, "<unicode uppercase>");
+    }
+
+    // Parses a single lowercase letter, Ll
+    template <typename Input = std::string_view>
+    Parser<char32_t, Input> unicode_lower() {
+        return codepoint_satisfy<Input>(is_unicode_lower, "<unicode lowercase>");
+    }
+
+    // Parses a single decimal digit, Nd
+    template <typename Input = std::string_view>
+    Parser<char32_t, Input> unicode_digit() {
+        return codepoint_satisfy<Input>(is_unicode_digit, "<unicode digit>");
+    }
+
+    // Parses a single punctuation character, any of Pc Pd Ps Pe Pi Pf Po
+    template <typename Input = std::string_view>
+    Parser<char32_t, Input> unicode_punct() {
+        return codepoint_satisfy<Input>(is_unicode_punct, "<unicode punctuation>");
+    }
+
+    // Parses a single symbol, any of Sm Sc Sk So
+    template <typename Input = std::string_view>
+    Parser<char32_t, Input> unicode_symbol() {
+        return codepoint_satisfy<Input>(is_unicode_symbol, "<unicode symbol>");
+    }
+
+    // Parses a single White_Space character, separators plus \t \n \v \f \r and U+0085
+    template <typename Input = std::string_view>
+    Parser<char32_t, Input> unicode_space() {
+        return codepoint_satisfy<Input>(is_unicode_space, "<unicode space>");
+    }
+
+    // ========================================================================
+    //
+    // ======================= TEMPLATE IMPLEMENTATIONS =======================
+    //
+    // ========================================================================
+
+    namespace detail {
+        constexpr size_t general_category_run_count = std::size(general_category_runs);
+
+        constexpr std::array<GeneralCategory, 256> make_latin1_categories() {
+            std::array<GeneralCategory, 256> categories{};
+            size_t run = 0;
+
+            for (uint32_t c = 0; c < 256; c++) {
+                while (run + 1 < general_category_run_count && (general_category_runs[run + 1] >> 5) <= c) {
+                    run++;
+                }
+                categories[c] = static_cast<GeneralCategory>(general_category_runs[run] & 31);
+            }
+
+            return categories;
+        }
+
+        inline constexpr std::array<GeneralCategory, 256> latin1_categories = make_latin1_categories();
+
+        constexpr bool category_between(char32_t c, GeneralCategory first, GeneralCategory last) {
+            GeneralCategory category = general_category(c);
+            return first <= category && category <= last;
+        }
+
+        // Error for invalid UTF-8 at byte offset of the current input
+        template <typename Input>
+        ParseError<> invalid_utf8(const std::string& expected, const Input& input, size_t offset) {
+            if (offset >= input.size()) {
+                return ParseError(expected, std::format("truncated UTF-8 sequence at byte offset {}", offset));
+            }
+
+            unsigned byte = static_cast<unsigned char>(input[offset]);
+            return ParseError(expected, std::format("invalid UTF-8 byte 0x{:02X} at byte offset {}", byte, offset));
+        }
+    };
+
+    // ========================== Unicode Categories ==========================
+
+    // Returns the general category of a codepoint
+    constexpr GeneralCategory general_category(char32_t c) {
+        if (c < 256) {
+            return detail::latin1_categories[c];
+        }
+        if (c > 0x10FFFF) {
+            return GeneralCategory::Cn;
+        }
+
+        // last run starting at or before c
+        const uint32_t key = (static_cast<uint32_t>(c) << 5) | 31;
+        const uint32_t* run = std::upper_bound(
+            std::begin(detail::general_category_runs), std::end(detail::general_category_runs), key);
+
+        return static_cast<GeneralCategory>(*(run - 1) & 31);
+    }
+
+    // Returns the two letter name of a general category, e.g. "Lu"
+    constexpr std::string_view category_name(GeneralCategory category) {
+        constexpr std::string_view names[] = {
+            "Lu", "Ll", "Lt", "Lm", "Lo", "Mn", "Mc", "Me", "Nd", "Nl", "No",
+            "Pc", "Pd", "Ps", "Pe", "Pi", "Pf", "Po", "Sm", "Sc", "Sk", "So",
+            "Zs", "Zl", "Zp", "Cc", "Cf", "Cs", "Co", "Cn",
+        };
+        return names[static_cast<size_t>(category)];
+    }
+
+    constexpr bool is_unicode_letter(char32_t c) {
+        return detail::category_between(c, GeneralCategory::Lu, GeneralCategory::Lo);
+    }
+
+    constexpr bool is_unicode_upper(char32_t c) {
+        return general_category(c) == GeneralCategory::Lu;
+    }
+
+    constexpr bool is_unicode_lower(char32_t c) {
+        return general_category(c) == GeneralCategory::Ll;
+    }
+
+    constexpr bool is_unicode_digit(char32_t c) {
+        return general_category(c) == GeneralCategory::Nd;
+    }
+
+    constexpr bool is_unicode_number(char32_t c) {
+        return detail::category_between(c, GeneralCategory::Nd, GeneralCategory::No);
+    }
+
+    constexpr bool is_unicode_punct(char32_t c) {
+        return detail::category_between(c, GeneralCategory::Pc, GeneralCategory::Po);
+    }
+
+    constexpr bool is_unicode_symbol(char32_t c) {
+        return detail::category_between(c, GeneralCategory::Sm, GeneralCategory::So);
+    }
+
+    constexpr bool is_unicode_mark(char32_t c) {
+        return detail::category_between(c, GeneralCategory::Mn, GeneralCategory::Me);
+    }
+
+    constexpr bool is_unicode_space(char32_t c) {
+        return (c >= U'\t' && c <= U'\r') || c == 0x85
+            || detail::category_between(c, GeneralCategory::Zs, GeneralCategory::Zp);
+    }
+
+    // ========================== Codepoint Parsers ===========================
+
+    // Parses a single UTF-8 encoded codepoint
+    template <typename Input>
+    Parser<char32_t, Input> codepoint() {
+        return CPPARSEC_MAKE(Parser<char32_t, Input>) {
+            CPPARSEC_FAIL_IF(input.empty(), ParseError("<codepoint>", "end of input"));
+
+            unsigned char lead = static_cast<unsigned char>(input[0]);
+            if (lead < 0x80) {
+                input.remove_prefix(1);
+                return char32_t(lead);
+            }
+
+            auto decoded = detail::utf8_decode(std::string_view(input.data(), input.size()));
+            CPPARSEC_FAIL_IF(!decoded, detail::invalid_utf8("<codepoint>", input, decoded.error()));
+
+            input.remove_prefix(decoded->length);
+            return decoded->codepoint;
+        };
+    }
+
+    // Parses a single codepoint that satisfies a constraint
+    template <typename Input>
+    Parser<char32_t, Input> codepoint_satisfy(UnaryPredicate<char32_t> auto cond, std::string&& err_msg) {
+        return CPPARSEC_MAKE(Parser<char32_t, Input>) {
+            CPPARSEC_FAIL_IF(input.empty(), ParseError(err_msg, "end of input"));
+
+            unsigned char lead = static_cast<unsigned char>(input[0]);
+            if (lead < 0x80) {
+                CPPARSEC_FAIL_IF(!cond(char32_t(lead)), ParseError(err_msg, { input[0] }));
+
+                input.remove_prefix(1);
+                return char32_t(lead);
+            }
+
+            auto decoded = detail::utf8_decode(std::string_view(input.data(), input.size()));
+            CPPARSEC_FAIL_IF(!decoded, detail::invalid_utf8(err_msg, input, decoded.error()));
+            CPPARSEC_FAIL_IF(!cond(decoded->codepoint), ParseError(err_msg, std::string(input.substr(0, decoded->length))));
+
+            input.remove_prefix(decoded->length);
+            return decoded->codepoint;
+        };
+    }
+
+    // Parses a single codepoint of the given general category
+    template <typename Input>
+    Parser<char32_t, Input> unicode_category(GeneralCategory category) {
+        auto in_category = [category](char32_t c) { return general_category(c) == category; };
+        return codepoint_satisfy<Input>(in_category, std::format("<unicode {}>", category_name(category)));
+    }
+
+    // Parses the longest run of codepoints satisfying cond, returning a view of it
+    template <typename Input>
+    Parser<std::string_view, Input> take_while_codepoint(UnaryPredicate<char32_t> auto cond) {
+        return CPPARSEC_MAKE(Parser<std::string_view, Input>) {
+            std::string_view view(input.data(), input.size());
+            size_t i = 0;
+
+            while (i < view.size()) {
+                // bounded lookahead, short runs shouldn't pay for scanning the whole input
+                size_t ascii_end = i + detail::ascii_prefix_length(view.substr(i, 64));
+                while (i < ascii_end && cond(char32_t(static_cast<unsigned char>(view[i])))) {
+                    i++;
+                }
+                if (i < ascii_end || i == view.size()) {
+                    break;
+                }
+                if (static_cast<unsigned char>(view[i]) < 0x80) {
+                    continue; // lookahead window ended inside an ASCII run
+                }
+
+                auto decoded = detail::utf8_decode(view.substr(i));
+                if (!decoded || !cond(decoded->codepoint)) {
+                    break;
+                }
+                i += decoded->length;
+            }
+
+            input.remove_prefix(i);
+            return view.substr(0, i);
+        };
+    }
+
+    // Parses the rest of the input if it is valid UTF-8, returning a view of it
+    template <typename Input>
+    Parser<std::string_view, Input> valid_utf8() {
+        return CPPARSEC_MAKE(Parser<std::string_view, Input>) {
+            std::string_view view(input.data(), input.size());
+
+            size_t invalid = detail::utf8_validate(view);
+            CPPARSEC_FAIL_IF(invalid != std::string_view::npos, detail::invalid_utf8("<valid UTF-8>", input, invalid));
+
+            input.remove_prefix(view.size());
+            return view;
+        };
+    }
+};
+
+#endif /* CPPARSEC_UTF8_H */
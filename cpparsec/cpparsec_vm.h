@@ -0,0 +1,909 @@
+#ifndef CPPARSEC_VM_H
+#define CPPARSEC_VM_H
+
+#include <any>
+#include <map>
+#include "cpparsec_optimize.h"
+
+namespace cpparsec {
+
+    // ============================= BYTECODE MACHINE =============================
+
+    // bytecode(p) compiles the grammar IR of p (see GrammarNode) to a compact program, run by a
+    // virtual machine in one loop with an explicit backtrack stack, in the style of LPeg
+    //
+    //     atom, any, set, literal, span, eof    tests consuming input, span a run of a class
+    //     choice, commit                        or_, saving the alternative and the input position
+    //     backtrack                             a choice resumed whatever its failure consumed, for PEG
+    //     keywords                              the longest of a set of literals
+    //     try_, look, not_ and their ends       input restored on failure or on success
+    //     call, ret                             subgrammars with several parents, compiled once
+    //     position, tag                         captures results are built from after a match
+    //     callout                               a parser run by its parse function
+    //
+    // An alternative is only tried when the one before failed without consuming input, as with or_
+    // Results are built from the captures of a match, with the values the parsers would build
+    // Transforms, chains, lazy, hand-written parsers and results the IR doesn't describe, like tuples,
+    // are callouts, labels run their child. A failed match parses again with p for its error
+    // char_class and the library classes are tabulated, char_satisfy predicates are called for each byte tested
+
+    // Compiles the grammar of p to bytecode, once, returning a parser to use in its place
+    // The compiled parser is opaque to grammar(), keep p to read the grammar
+    template <typename T, typename Input>
+        requires std::same_as<input_atom_t<Input>, char>
+    Parser<T, Input> bytecode(const Parser<T, Input>& p);
+
+    // ============================================================================
+    //
+    // ========================= TEMPLATE IMPLEMENTATIONS =========================
+    //
+    // ============================================================================
+
+    // ================================ Machine ===================================
+
+    namespace detail {
+        enum class VmOp : uint8_t {
+            atom,        // the atom arg
+            any,
+            set,         // an atom of class arg
+            literal,     // literal arg, consuming its matched prefix on failure as string_ does
+            span,        // atoms of class arg, as many as there are
+            eof,
+            choice,      // saves an alternative at arg
+            backtrack,   // saves an alternative at arg, resumed at the saved input however far a failure got
+            keywords,    // the longest keyword of keyword set arg
+            commit,      // drops the alternative, jumps to arg
+            try_,        // saves the input, restored on failure
+            end_try,
+            look,        // saves the input, restored on success
+            end_look,
+            not_,        // saves the input, restored on failure continuing at arg
+            end_not,     // restores the input and fails
+            jump,
+            call,
+            ret,
+            callout,     // runs callout arg
+            position,    // captures the input position
+            tag,         // captures arg
+            end,
+        };
+
+        struct VmInstruction {
+            VmOp op;
+            uint32_t arg = 0;
+        };
+
+        // Backtrack stack entry, the op that saved it and the state it saved
+        struct VmFrame {
+            VmOp op;
+            uint32_t target;
+            size_t position;
+            size_t captures;
+            size_t values;
+        };
+
+        // Stacks of a machine run
+        struct VmStacks {
+            std::vector<VmFrame> frames;
+            std::vector<size_t> captures;   // positions, tags and indices of values in order
+            std::vector<std::any> values;   // callout results
+        };
+
+        // Stacks from a pool of the thread, so a run nested in a callout has stacks of its own
+        class VmStackLease {
+        public:
+            VmStackLease() {
+                if (pool.empty()) {
+                    stacks = std::make_unique<VmStacks>();
+                }
+                else {
+                    stacks = std::move(pool.back());
+                    pool.pop_back();
+                }
+            }
+
+            ~VmStackLease() {
+                stacks->frames.clear();
+                stacks->captures.clear();
+                stacks->values.clear();
+                pool.push_back(std::move(stacks));
+            }
+
+            VmStackLease(const VmStackLease&) = delete;
+            VmStackLease& operator=(const VmStackLease&) = delete;
+
+            VmStacks& operator*() const { return *stacks; }
+
+        private:
+            inline static thread_local std::vector<std::unique_ptr<VmStacks>> pool;
+            std::unique_ptr<VmStacks> stacks;
+        };
+
+        // Reads the captures of a match in order, building its results
+        struct VmReader {
+            const char* input;
+            const size_t* next;
+            std::vector<std::any>* values;
+
+            size_t read() {
+                return *next++;
+            }
+        };
+
+        template <typename Input>
+        struct VmProgram {
+            // Parses for a callout, true on success, capturing its value if it has one
+            using Callout = std::function<bool(Input&, VmStacks&)>;
+
+            std::vector<VmInstruction> code;
+            std::vector<AtomClass<char>> classes;
+            std::vector<std::string> literals;
+            std::vector<KeywordSet> keyword_sets;
+            std::vector<Callout> callouts;
+
+            // Runs the program from the start of input, true on a match
+            // position is set to where the match ended, or the farthest position a failure reached
+            bool run(const Input& input, VmStacks& stacks, size_t& position) const;
+        };
+
+        template <typename Input>
+        bool VmProgram<Input>::run(const Input& input, VmStacks& stacks, size_t& position) const {
+            const char* data = input.data();
+            const size_t size = input.size();
+            std::vector<VmFrame>& frames = stacks.frames;
+            std::vector<size_t>& captures = stacks.captures;
+            std::vector<std::any>& values = stacks.values;
+            size_t pos = 0;
+            size_t farthest = 0;
+            uint32_t pc = 0;
+
+            while (true) {
+                const VmInstruction in = code[pc++];
+                bool matched = true;
+
+                switch (in.op) {
+                case VmOp::atom:
+                    matched = pos < size && static_cast<unsigned char>(data[pos]) == in.arg;
+                    pos += matched;
+                    break;
+                case VmOp::any:
+                    matched = pos < size;
+                    pos += matched;
+                    break;
+                case VmOp::set:
+                    matched = pos < size && classes[in.arg].contains(data[pos]);
+                    pos += matched;
+                    break;
+                case VmOp::literal: {
+                    const std::string& literal = literals[in.arg];
+                    if (literal.size() > size - pos) {
+                        matched = false;
+                        break;
+                    }
+
+                    size_t i = 0;
+                    while (i < literal.size() && literal[i] == data[pos + i]) {
+                        i++;
+                    }
+                    pos += i;
+                    matched = i == literal.size();
+                    break;
+                }
+                case VmOp::span:
+                    pos += classes[in.arg].span(std::string_view(data + pos, size - pos));
+                    break;
+                case VmOp::keywords: {
+                    const size_t length = keyword_sets[in.arg].match(std::string_view(data + pos, size - pos), size - pos + input_padding<Input>());
+                    matched = length != KeywordSet::npos;
+                    pos += matched ? length : 0;
+                    break;
+                }
+                case VmOp::eof:
+                    matched = pos == size;
+                    break;
+                case VmOp::choice:
+                case VmOp::backtrack:
+                case VmOp::try_:
+                case VmOp::look:
+                case VmOp::not_:
+                    frames.push_back({ in.op, in.arg, pos, captures.size(), values.size() });
+                    break;
+                case VmOp::commit:
+                    frames.pop_back();
+                    pc = in.arg;
+                    break;
+                case VmOp::end_try:
+                    frames.pop_back();
+                    break;
+                case VmOp::end_look:
+                    pos = frames.back().position;
+                    frames.pop_back();
+                    break;
+                case VmOp::end_not:
+                    pos = frames.back().position;
+                    captures.resize(frames.back().captures);
+                    values.resize(frames.back().values);
+                    frames.pop_back();
+                    matched = false;
+                    break;
+                case VmOp::jump:
+                    pc = in.arg;
+                    break;
+                case VmOp::call:
+                    frames.push_back({ in.op, pc, pos, 0, 0 });
+                    pc = in.arg;
+                    break;
+                case VmOp::ret:
+                    pc = frames.back().target;
+                    frames.pop_back();
+                    break;
+                case VmOp::callout: {
+                    Input rest = input;
+                    rest.remove_prefix(pos);
+                    matched = callouts[in.arg](rest, stacks);
+                    pos = size - rest.size();
+                    break;
+                }
+                case VmOp::position:
+                    captures.push_back(pos);
+                    break;
+                case VmOp::tag:
+                    captures.push_back(in.arg);
+                    break;
+                case VmOp::end:
+                    position = pos;
+                    return true;
+                }
+
+                // unwind to a not_ or a backtrack, or to a choice the failure consumed nothing after
+                if (!matched) {
+                    farthest = std::max(farthest, pos);
+                }
+                while (!matched) {
+                    if (frames.empty()) {
+                        position = farthest;
+                        return false;
+                    }
+
+                    const VmFrame frame = frames.back();
+                    frames.pop_back();
+                    if (frame.op == VmOp::try_) {
+                        pos = frame.position;
+                    }
+                    else if (frame.op == VmOp::not_ || frame.op == VmOp::backtrack || (frame.op == VmOp::choice && frame.position == pos)) {
+                        pos = frame.position;
+                        captures.resize(frame.captures);
+                        values.resize(frame.values);
+                        pc = frame.target;
+                        matched = true;
+                    }
+                }
+            }
+        }
+    };
+
+    // =============================== Compiler ===================================
+
+    namespace detail {
+        // Compiles grammar IR nodes to a VmProgram, falling back to callouts where a node can't be
+        template <typename Input>
+        class VmCompiler {
+        public:
+            template <typename T>
+            using Builder = std::function<T(VmReader&)>;
+
+            VmProgram<Input> program;
+
+            // Counts the parents of the nodes under root, nodes with several are compiled once
+            explicit VmCompiler(const NodePtr<char>& root) {
+                count_references(root);
+            }
+
+            // Emits a match of node dropping its result, false if it can't be run
+            bool recognize(const NodePtr<char>& node);
+
+            // Emits a match of node capturing its result, nullopt if it can't be run
+            // node must have been recorded by a Parser<T, Input>
+            template <typename T>
+            std::optional<Builder<T>> capture(const NodePtr<char>& node);
+
+            uint32_t emit(VmOp op, uint32_t arg = 0) {
+                program.code.push_back({ op, arg });
+                return static_cast<uint32_t>(program.code.size() - 1);
+            }
+
+        private:
+            std::map<const GrammarNode<char>*, size_t> references;
+            std::map<std::pair<const GrammarNode<char>*, bool>, uint32_t> subroutines;  // by node and whether it captures
+            std::map<const GrammarNode<char>*, std::any> builders;                       // Builder<T> of capturing subroutines
+
+            void count_references(const NodePtr<char>& node);
+            bool shared(const GrammarNode<char>& node) const;
+
+            uint32_t here() const {
+                return static_cast<uint32_t>(program.code.size());
+            }
+
+            // Drops the code emitted from mark on, with the subroutines in it
+            void rollback(uint32_t mark);
+
+            // Emits node as a subroutine the first time, and a call to it
+            bool subroutine(const NodePtr<char>& node, bool captures, auto&& body);
+
+            // Emits a loop of body, with tag 1 before each pass and tag 0 after the last when tagged
+            bool loop(bool tagged, auto&& body);
+
+            bool recognize_node(const NodePtr<char>& node);
+            bool recognize_callout(const GrammarNode<char>& node);
+            void emit_class(const std::vector<NodePtr<char>>& atoms, VmOp op);
+
+            template <typename T>
+            std::optional<Builder<T>> capture_node(const NodePtr<char>& node);
+
+            template <typename T>
+            std::optional<Builder<T>> capture_repeat(const GrammarNode<char>& node);
+
+            template <typename T>
+            std::optional<Builder<T>> capture_callout(const GrammarNode<char>& node);
+        };
+
+        template <typename Input>
+        void VmCompiler<Input>::count_references(const NodePtr<char>& node) {
+            if (references[node.get()]++ == 0) {
+                for (const NodePtr<char>& child : node->children) {
+                    count_references(child);
+                }
+            }
+        }
+
+        template <typename Input>
+        bool VmCompiler<Input>::shared(const GrammarNode<char>& node) const {
+            auto found = references.find(&node);
+            return found != references.end() && found->second > 1 && !is_atom_class(node)
+                && node.kind != GrammarKind::literal && node.kind != GrammarKind::success;
+        }
+
+        template <typename Input>
+        void VmCompiler<Input>::rollback(uint32_t mark) {
+            program.code.resize(mark);
+            std::erase_if(subroutines, [&](const auto& entry) {
+                if (entry.second < mark) {
+                    return false;
+                }
+                builders.erase(entry.first.first);
+                return true;
+            });
+        }
+
+        template <typename Input>
+        bool VmCompiler<Input>::subroutine(const NodePtr<char>& node, bool captures, auto&& body) {
+            const auto key = std::pair(node.get(), captures);
+            if (auto found = subroutines.find(key); found != subroutines.end()) {
+                emit(VmOp::call, found->second);
+                return true;
+            }
+
+            // the body is jumped over where it is first used
+            const uint32_t skip = emit(VmOp::jump);
+            const uint32_t entry = here();
+            if (!body()) {
+                return false;
+            }
+
+            emit(VmOp::ret);
+            program.code[skip].arg = here();
+            subroutines[key] = entry;
+            emit(VmOp::call, entry);
+            return true;
+        }
+
+        template <typename Input>
+        bool VmCompiler<Input>::loop(bool tagged, auto&& body) {
+            const uint32_t top = emit(VmOp::choice);
+            if (tagged) {
+                emit(VmOp::tag, 1);
+            }
+            if (!body()) {
+                return false;
+            }
+
+            emit(VmOp::commit, top);
+            program.code[top].arg = here();
+            if (tagged) {
+                emit(VmOp::tag, 0);
+            }
+            return true;
+        }
+
+        template <typename Input>
+        void VmCompiler<Input>::emit_class(const std::vector<NodePtr<char>>& atoms, VmOp op) {
+            if (op == VmOp::set && atoms.size() == 1 && atoms[0]->kind == GrammarKind::char_) {
+                emit(VmOp::atom, static_cast<unsigned char>(atoms[0]->atoms[0]));
+            }
+            else if (op == VmOp::set && atoms.size() == 1 && atoms[0]->kind == GrammarKind::any_char) {
+                emit(VmOp::any);
+            }
+            else {
+                program.classes.emplace_back(atoms);
+                emit(op, static_cast<uint32_t>(program.classes.size() - 1));
+            }
+        }
+
+        template <typename Input>
+        bool VmCompiler<Input>::recognize(const NodePtr<char>& node) {
+            const uint32_t mark = here();
+            const bool compiled = shared(*node)
+                ? subroutine(node, false, [&] { return recognize_node(node); })
+                : recognize_node(node);
+            if (compiled) {
+                return true;
+            }
+
+            rollback(mark);
+            return recognize_callout(*node);
+        }
+
+        template <typename Input>
+        bool VmCompiler<Input>::recognize_node(const NodePtr<char>& node) {
+            const GrammarNode<char>& n = *node;
+            if (is_atom_class(n)) {
+                emit_class({ node }, VmOp::set);
+                return true;
+            }
+
+            switch (n.kind) {
+            case GrammarKind::literal:
+                if (!n.atoms.empty()) {
+                    program.literals.emplace_back(n.atoms.begin(), n.atoms.end());
+                    emit(VmOp::literal, static_cast<uint32_t>(program.literals.size() - 1));
+                }
+                return true;
+            case GrammarKind::success:
+                return true;
+            case GrammarKind::eof:
+                emit(VmOp::eof);
+                return true;
+            case GrammarKind::label:
+                return recognize(n.children[0]);
+            case GrammarKind::sequence: {
+                std::vector<NodePtr<char>> steps;
+                flatten_sequence(node, steps);
+                return std::ranges::all_of(steps, [this](const NodePtr<char>& step) { return recognize(step); });
+            }
+            case GrammarKind::choice: {
+                // consecutive one atom alternatives are one class
+                std::vector<std::vector<NodePtr<char>>> groups;
+                std::vector<NodePtr<char>> alternatives;
+                flatten_choice(node, alternatives);
+                for (const NodePtr<char>& alternative : alternatives) {
+                    if (groups.empty() || !is_atom_class(*alternative) || !is_atom_class(*groups.back().back())) {
+                        groups.emplace_back();
+                    }
+                    groups.back().push_back(alternative);
+                }
+
+                std::vector<uint32_t> commits;
+                for (size_t i = 0; i < groups.size(); i++) {
+                    const bool last = i + 1 == groups.size();
+                    const uint32_t choice = last ? 0 : emit(VmOp::choice);
+                    if (groups[i].size() > 1) {
+                        emit_class(groups[i], VmOp::set);
+                    }
+                    else if (!recognize(groups[i][0])) {
+                        return false;
+                    }
+
+                    if (!last) {
+                        commits.push_back(emit(VmOp::commit));
+                        program.code[choice].arg = here();
+                    }
+                }
+                for (uint32_t commit : commits) {
+                    program.code[commit].arg = here();
+                }
+                return true;
+            }
+            case GrammarKind::try_:
+                emit(VmOp::try_);
+                if (!recognize(n.children[0])) {
+                    return false;
+                }
+                emit(VmOp::end_try);
+                return true;
+            case GrammarKind::optional: {
+                const uint32_t choice = emit(VmOp::choice);
+                if (!recognize(n.children[0])) {
+                    return false;
+                }
+                emit(VmOp::commit, here() + 1);
+                program.code[choice].arg = here();
+                return true;
+            }
+            case GrammarKind::look_ahead:
+                emit(VmOp::look);
+                if (!recognize(n.children[0])) {
+                    return false;
+                }
+                emit(VmOp::end_look);
+                return true;
+            case GrammarKind::not_followed_by: {
+                const uint32_t not_ = emit(VmOp::not_);
+                if (!recognize(n.children[0])) {
+                    return false;
+                }
+                emit(VmOp::end_not);
+                program.code[not_].arg = here();
+                return true;
+            }
+            case GrammarKind::many:
+            case GrammarKind::many1:
+            case GrammarKind::skip_many:
+            case GrammarKind::skip_many1: {
+                const NodePtr<char>& p = n.children[0];
+                const bool at_least_one = n.kind == GrammarKind::many1 || n.kind == GrammarKind::skip_many1;
+                if (at_least_one && !recognize(p)) {
+                    return false;
+                }
+                if (is_atom_class(*p)) {
+                    emit_class({ p }, VmOp::span);
+                    return true;
+                }
+                return loop(false, [&] { return recognize(p); });
+            }
+            case GrammarKind::count:
+                for (size_t i = 0; i < n.count; i++) {
+                    if (n.count > 64 || !recognize(n.children[0])) {
+                        return false;
+                    }
+                }
+                return true;
+            case GrammarKind::sep_by:
+            case GrammarKind::sep_by1: {
+                const NodePtr<char>& p = n.children[0];
+                const NodePtr<char>& sep = n.children[1];
+                const uint32_t choice = n.kind == GrammarKind::sep_by ? emit(VmOp::choice) : 0;
+                if (!recognize(p) || !loop(false, [&] { return recognize(sep) && recognize(p); })) {
+                    return false;
+                }
+                if (n.kind == GrammarKind::sep_by) {
+                    emit(VmOp::commit, here() + 1);
+                    program.code[choice].arg = here();
+                }
+                return true;
+            }
+            case GrammarKind::end_by:
+            case GrammarKind::end_by1: {
+                auto step = [&] { return recognize(n.children[0]) && recognize(n.children[1]); };
+                return (n.kind == GrammarKind::end_by || step()) && loop(false, step);
+            }
+            default:
+                return false;
+            }
+        }
+
+        template <typename Input>
+        bool VmCompiler<Input>::recognize_callout(const GrammarNode<char>& node) {
+            auto source = std::static_pointer_cast<const AnyParseFunction<Input>>(node.source.lock());
+            if (!source) {
+                return false;
+            }
+
+            program.callouts.push_back([source](Input& input, VmStacks&) {
+                return source->recognize(input).has_value();
+            });
+            emit(VmOp::callout, static_cast<uint32_t>(program.callouts.size() - 1));
+            return true;
+        }
+
+        template <typename Input>
+        template <typename T>
+        std::optional<typename VmCompiler<Input>::template Builder<T>> VmCompiler<Input>::capture(const NodePtr<char>& node) {
+            const uint32_t mark = here();
+            std::optional<Builder<T>> build;
+
+            if (shared(*node)) {
+                const bool compiled = subroutine(node, true, [&] {
+                    build = capture_node<T>(node);
+                    if (build) {
+                        builders[node.get()] = *build;
+                    }
+                    return build.has_value();
+                });
+                if (compiled && !build) {
+                    // called again, its builder was made with its body
+                    build = std::any_cast<Builder<T>>(builders.at(node.get()));
+                }
+            }
+            else {
+                build = capture_node<T>(node);
+            }
+
+            if (build) {
+                return build;
+            }
+
+            rollback(mark);
+            return capture_callout<T>(*node);
+        }
+
+        template <typename Input>
+        template <typename T>
+        std::optional<typename VmCompiler<Input>::template Builder<T>> VmCompiler<Input>::capture_node(const NodePtr<char>& node) {
+            const GrammarNode<char>& n = *node;
+
+            if constexpr (std::same_as<T, std::monostate>) {
+                if (!recognize_node(node)) {
+                    return std::nullopt;
+                }
+                return Builder<T>([](VmReader&) { return std::monostate{}; });
+            }
+            if constexpr (std::same_as<T, char>) {
+                if (is_atom_class(n)) {
+                    emit(VmOp::position);
+                    emit_class({ node }, VmOp::set);
+                    return Builder<T>([](VmReader& reader) { return reader.input[reader.read()]; });
+                }
+            }
+            if constexpr (std::same_as<T, std::string>) {
+                if (n.kind == GrammarKind::literal) {
+                    recognize_node(node);
+                    return Builder<T>([value = std::string(n.atoms.begin(), n.atoms.end())](VmReader&) { return value; });
+                }
+            }
+
+            switch (n.kind) {
+            case GrammarKind::success:
+                // success always returns its one value, so it is built once
+                if constexpr (std::default_initializable<Input> && std::copy_constructible<T>) {
+                    if (std::optional<Parser<T, Input>> p = Parser<T, Input>::recorded(n)) {
+                        Input empty{};
+                        if (typename Parser<T, Input>::Result value = p->parse(empty)) {
+                            return Builder<T>([value = std::move(*value)](VmReader&) { return value; });
+                        }
+                    }
+                }
+                return std::nullopt;
+            case GrammarKind::label:
+                return capture<T>(n.children[0]);
+            case GrammarKind::try_: {
+                emit(VmOp::try_);
+                std::optional<Builder<T>> build = capture<T>(n.children[0]);
+                emit(VmOp::end_try);
+                return build;
+            }
+            case GrammarKind::sequence: {
+                if (n.keep < 0) {
+                    return std::nullopt;
+                }
+
+                std::vector<NodePtr<char>> before, after;
+                NodePtr<char> kept = kept_step(n, before, after);
+                if (!std::ranges::all_of(before, [this](const NodePtr<char>& step) { return recognize(step); })) {
+                    return std::nullopt;
+                }
+                std::optional<Builder<T>> build = capture<T>(kept);
+                if (!build || !std::ranges::all_of(after, [this](const NodePtr<char>& step) { return recognize(step); })) {
+                    return std::nullopt;
+                }
+                return build;
+            }
+            case GrammarKind::choice: {
+                std::vector<NodePtr<char>> alternatives;
+                flatten_choice(node, alternatives);
+
+                std::vector<Builder<T>> options;
+                std::vector<uint32_t> commits;
+                for (size_t i = 0; i < alternatives.size(); i++) {
+                    const bool last = i + 1 == alternatives.size();
+                    const uint32_t choice = last ? 0 : emit(VmOp::choice);
+                    emit(VmOp::tag, static_cast<uint32_t>(i));
+                    std::optional<Builder<T>> build = capture<T>(alternatives[i]);
+                    if (!build) {
+                        return std::nullopt;
+                    }
+                    options.push_back(std::move(*build));
+
+                    if (!last) {
+                        commits.push_back(emit(VmOp::commit));
+                        program.code[choice].arg = here();
+                    }
+                }
+                for (uint32_t commit : commits) {
+                    program.code[commit].arg = here();
+                }
+                return Builder<T>([options = std::move(options)](VmReader& reader) { return options[reader.read()](reader); });
+            }
+            case GrammarKind::optional:
+                if constexpr (is_std_optional<T>) {
+                    using U = typename T::value_type;
+                    const uint32_t choice = emit(VmOp::choice);
+                    emit(VmOp::tag, 1);
+                    std::optional<Builder<U>> build = capture<U>(n.children[0]);
+                    if (!build) {
+                        return std::nullopt;
+                    }
+                    const uint32_t commit = emit(VmOp::commit);
+                    program.code[choice].arg = here();
+                    emit(VmOp::tag, 0);
+                    program.code[commit].arg = here();
+
+                    return Builder<T>([build = std::move(*build)](VmReader& reader) -> T {
+                        if (reader.read() == 0) {
+                            return std::nullopt;
+                        }
+                        return build(reader);
+                    });
+                }
+                return std::nullopt;
+            case GrammarKind::many:
+            case GrammarKind::many1:
+            case GrammarKind::count:
+            case GrammarKind::sep_by:
+            case GrammarKind::sep_by1:
+            case GrammarKind::end_by:
+            case GrammarKind::end_by1:
+                if constexpr (is_std_vector<T> || std::same_as<T, std::string>) {
+                    return capture_repeat<T>(n);
+                }
+                return std::nullopt;
+            default:
+                return std::nullopt;
+            }
+        }
+
+        // many, many1, count, sep_by, sep_by1, end_by and end_by1 into a std::vector or std::string
+        template <typename Input>
+        template <typename T>
+        std::optional<typename VmCompiler<Input>::template Builder<T>> VmCompiler<Input>::capture_repeat(const GrammarNode<char>& n) {
+            using E = typename T::value_type;
+            const NodePtr<char>& p = n.children[0];
+
+            // a run of a class is the input it spans
+            if constexpr (std::same_as<E, char>) {
+                if ((n.kind == GrammarKind::many || n.kind == GrammarKind::many1) && is_atom_class(*p)) {
+                    emit(VmOp::position);
+                    if (n.kind == GrammarKind::many1) {
+                        emit_class({ p }, VmOp::set);
+                    }
+                    emit_class({ p }, VmOp::span);
+                    emit(VmOp::position);
+
+                    return Builder<T>([](VmReader& reader) {
+                        const size_t start = reader.read();
+                        return T(reader.input + start, reader.input + reader.read());
+                    });
+                }
+            }
+
+            // leading elements are untagged, looped ones tagged
+            std::optional<Builder<E>> element;
+            auto next = [&] {
+                std::optional<Builder<E>> build = capture<E>(p);
+                if (!element) {
+                    element = build;
+                }
+                return build.has_value();
+            };
+            auto separated = [&] { return recognize(n.children[1]) && next(); };
+            auto terminated = [&] { return next() && recognize(n.children[1]); };
+
+            size_t leading = 0;
+            bool optional = false;
+            bool compiled = false;
+            uint32_t choice = 0;
+            switch (n.kind) {
+            case GrammarKind::many:
+                compiled = loop(true, next);
+                break;
+            case GrammarKind::many1:
+                leading = 1;
+                compiled = next() && loop(true, next);
+                break;
+            case GrammarKind::count:
+                leading = n.count;
+                compiled = n.count <= 64;
+                for (size_t i = 0; compiled && i < n.count; i++) {
+                    compiled = next();
+                }
+                break;
+            case GrammarKind::sep_by:
+                optional = true;
+                choice = emit(VmOp::choice);
+                emit(VmOp::tag, 1);
+                [[fallthrough]];
+            case GrammarKind::sep_by1:
+                leading = 1;
+                compiled = next() && loop(true, separated);
+                if (compiled && optional) {
+                    const uint32_t commit = emit(VmOp::commit);
+                    program.code[choice].arg = here();
+                    emit(VmOp::tag, 0);
+                    program.code[commit].arg = here();
+                }
+                break;
+            case GrammarKind::end_by1:
+                leading = 1;
+                compiled = terminated() && loop(true, terminated);
+                break;
+            default:
+                compiled = loop(true, terminated);
+                break;
+            }
+            if (!compiled || (!element && leading > 0)) {
+                return std::nullopt;
+            }
+
+            return Builder<T>([element = element.value_or(Builder<E>()), leading, optional](VmReader& reader) {
+                T values;
+                if (optional && reader.read() == 0) {
+                    return values;
+                }
+                for (size_t i = 0; i < leading; i++) {
+                    values.push_back(element(reader));
+                }
+                while (reader.read() == 1) {
+                    values.push_back(element(reader));
+                }
+                return values;
+            });
+        }
+
+        template <typename Input>
+        template <typename T>
+        std::optional<typename VmCompiler<Input>::template Builder<T>> VmCompiler<Input>::capture_callout(const GrammarNode<char>& node) {
+            if constexpr (std::copy_constructible<T>) {
+                std::optional<Parser<T, Input>> p = Parser<T, Input>::recorded(node);
+                if (!p) {
+                    return std::nullopt;
+                }
+
+                program.callouts.push_back([p = std::move(*p)](Input& input, VmStacks& stacks) {
+                    typename Parser<T, Input>::Result result = p.parse(input);
+                    if (!result) {
+                        return false;
+                    }
+
+                    stacks.captures.push_back(stacks.values.size());
+                    stacks.values.emplace_back(std::move(*result));
+                    return true;
+                });
+                emit(VmOp::callout, static_cast<uint32_t>(program.callouts.size() - 1));
+
+                return Builder<T>([](VmReader& reader) {
+                    return std::any_cast<T>(std::move((*reader.values)[reader.read()]));
+                });
+            }
+            return std::nullopt;
+        }
+    };
+
+    template <typename T, typename Input>
+        requires std::same_as<input_atom_t<Input>, char>
+    Parser<T, Input> bytecode(const Parser<T, Input>& p) {
+        detail::VmCompiler<Input> compiler(p.grammar());
+        std::optional<std::function<T(detail::VmReader&)>> build = compiler.template capture<T>(p.grammar());
+
+        // a program calling p back is p with more steps
+        if (!build || (compiler.program.code.size() == 1 && compiler.program.code[0].op == detail::VmOp::callout)) {
+            return p;
+        }
+        compiler.emit(detail::VmOp::end);
+
+        auto program = std::make_shared<const detail::VmProgram<Input>>(std::move(compiler.program));
+        return CPPARSEC_MAKE(Parser<T, Input>) {
+            detail::VmStackLease lease;
+            detail::VmStacks& stacks = *lease;
+            size_t position = 0;
+            if (!program->run(input, stacks, position)) {
+                return p.parse(input);
+            }
+
+            detail::VmReader reader{ input.data(), stacks.captures.data(), &stacks.values };
+            T value = (*build)(reader);
+            input.remove_prefix(position);
+            return value;
+        };
+    }
+};
+
+#endif /* CPPARSEC_VM_H */
@@ -0,0 +1,26 @@
+#include <fstream>
+#include <sstream>
+#include "test_grammars.h"
+
+// Writes generated_parsers.h from the grammars of test_grammars.h, run before the unit tests are built
+//     generate_parsers <path of generated_parsers.h>
+int main(int argc, char* argv[]) {
+    if (argc != 2) {
+        std::println(stderr, "usage: generate_parsers <output header>");
+        return 2;
+    }
+
+    std::expected<std::string, std::string> header = test_grammars::generate_parsers();
+    if (!header) {
+        std::println(stderr, "generate_parsers: {}", header.error());
+        return 1;
+    }
+
+    // an unchanged header isn't written, so what includes it isn't rebuilt
+    std::stringstream existing;
+    existing << std::ifstream(argv[1]).rdbuf();
+    if (existing.str() != *header) {
+        std::ofstream(argv[1]) << *header;
+    }
+    return 0;
+}
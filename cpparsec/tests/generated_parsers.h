@@ -0,0 +1,629 @@
+// Generated by cpparsec::ParserGenerator, do not edit by hand
+
+#ifndef CPPARSEC_GENERATED_PARSERS_H
+#define CPPARSEC_GENERATED_PARSERS_H
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+#include "../cpparsec_core.h"
+
+namespace generated {
+
+    namespace detail {
+        // Same errors as char_
+        inline cpparsec::ParseError<char> atom_error(std::string_view input, char expected) {
+            if (input.empty()) {
+                return cpparsec::ParseError<char>("end of input", std::string(1, expected));
+            }
+            return cpparsec::ParseError<char>(input[0], expected);
+        }
+
+        // Same errors as char_satisfy and the character classes
+        inline cpparsec::ParseError<char> class_error(std::string_view input, const std::string& label) {
+            return cpparsec::ParseError<char>(label, input.empty() ? "end of input" : std::string(1, input[0]));
+        }
+
+        // Same matching and errors as string_, consuming the matched prefix of a mismatch
+        inline bool match_literal(std::string_view& input, std::string_view literal, cpparsec::ParseError<char>& error) {
+            if (literal.size() > input.size()) {
+                error = cpparsec::ParseError<char>("end of input", std::string(1, literal[0]));
+                return false;
+            }
+
+            for (size_t i = 0; i < literal.size(); i++) {
+                if (literal[i] != input[i]) {
+                    error = cpparsec::ParseError<char>(literal[i], input[i]);
+                    error.add_error({ std::pair{ std::string(literal), std::string(input.substr(0, i + 1)) } });
+                    input.remove_prefix(i);
+                    return false;
+                }
+            }
+
+            input.remove_prefix(literal.size());
+            return true;
+        }
+
+        // char_class(<char_class>)
+        inline bool csv_class_0(char c) {
+            const unsigned char u = static_cast<unsigned char>(c);
+            return u != ',';
+        }
+
+        // many(char_class(<char_class>))
+        inline bool csv_0(std::string_view& input, cpparsec::ParseError<char>& error, std::string& value) {
+            size_t n = 0;
+            while (n < input.size() && csv_class_0(input[n])) {
+                n++;
+            }
+            value.assign(input.data(), input.data() + n);
+            input.remove_prefix(n);
+            return true;
+        }
+
+        // sep_by1(many(char_class(<char_class>)), char_(','))
+        inline bool csv_1(std::string_view& input, cpparsec::ParseError<char>& error, std::vector<std::string>& value) {
+            {
+                std::string element{};
+                if (!csv_0(input, error, element)) {
+                    return false;
+                }
+                value.push_back(std::move(element));
+            }
+            while (true) {
+                const char* start = input.data();
+                if (input.empty() || input[0] != ',') {
+                    error = atom_error(input, ',');
+                    return input.data() == start;
+                }
+                input.remove_prefix(1);
+                std::string element{};
+                if (!csv_0(input, error, element)) {
+                    return input.data() == start;
+                }
+                value.push_back(std::move(element));
+            }
+        }
+
+        // char_class(<digit>)
+        inline bool digit_runs_class_0(char c) {
+            const unsigned char u = static_cast<unsigned char>(c);
+            return (u >= '0' && u <= '9');
+        }
+
+        // many1(char_class(<digit>))
+        inline bool digit_runs_0(std::string_view& input, cpparsec::ParseError<char>& error, std::string& value) {
+            size_t n = 0;
+            while (n < input.size() && digit_runs_class_0(input[n])) {
+                n++;
+            }
+            if (n == 0) {
+                error = class_error(input, "<digit>");
+                return false;
+            }
+            value.assign(input.data(), input.data() + n);
+            input.remove_prefix(n);
+            return true;
+        }
+
+        // char_class(<space>)
+        inline bool digit_runs_class_1(char c) {
+            const unsigned char u = static_cast<unsigned char>(c);
+            return (u >= 9 && u <= 13) || u == 32;
+        }
+
+        // skip_many(char_class(<space>))
+        inline bool digit_runs_1(std::string_view& input, cpparsec::ParseError<char>& error) {
+            size_t n = 0;
+            while (n < input.size() && digit_runs_class_1(input[n])) {
+                n++;
+            }
+            input.remove_prefix(n);
+            return true;
+        }
+
+        // sequence<0>(char_(','), skip_many(char_class(<space>)))
+        inline bool digit_runs_2(std::string_view& input, cpparsec::ParseError<char>& error) {
+            if (input.empty() || input[0] != ',') {
+                error = atom_error(input, ',');
+                return false;
+            }
+            input.remove_prefix(1);
+            if (!digit_runs_1(input, error)) {
+                return false;
+            }
+            return true;
+        }
+
+        // sep_by(many1(char_class(<digit>)), sequence<0>(char_(','), skip_many(char_class(<space>))))
+        inline bool digit_runs_3(std::string_view& input, cpparsec::ParseError<char>& error, std::vector<std::string>& value) {
+            const char* first = input.data();
+            {
+                std::string element{};
+                if (!digit_runs_0(input, error, element)) {
+                    return input.data() == first;
+                }
+                value.push_back(std::move(element));
+            }
+            while (true) {
+                const char* start = input.data();
+                if (!digit_runs_2(input, error)) {
+                    return input.data() == start;
+                }
+                std::string element{};
+                if (!digit_runs_0(input, error, element)) {
+                    return input.data() == start;
+                }
+                value.push_back(std::move(element));
+            }
+        }
+
+        // char_class(<digit>)
+        inline bool three_digits_class_0(char c) {
+            const unsigned char u = static_cast<unsigned char>(c);
+            return (u >= '0' && u <= '9');
+        }
+
+        // count<3>(char_class(<digit>))
+        inline bool three_digits_0(std::string_view& input, cpparsec::ParseError<char>& error, std::vector<char>& value) {
+            for (size_t i = 0; i < 3; i++) {
+                char element{};
+                if (input.empty() || !three_digits_class_0(input[0])) {
+                    error = class_error(input, "<digit>");
+                    return false;
+                }
+                element = input[0];
+                input.remove_prefix(1);
+                value.push_back(std::move(element));
+            }
+            return true;
+        }
+
+        // literal"let"
+        inline bool keyword_0(std::string_view& input, cpparsec::ParseError<char>& error, std::string& value) {
+            if (!match_literal(input, "let", error)) {
+                return false;
+            }
+            value = "let";
+            return true;
+        }
+
+        // literal"lambda"
+        inline bool keyword_1(std::string_view& input, cpparsec::ParseError<char>& error, std::string& value) {
+            if (!match_literal(input, "lambda", error)) {
+                return false;
+            }
+            value = "lambda";
+            return true;
+        }
+
+        // choice(choice(literal"let", literal"lambda"), literal"if")
+        inline bool keyword_2(std::string_view& input, cpparsec::ParseError<char>& error, std::string& value) {
+            const char* start = input.data();
+            if (keyword_0(input, error, value)) {
+                return true;
+            }
+            if (input.data() != start) {
+                return false;
+            }
+            value = {};
+            if (keyword_1(input, error, value)) {
+                return true;
+            }
+            if (input.data() != start) {
+                return false;
+            }
+            value = {};
+            if (!match_literal(input, "if", error)) {
+                return false;
+            }
+            value = "if";
+            return true;
+        }
+
+        // try_(literal"let")
+        inline bool backtracking_keyword_0(std::string_view& input, cpparsec::ParseError<char>& error, std::string& value) {
+            const std::string_view start = input;
+            if (!match_literal(input, "let", error)) {
+                input = start;
+                return false;
+            }
+            value = "let";
+            return true;
+        }
+
+        // choice(try_(literal"let"), literal"lambda")
+        inline bool backtracking_keyword_1(std::string_view& input, cpparsec::ParseError<char>& error, std::string& value) {
+            const char* start = input.data();
+            if (backtracking_keyword_0(input, error, value)) {
+                return true;
+            }
+            if (input.data() != start) {
+                return false;
+            }
+            value = {};
+            if (!match_literal(input, "lambda", error)) {
+                return false;
+            }
+            value = "lambda";
+            return true;
+        }
+
+        // choice(choice(char_('+'), char_('-')), success)
+        inline bool sign_0(std::string_view& input, cpparsec::ParseError<char>& error, char& value) {
+            if (!input.empty() && input[0] == '+') {
+                value = input[0];
+                input.remove_prefix(1);
+                return true;
+            }
+            if (!input.empty() && input[0] == '-') {
+                value = input[0];
+                input.remove_prefix(1);
+                return true;
+            }
+            value = '+';
+            return true;
+        }
+
+        // char_class(<digit>)
+        inline bool decimals_class_0(char c) {
+            const unsigned char u = static_cast<unsigned char>(c);
+            return (u >= '0' && u <= '9');
+        }
+
+        // many1(char_class(<digit>))
+        inline bool decimals_0(std::string_view& input, cpparsec::ParseError<char>& error, std::string& value) {
+            size_t n = 0;
+            while (n < input.size() && decimals_class_0(input[n])) {
+                n++;
+            }
+            if (n == 0) {
+                error = class_error(input, "<digit>");
+                return false;
+            }
+            value.assign(input.data(), input.data() + n);
+            input.remove_prefix(n);
+            return true;
+        }
+
+        // sequence<1>(char_('.'), many1(char_class(<digit>)))
+        inline bool decimals_1(std::string_view& input, cpparsec::ParseError<char>& error, std::string& value) {
+            if (input.empty() || input[0] != '.') {
+                error = atom_error(input, '.');
+                return false;
+            }
+            input.remove_prefix(1);
+            if (!decimals_0(input, error, value)) {
+                return false;
+            }
+            return true;
+        }
+
+        // optional(sequence<1>(char_('.'), many1(char_class(<digit>))))
+        inline bool decimals_2(std::string_view& input, cpparsec::ParseError<char>& error, std::optional<std::string>& value) {
+            const char* start = input.data();
+            std::string element{};
+            if (!decimals_1(input, error, element)) {
+                value.reset();
+                return input.data() == start;
+            }
+            value = std::move(element);
+            return true;
+        }
+
+        // literal"end"
+        inline bool identifier_0(std::string_view& input, cpparsec::ParseError<char>& error) {
+            if (!match_literal(input, "end", error)) {
+                return false;
+            }
+            return true;
+        }
+
+        // not_followed_by(literal"end")
+        inline bool identifier_1(std::string_view& input, cpparsec::ParseError<char>& error) {
+            const std::string_view start = input;
+            const bool matched = identifier_0(input, error);
+            input = start;
+            if (matched) {
+                error = cpparsec::ParseError<char>("not_followed_by", "not_followed_by");
+                return false;
+            }
+            return true;
+        }
+
+        // char_class(<letter>)
+        inline bool identifier_class_0(char c) {
+            const unsigned char u = static_cast<unsigned char>(c);
+            return (u >= 'A' && u <= 'Z') || (u >= 'a' && u <= 'z');
+        }
+
+        // many1(char_class(<letter>))
+        inline bool identifier_2(std::string_view& input, cpparsec::ParseError<char>& error, std::string& value) {
+            size_t n = 0;
+            while (n < input.size() && identifier_class_0(input[n])) {
+                n++;
+            }
+            if (n == 0) {
+                error = class_error(input, "<letter>");
+                return false;
+            }
+            value.assign(input.data(), input.data() + n);
+            input.remove_prefix(n);
+            return true;
+        }
+
+        // look_ahead(char_(';'))
+        inline bool identifier_3(std::string_view& input, cpparsec::ParseError<char>& error) {
+            const std::string_view start = input;
+            if (input.empty() || input[0] != ';') {
+                error = atom_error(input, ';');
+                return false;
+            }
+            input.remove_prefix(1);
+            input = start;
+            return true;
+        }
+
+        // sequence<0>(sequence<1>(not_followed_by(literal"end"), many1(char_class(<letter>))), look_ahead(c...
+        inline bool identifier_4(std::string_view& input, cpparsec::ParseError<char>& error, std::string& value) {
+            if (!identifier_1(input, error)) {
+                return false;
+            }
+            if (!identifier_2(input, error, value)) {
+                return false;
+            }
+            if (!identifier_3(input, error)) {
+                return false;
+            }
+            return true;
+        }
+
+        // char_class(<letter>)
+        inline bool bracketed_words_class_0(char c) {
+            const unsigned char u = static_cast<unsigned char>(c);
+            return (u >= 'A' && u <= 'Z') || (u >= 'a' && u <= 'z');
+        }
+
+        // many1(char_class(<letter>))
+        inline bool bracketed_words_0(std::string_view& input, cpparsec::ParseError<char>& error, std::string& value) {
+            size_t n = 0;
+            while (n < input.size() && bracketed_words_class_0(input[n])) {
+                n++;
+            }
+            if (n == 0) {
+                error = class_error(input, "<letter>");
+                return false;
+            }
+            value.assign(input.data(), input.data() + n);
+            input.remove_prefix(n);
+            return true;
+        }
+
+        // char_class(<space>)
+        inline bool bracketed_words_class_1(char c) {
+            const unsigned char u = static_cast<unsigned char>(c);
+            return (u >= 9 && u <= 13) || u == 32;
+        }
+
+        // skip_many(char_class(<space>))
+        inline bool bracketed_words_1(std::string_view& input, cpparsec::ParseError<char>& error) {
+            size_t n = 0;
+            while (n < input.size() && bracketed_words_class_1(input[n])) {
+                n++;
+            }
+            input.remove_prefix(n);
+            return true;
+        }
+
+        // sequence<0>(many1(char_class(<letter>)), skip_many(char_class(<space>)))
+        inline bool bracketed_words_2(std::string_view& input, cpparsec::ParseError<char>& error, std::string& value) {
+            if (!bracketed_words_0(input, error, value)) {
+                return false;
+            }
+            if (!bracketed_words_1(input, error)) {
+                return false;
+            }
+            return true;
+        }
+
+        // many(sequence<0>(many1(char_class(<letter>)), skip_many(char_class(<space>))))
+        inline bool bracketed_words_3(std::string_view& input, cpparsec::ParseError<char>& error, std::vector<std::string>& value) {
+            while (true) {
+                const char* start = input.data();
+                std::string element{};
+                if (!bracketed_words_2(input, error, element)) {
+                    return input.data() == start;
+                }
+                value.push_back(std::move(element));
+            }
+        }
+
+        // sequence<0>(sequence<1>(char_('['), many(sequence<0>(many1(char_class(<letter>)), skip_many(char_...
+        inline bool bracketed_words_4(std::string_view& input, cpparsec::ParseError<char>& error, std::vector<std::string>& value) {
+            if (input.empty() || input[0] != '[') {
+                error = atom_error(input, '[');
+                return false;
+            }
+            input.remove_prefix(1);
+            if (!bracketed_words_3(input, error, value)) {
+                return false;
+            }
+            if (input.empty() || input[0] != ']') {
+                error = atom_error(input, ']');
+                return false;
+            }
+            input.remove_prefix(1);
+            return true;
+        }
+
+        // many(sequence<0>(many1(char_class(<letter>)), skip_many(char_class(<space>))))
+        inline bool bracketed_words_5(std::string_view& input, cpparsec::ParseError<char>& error, std::vector<std::string>& value) {
+            while (true) {
+                const char* start = input.data();
+                std::string element{};
+                if (!bracketed_words_2(input, error, element)) {
+                    return input.data() == start;
+                }
+                value.push_back(std::move(element));
+            }
+        }
+
+        // sequence<0>(sequence<1>(char_('{'), many(sequence<0>(many1(char_class(<letter>)), skip_many(char_...
+        inline bool bracketed_words_6(std::string_view& input, cpparsec::ParseError<char>& error, std::vector<std::string>& value) {
+            if (input.empty() || input[0] != '{') {
+                error = atom_error(input, '{');
+                return false;
+            }
+            input.remove_prefix(1);
+            if (!bracketed_words_5(input, error, value)) {
+                return false;
+            }
+            if (input.empty() || input[0] != '}') {
+                error = atom_error(input, '}');
+                return false;
+            }
+            input.remove_prefix(1);
+            return true;
+        }
+
+        // choice(sequence<0>(sequence<1>(char_('['), many(sequence<0>(many1(char_class(<letter>)), skip_man...
+        inline bool bracketed_words_7(std::string_view& input, cpparsec::ParseError<char>& error, std::vector<std::string>& value) {
+            const char* start = input.data();
+            if (bracketed_words_4(input, error, value)) {
+                return true;
+            }
+            if (input.data() != start) {
+                return false;
+            }
+            value = {};
+            if (!bracketed_words_6(input, error, value)) {
+                return false;
+            }
+            return true;
+        }
+
+    };
+
+    inline cpparsec::ParseResult<std::vector<std::string>> csv(std::string_view& input) {
+        std::vector<std::string> value{};
+        cpparsec::ParseError<char> error{ std::string() };
+        if (!detail::csv_1(input, error, value)) {
+            return std::unexpected(std::move(error));
+        }
+        return value;
+    }
+
+    inline cpparsec::ParseResult<std::vector<std::string>> csv(std::string_view&& input) {
+        return csv(input);
+    }
+
+    inline cpparsec::ParseResult<std::vector<std::string>> digit_runs(std::string_view& input) {
+        std::vector<std::string> value{};
+        cpparsec::ParseError<char> error{ std::string() };
+        if (!detail::digit_runs_3(input, error, value)) {
+            return std::unexpected(std::move(error));
+        }
+        return value;
+    }
+
+    inline cpparsec::ParseResult<std::vector<std::string>> digit_runs(std::string_view&& input) {
+        return digit_runs(input);
+    }
+
+    inline cpparsec::ParseResult<std::vector<char>> three_digits(std::string_view& input) {
+        std::vector<char> value{};
+        cpparsec::ParseError<char> error{ std::string() };
+        if (!detail::three_digits_0(input, error, value)) {
+            return std::unexpected(std::move(error));
+        }
+        return value;
+    }
+
+    inline cpparsec::ParseResult<std::vector<char>> three_digits(std::string_view&& input) {
+        return three_digits(input);
+    }
+
+    inline cpparsec::ParseResult<std::string> keyword(std::string_view& input) {
+        std::string value{};
+        cpparsec::ParseError<char> error{ std::string() };
+        if (!detail::keyword_2(input, error, value)) {
+            return std::unexpected(std::move(error));
+        }
+        return value;
+    }
+
+    inline cpparsec::ParseResult<std::string> keyword(std::string_view&& input) {
+        return keyword(input);
+    }
+
+    inline cpparsec::ParseResult<std::string> backtracking_keyword(std::string_view& input) {
+        std::string value{};
+        cpparsec::ParseError<char> error{ std::string() };
+        if (!detail::backtracking_keyword_1(input, error, value)) {
+            return std::unexpected(std::move(error));
+        }
+        return value;
+    }
+
+    inline cpparsec::ParseResult<std::string> backtracking_keyword(std::string_view&& input) {
+        return backtracking_keyword(input);
+    }
+
+    inline cpparsec::ParseResult<char> sign(std::string_view& input) {
+        char value{};
+        cpparsec::ParseError<char> error{ std::string() };
+        if (!detail::sign_0(input, error, value)) {
+            return std::unexpected(std::move(error));
+        }
+        return value;
+    }
+
+    inline cpparsec::ParseResult<char> sign(std::string_view&& input) {
+        return sign(input);
+    }
+
+    inline cpparsec::ParseResult<std::optional<std::string>> decimals(std::string_view& input) {
+        std::optional<std::string> value{};
+        cpparsec::ParseError<char> error{ std::string() };
+        if (!detail::decimals_2(input, error, value)) {
+            return std::unexpected(std::move(error));
+        }
+        return value;
+    }
+
+    inline cpparsec::ParseResult<std::optional<std::string>> decimals(std::string_view&& input) {
+        return decimals(input);
+    }
+
+    inline cpparsec::ParseResult<std::string> identifier(std::string_view& input) {
+        std::string value{};
+        cpparsec::ParseError<char> error{ std::string() };
+        if (!detail::identifier_4(input, error, value)) {
+            return std::unexpected(std::move(error));
+        }
+        return value;
+    }
+
+    inline cpparsec::ParseResult<std::string> identifier(std::string_view&& input) {
+        return identifier(input);
+    }
+
+    inline cpparsec::ParseResult<std::vector<std::string>> bracketed_words(std::string_view& input) {
+        std::vector<std::string> value{};
+        cpparsec::ParseError<char> error{ std::string() };
+        if (!detail::bracketed_words_7(input, error, value)) {
+            return std::unexpected(std::move(error));
+        }
+        return value;
+    }
+
+    inline cpparsec::ParseResult<std::vector<std::string>> bracketed_words(std::string_view&& input) {
+        return bracketed_words(input);
+    }
+
+};
+
+#endif /* CPPARSEC_GENERATED_PARSERS_H */
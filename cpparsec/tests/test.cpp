@@ -1,17 +1,57 @@
 #define BOOST_TEST_MODULE cpparsec
 
 #include <algorithm>
+#include <filesystem>
+#include <fstream>
 #include <list>
+#include <sstream>
 #include <boost/test/included/unit_test.hpp>
 #include <boost/cregex.hpp>
 #include "../cpparsec_core.h"
 #include "../cpparsec_char.h"
+#include "../cpparsec_datetime.h"
+#include "../cpparsec_encoding.h"
+#include "../cpparsec_expression.h"
+#include "../cpparsec_memo.h"
+#include "../cpparsec_net.h"
 #include "../cpparsec_numeric.h"
+#include "../cpparsec_optimize.h"
+#include "../cpparsec_padded.h"
+#include "../cpparsec_peg.h"
+#include "../cpparsec_utf8.h"
+#include "../cpparsec_vm.h"
+#include "generated_parsers.h"
+#include "test_grammars.h"
 
 using namespace cpparsec;
 using std::string, std::string_view, std::vector, std::tuple, std::optional, std::function;
+using std::u16string, std::u16string_view, std::u32string, std::u32string_view;
 using std::ranges::all_of;
 
+// Checks that run returns, consumes and fails as p does on every input
+// Shared by the optimized, dispatched, bytecode and generated forms of a grammar
+template <typename T, typename Run>
+void check_equivalent(const Parser<T>& p, Run run, const vector<string>& inputs)
+{
+    for (const string& inputStr : inputs) {
+        string_view expected_input = inputStr;
+        string_view input = inputStr;
+        ParseResult<T> expected = p.parse(expected_input);
+        ParseResult<T> result = run(input);
+
+        BOOST_TEST_CONTEXT("input \"" << inputStr << "\"") {
+            BOOST_REQUIRE(result.has_value() == expected.has_value());
+            if (expected) {
+                BOOST_CHECK(*result == *expected);
+            }
+            else {
+                BOOST_CHECK_EQUAL(result.error().message_stack(), expected.error().message_stack());
+            }
+            BOOST_CHECK_EQUAL(input.size(), expected_input.size());
+        }
+    }
+}
+
 // --------------------------- Character Parsers ---------------------------
 BOOST_AUTO_TEST_SUITE(Character_Parsers)
 
@@ -325,258 +365,2034 @@ BOOST_AUTO_TEST_CASE(ManyTill_Parser_Complex_Type)
 
 BOOST_AUTO_TEST_SUITE_END()
 
-// --------------------------- TryOr Parsers ---------------------------
+// --------------------------- TakeUntil Parsers ---------------------------
 
-BOOST_AUTO_TEST_SUITE(TryOr_Parsers)
+BOOST_AUTO_TEST_SUITE(TakeUntil_Parsers)
 
-BOOST_AUTO_TEST_CASE(TryOr_Parser_Success)
+BOOST_AUTO_TEST_CASE(TakeUntil_Parser_Comment)
 {
-    string inputStr = "ab";
+    string inputStr = "/*inside * comment*/!";
     string_view input = inputStr;
 
-    auto a_or_b = char_('a') | char_('b');
-    ParseResult<char> result = a_or_b.parse(input);
+    Parser<string_view> simple_comment = string_("/*") >> take_until("*/");
+    ParseResult<string_view> result = simple_comment.parse(input);
 
     BOOST_REQUIRE(result.has_value());
-    BOOST_CHECK(*result == 'a');
-    BOOST_CHECK(input == "b");
+    BOOST_CHECK(*result == "inside * comment");
+    BOOST_CHECK(input == "!");
 }
 
-BOOST_AUTO_TEST_CASE(TryOr_Parser_With_Try_Success)
+BOOST_AUTO_TEST_CASE(TakeUntil_Parser_Long_Input)
 {
-    string inputStr = "three";
+    // near misses on both sides of a 16 byte block, and a long (Horspool) terminator
+    string inputStr = string(40, 'x') + "-" + string(30, '-') + "->" + string(20, 'y') + "<<END OF HEREDOC>>" + "rest";
     string_view input = inputStr;
 
-    auto two = string_("two");
-    auto three = string_("three");
-    auto try_two_or_three = try_(two) | three;
-    ParseResult<string> result = try_two_or_three.parse(input);
+    ParseResult<string_view> arrow = take_until("->").parse(input);
 
-    BOOST_REQUIRE(result.has_value());
-    BOOST_CHECK(*result == "three");
+    BOOST_REQUIRE(arrow.has_value());
+    BOOST_CHECK(*arrow == string(40, 'x') + string(31, '-'));
+
+    ParseResult<string_view> heredoc = take_until("<<END OF HEREDOC>>").parse(input);
+
+    BOOST_REQUIRE(heredoc.has_value());
+    BOOST_CHECK(*heredoc == string(20, 'y'));
+    BOOST_CHECK(input == "rest");
+}
+
+BOOST_AUTO_TEST_CASE(TakeUntil_Parser_Failure)
+{
+    string inputStr = "no terminator *";
+    string_view input = inputStr;
+
+    ParseResult<string_view> result = take_until("*/").parse(input);
+
+    BOOST_REQUIRE(!result.has_value());
+    BOOST_CHECK(result.error().message() == "Expected \"*/\", found \"end of input\"");
+    BOOST_CHECK(input == inputStr);
+}
+
+BOOST_AUTO_TEST_CASE(SkipUntil_Parser_Success)
+{
+    string inputStr = "line one\nline two";
+    string_view input = inputStr;
+
+    BOOST_REQUIRE(skip_until("\n").parse(input).has_value());
+    BOOST_CHECK(input == "line two");
 }
 
 BOOST_AUTO_TEST_SUITE_END()
 
-// --------------------------- Int Parsers ---------------------------
-BOOST_AUTO_TEST_SUITE(Int_Parsers)
+// --------------------------- Case Insensitive Parsers ---------------------------
 
-BOOST_AUTO_TEST_CASE(Int_Parser_Simple)
+BOOST_AUTO_TEST_SUITE(Case_Insensitive_Parsers)
+
+BOOST_AUTO_TEST_CASE(String_CI_Parser)
 {
-    ParseResult<int> result = int_().parse("1");
+    string inputStr = "content-LENGTH: 42";
+    string_view input = inputStr;
+
+    ParseResult<string_view> result = string_ci("Content-Length").parse(input);
 
     BOOST_REQUIRE(result.has_value());
-    BOOST_CHECK(*result == 1);
+    BOOST_CHECK(*result == "content-LENGTH");
+    BOOST_CHECK(input == ": 42");
+
+    // non-letters still compare exactly
+    ParseResult<string_view> colon = string_ci(";").parse(input);
+
+    BOOST_REQUIRE(!colon.has_value());
+    BOOST_CHECK(colon.error().message() == "Expected \";\", found \":\"");
+    BOOST_CHECK(input == ": 42");
 }
 
-BOOST_AUTO_TEST_CASE(Int_Parser_With_Space)
+BOOST_AUTO_TEST_CASE(String_CI_Long_Literal)
 {
-    ParseResult<tuple<int, int>> result = (int_() << space() & int_()).parse("25 105");
+    // longer than one SIMD block, so both the vector and scalar paths run
+    string inputStr = "TRANSFER-ENCODING-CHUNKED-extension";
+    string_view input = inputStr;
+
+    ParseResult<string_view> result = string_ci("transfer-encoding-chunked-EXTENSION").parse(input);
 
     BOOST_REQUIRE(result.has_value());
-    BOOST_CHECK(*result == tuple(25, 105));
+    BOOST_CHECK(input.empty());
+
+    string_view short_input = "transfer-encoding";
+    BOOST_CHECK(!string_ci("transfer-encoding-chunked").parse(short_input).has_value());
+    BOOST_CHECK(short_input == "transfer-encoding");
 }
 
-BOOST_AUTO_TEST_CASE(Int_Parser_Failure)
+BOOST_AUTO_TEST_CASE(Keywords_Parsers)
 {
-    ParseResult<int> result = int_().parse("a500");
+    string inputStr = "SeLeCt * from t";
+    string_view input = inputStr;
 
-    BOOST_REQUIRE(!result.has_value());
-    // println("{}", result.error().message());
-    //BOOST_CHECK(result.error().message() == "Expected \"<digit>\", found \"\"");
-}
+    auto sql = keywords_ci({ "set", "select", "from" });
+    ParseResult<string_view> result = sql.parse(input);
 
-BOOST_AUTO_TEST_SUITE_END()
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(*result == "SeLeCt");
+    BOOST_CHECK(input == " * from t");
 
-// --------------------------- Optional Result Parsers ---------------------------
+    string_view input2 = "Select";
+    BOOST_CHECK(!keywords({ "set", "select" }).parse(input2).has_value());
 
-BOOST_AUTO_TEST_SUITE(Optional_Result_Parsers)
+    ParseResult<string_view> exact = keywords({ "Set", "Select" }).parse(input2);
 
-BOOST_AUTO_TEST_CASE(Optional_Result_Parser_Int)
-{
-    Parser<optional<int>> opt_int = optional_result(int_());
-    ParseResult<optional<int>> result = opt_int.parse("123");
+    BOOST_REQUIRE(exact.has_value());
+    BOOST_CHECK(*exact == "Select");
 
-    BOOST_REQUIRE(result.has_value());
-    BOOST_CHECK(*result == optional(123));
+    string_view input3 = "where";
+    ParseResult<string_view> none = sql.parse(input3);
+
+    BOOST_REQUIRE(!none.has_value());
+    BOOST_CHECK(none.error().message() == "Expected \"one of \"set\", \"select\", \"from\"\", found \"w\"");
+    BOOST_CHECK(input3 == "where");
 }
 
-BOOST_AUTO_TEST_CASE(Optional_Result_Parser_No_Int)
+BOOST_AUTO_TEST_CASE(Padded_Keywords_Parser)
 {
-    Parser<optional<int>> opt_int = optional_result(int_());
-    ParseResult<optional<int>> result = opt_int.parse("X");
+    PaddedBuffer buffer("get");
+    PaddedInput input = buffer.view();
 
-    BOOST_REQUIRE(result.has_value());
-    BOOST_CHECK(*result == std::nullopt);
+    BOOST_CHECK(!keywords_ci<PaddedInput>({ "GETS" }).parse(input).has_value());
+    BOOST_CHECK(keywords_ci<PaddedInput>({ "GETS", "GET" }).parse(input).has_value());
+    BOOST_CHECK(input.empty());
 }
 
 BOOST_AUTO_TEST_SUITE_END()
 
-// --------------------------- ChainL Parser ---------------------------
+// --------------------------- Quoted String Parsers ---------------------------
 
-BOOST_AUTO_TEST_SUITE(ChainL_Parsers)
+BOOST_AUTO_TEST_SUITE(Quoted_String_Parsers)
 
-BOOST_AUTO_TEST_CASE(ChainL_Parser)
+BOOST_AUTO_TEST_CASE(Quoted_String_Json)
 {
-    auto add_op = success(function<int(int, int)>([](int a, int b) { return a + b; }));
-    auto mul_op = success(function<int(int, int)>([](int a, int b) { return a * b; }));
-    auto spaced = [](auto p) { return p.between(spaces(), spaces()); };
-
-    function<Parser<int>()> expr, term, factor;
+    string buffer;
+    Parser<string_view> json = quoted_string('"', EscapeRules::json, buffer);
 
-    factor = [&] { return spaced(int_() | lazy(expr).between(char_('('), char_(')'))); };
-    term = [&] { return chainl1(factor(), char_('*') >> mul_op); };
-    expr = [&] { return chainl1(term(), char_('+') >> add_op); };
+    // no escapes, a view of the input
+    string inputStr = "\"a plain string longer than one block\": 1";
+    string_view input = inputStr;
+    ParseResult<string_view> plain = json.parse(input);
 
-    ParseResult<int> result1 = expr().parse("2+3*4");
+    BOOST_REQUIRE(plain.has_value());
+    BOOST_CHECK(*plain == "a plain string longer than one block");
+    BOOST_CHECK(plain->data() == inputStr.data() + 1);
+    BOOST_CHECK(input == ": 1");
 
-    BOOST_REQUIRE(result1);
-    BOOST_CHECK(*result1 == 14);
+    // escapes are decoded into the buffer
+    ParseResult<string_view> escaped = json.parse(R"("tab\t quote\" \u00e9 \ud83d\ude00")");
 
-    ParseResult<int> result2 = expr().parse("2+3*4+5");
+    BOOST_REQUIRE(escaped.has_value());
+    BOOST_CHECK(*escaped == "tab\t quote\" \xC3\xA9 \xF0\x9F\x98\x80");
+    BOOST_CHECK(escaped->data() == buffer.data());
+}
 
-    BOOST_REQUIRE(result2);
-    BOOST_CHECK(*result2 == 19);
+BOOST_AUTO_TEST_CASE(Quoted_String_Csv_And_C)
+{
+    string_view input = "\"say \"\"hi\"\"\nthere\",2";
+    BOOST_CHECK(quoted_string('"', EscapeRules::csv).parse(input) == "say \"hi\"\nthere");
+    BOOST_CHECK(input == ",2");
 
-    ParseResult<int> result3 = expr().parse("(2)+(3*((4)))+5");
+    BOOST_CHECK(quoted_string('\'', EscapeRules::c).parse(R"('\x41\101\n\u00e9')") == "AA\n\xC3\xA9");
+    BOOST_CHECK(quoted_string('"', EscapeRules::c).parse(R"("a\\b")") == "a\\b");
+}
 
-    BOOST_REQUIRE(result3);
-    BOOST_CHECK(*result3 == 19);
+BOOST_AUTO_TEST_CASE(Quoted_String_Failure)
+{
+    string_view input = "\"unterminated";
+    BOOST_CHECK(quoted_string().parse(input).error().message() == "Expected \"closing quote\", found \"end of input\"");
+    BOOST_CHECK(input == "\"unterminated");
+
+    BOOST_CHECK(quoted_string().parse(R"("\ud800")").error().message() == "Expected \"<escape sequence>\", found \"unpaired surrogate \\ud800\"");
+    BOOST_CHECK(quoted_string().parse("\"a\tb\"").error().message() == "Expected \"<string character>\", found \"control byte 0x09 at byte offset 2\"");
+    BOOST_CHECK(quoted_string().parse(R"("\x41")").error().message() == "Expected \"<escape sequence>\", found \"\\x\"");
+    BOOST_CHECK(quoted_string().parse("'a'").error().message() == "Expected \"\"\", found \"'\"");
+}
 
-    ParseResult<int> result4 = expr().parse("(2+3*(4+5))");
+BOOST_AUTO_TEST_SUITE_END()
 
-    BOOST_REQUIRE(result4);
-    BOOST_CHECK(*result4 == 29);
+// --------------------------- TryOr Parsers ---------------------------
 
-    ParseResult<int> result5 = expr().parse("(2+3*");
+BOOST_AUTO_TEST_SUITE(TryOr_Parsers)
 
-    BOOST_REQUIRE(!result5);
+BOOST_AUTO_TEST_CASE(TryOr_Parser_Success)
+{
+    string inputStr = "ab";
+    string_view input = inputStr;
 
-    ParseResult<int> result6 = expr().parse("1+");
+    auto a_or_b = char_('a') | char_('b');
+    ParseResult<char> result = a_or_b.parse(input);
 
-    BOOST_REQUIRE(!result6);
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(*result == 'a');
+    BOOST_CHECK(input == "b");
+}
 
-    string inputStr = " ( 2 ) + ( 3 * ( ( 4 ) ) ) + 5 end";
+BOOST_AUTO_TEST_CASE(TryOr_Parser_With_Try_Success)
+{
+    string inputStr = "three";
     string_view input = inputStr;
 
-    ParseResult<int> result7 = expr().parse(input);
+    auto two = string_("two");
+    auto three = string_("three");
+    auto try_two_or_three = try_(two) | three;
+    ParseResult<string> result = try_two_or_three.parse(input);
 
-    BOOST_REQUIRE(result7);
-    BOOST_CHECK(*result7 == 19);
-    BOOST_CHECK(input == "end");
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(*result == "three");
 }
 
 BOOST_AUTO_TEST_SUITE_END()
 
-// --------------------------- LookAhead_NotFollowedBy Parser ---------------------------
+// --------------------------- Padded Input Parsers ---------------------------
 
-BOOST_AUTO_TEST_SUITE(LookAhead_NotFollowedBy_Parsers)
+BOOST_AUTO_TEST_SUITE(Padded_Input_Parsers)
 
-BOOST_AUTO_TEST_CASE(LookAhead_NotFollowedBy_Parser)
+BOOST_AUTO_TEST_CASE(Padded_Char_Parsers)
 {
-    auto partialParseNum = [](const string& word, int num) {
-            return try_(
-                look_ahead(string_(word)) >> char_(word[0]) >> success(num)
-            );
-        };
+    PaddedBuffer buffer("ab1");
+    PaddedInput input = buffer.view();
 
-    Parser<int> wordToNum =
-        partialParseNum("one", 1)
-        | partialParseNum("two", 2)
-        | partialParseNum("three", 3)
-        | partialParseNum("four", 4)
-        | partialParseNum("five", 5)
-        | partialParseNum("six", 6)
-        | partialParseNum("seven", 7)
-        | partialParseNum("eight", 8)
-        | partialParseNum("nine", 9);
+    ParseResult<tuple<char, char, char>> result = (char_<PaddedInput>('a') & letter<PaddedInput>() & digit<PaddedInput>()).parse(input);
 
-    auto charToInt = [](char c) { return c - '0'; };
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(*result == tuple('a', 'b', '1'));
+    BOOST_CHECK(input.empty());
 
-    Parser<int> number = digit().transform(charToInt) | wordToNum;
+    ParseResult<char> end = char_<PaddedInput>('x').parse(input);
 
-    Parser<int> numberBetweenLetters = number.between(
-        (many(not_followed_by(number) >> letter())),
-        (many(not_followed_by(number) >> letter())));
+    BOOST_REQUIRE(!end.has_value());
+    BOOST_CHECK(end.error().message() == "Expected \"end of input\", found \"x\"");
 
-    string inputStr = "x5KZ4threeXtwone0Y";
-    string_view input = inputStr;
+    auto any = [](char) { return true; };
+    BOOST_CHECK(!char_satisfy<PaddedInput>(any).parse(input).has_value());
+    BOOST_CHECK(!char_<PaddedInput>('\0').parse(input).has_value());
 
-    ParseResult<vector<int>> result1 = many1(numberBetweenLetters).parse(input);
+    // a failing predicate is called once, its result reused for the error
+    int calls = 0;
+    auto counted = [&calls](char c) { ++calls; return c == 'x'; };
+    PaddedInput input2 = buffer.view();
+    BOOST_CHECK(!char_satisfy<PaddedInput>(counted).parse(input2).has_value());
+    BOOST_CHECK(calls == 1);
+}
 
-    BOOST_REQUIRE(result1.has_value());
-    BOOST_CHECK(*result1 == vector({ 5, 4, 3, 2, 1, 0 }));
-    BOOST_CHECK(input == "");
+BOOST_AUTO_TEST_CASE(Padded_String_Parsers)
+{
+    PaddedBuffer buffer("finished,finishes");
+    PaddedInput input = buffer.view();
+
+    auto non_comma = [](char c) { return c != ','; };
+    ParseResult<vector<string>> fields = sep_by1(many(char_satisfy<PaddedInput>(non_comma)), char_<PaddedInput>(',')).parse(input);
+
+    BOOST_REQUIRE(fields.has_value());
+    BOOST_CHECK(*fields == vector<string>({ "finished", "finishes" }));
+
+    PaddedInput input2 = buffer.view();
+    BOOST_CHECK(string_<PaddedInput>("finished,").parse(input2).has_value());
+
+    ParseResult<string> result = string_<PaddedInput>("finished").parse(input2);
+
+    BOOST_REQUIRE(!result.has_value());
+    BOOST_CHECK(result.error().message() == "Expected 'd', found 's'");
+    BOOST_CHECK(!string_<PaddedInput>("s!").parse(input2).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(Padded_Buffer_From_File)
+{
+    auto path = std::filesystem::temp_directory_path() / "cpparsec_padded_test.txt";
+    std::ofstream(path, std::ios::binary) << "-42 17";
+
+    auto buffer = PaddedBuffer::from_file(path);
+    std::filesystem::remove(path);
+
+    BOOST_REQUIRE(buffer.has_value());
+    PaddedInput input = buffer->view();
+
+    ParseResult<vector<int>> result = many(int_<PaddedInput>().skip(spaces<PaddedInput>())).parse(input);
+
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(*result == vector({ -42, 17 }));
+    BOOST_CHECK(!PaddedBuffer::from_file(path).has_value());
 }
 
 BOOST_AUTO_TEST_SUITE_END()
 
-// --------------------------- Satisfy Parsers ---------------------------
+// --------------------------- UTF-8 Parsers ---------------------------
 
-BOOST_AUTO_TEST_SUITE(Satisfy_Parsers)
+BOOST_AUTO_TEST_SUITE(Utf8_Parsers)
 
-BOOST_AUTO_TEST_CASE(Char_Satisfy_Success)
+BOOST_AUTO_TEST_CASE(Codepoint_Parser_Success)
 {
-    string inputStr = "abc";
+    string inputStr = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80!";
     string_view input = inputStr;
 
-    auto is_a = [](char c) { return c == 'a'; };
-    Parser<char> a = char_satisfy(is_a, "not a");
-    ParseResult<char> result = a.parse(input);
+    ParseResult<vector<char32_t>> result = count(4, codepoint()).parse(input);
 
     BOOST_REQUIRE(result.has_value());
-    BOOST_CHECK(*result == 'a');
-    BOOST_CHECK(input == "bc");
+    BOOST_CHECK(*result == vector<char32_t>({ U'a', U'\u00e9', U'\u20ac', U'\U0001F600' }));
+    BOOST_CHECK(input == "!");
 }
 
-BOOST_AUTO_TEST_CASE(Satisfy_IsDigit_Success)
+BOOST_AUTO_TEST_CASE(Codepoint_Parser_Invalid)
 {
-    string inputStr = "1abc";
+    string overlong = "\xC0\xAF";
+    string surrogate = "\xED\xA0\x80";
+    string truncated = "\xE2\x82";
+
+    ParseResult<char32_t> result1 = codepoint().parse(overlong);
+    ParseResult<char32_t> result2 = codepoint().parse(surrogate);
+    ParseResult<char32_t> result3 = codepoint().parse(truncated);
+
+    BOOST_REQUIRE(!result1.has_value());
+    BOOST_CHECK(result1.error().message() == "Expected \"<codepoint>\", found \"invalid UTF-8 byte 0xC0 at byte offset 0\"");
+    BOOST_REQUIRE(!result2.has_value());
+    BOOST_CHECK(result2.error().message() == "Expected \"<codepoint>\", found \"invalid UTF-8 byte 0xA0 at byte offset 1\"");
+    BOOST_REQUIRE(!result3.has_value());
+    BOOST_CHECK(result3.error().message() == "Expected \"<codepoint>\", found \"truncated UTF-8 sequence at byte offset 2\"");
+}
+
+BOOST_AUTO_TEST_CASE(Unicode_Class_Parsers)
+{
+    BOOST_CHECK(general_category(U'A') == GeneralCategory::Lu);
+    BOOST_CHECK(general_category(U'\u0416') == GeneralCategory::Lu);
+    BOOST_CHECK(general_category(U'\u4E2D') == GeneralCategory::Lo);
+    BOOST_CHECK(general_category(U'\u0663') == GeneralCategory::Nd);
+    BOOST_CHECK(general_category(U'\u3000') == GeneralCategory::Zs);
+    BOOST_CHECK(general_category(U'\U0010FFFF') == GeneralCategory::Cn);
+
+    string inputStr = "\xD0\x96\xD0\xB6\xD9\xA3\xC2\xBF";
     string_view input = inputStr;
 
-    auto is_digit = [](char c) { return isdigit(c); };
-    Parser<char> digit_parser = satisfy(any_char(), is_digit);
-    ParseResult<char> result = digit_parser.parse(input);
+    auto classes = unicode_upper() & unicode_lower() & unicode_digit() & unicode_punct();
+    BOOST_CHECK(classes.parse(input).has_value());
+    BOOST_CHECK(input.empty());
 
-    BOOST_REQUIRE(result.has_value());
-    BOOST_CHECK(*result == '1');
-    BOOST_CHECK(input == "abc");
+    ParseResult<char32_t> result = unicode_letter().parse("\xD9\xA3");
+
+    BOOST_REQUIRE(!result.has_value());
+    BOOST_CHECK(result.error().message() == "Expected \"<unicode letter>\", found \"\xD9\xA3\"");
 }
 
-BOOST_AUTO_TEST_CASE(Satisfy_IsDigit_Failure)
+BOOST_AUTO_TEST_CASE(Take_While_Codepoint_Parser)
 {
-    string inputStr = "a1bc";
+    string inputStr = string(70, 'a') + "\xC3\xA9\xE4\xB8\xAD" + string(20, 'b') + " rest";
     string_view input = inputStr;
 
-    auto is_digit = [](char c) { return isdigit(c); };
-    Parser<char> digit_parser = any_char().satisfy(is_digit);
-    ParseResult<char> result = digit_parser.parse(input);
+    ParseResult<string_view> result = take_while_codepoint(is_unicode_letter).parse(input);
+
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(result->size() == 70 + 2 + 3 + 20);
+    BOOST_CHECK(input == " rest");
+}
+
+BOOST_AUTO_TEST_CASE(Valid_Utf8_Parser)
+{
+    string valid = string(100, 'x') + "\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80" + string(50, 'y');
+    string invalid = valid;
+    invalid[120] = '\xFF';
+
+    string_view input = valid;
+    BOOST_CHECK(valid_utf8().parse(input).has_value());
+    BOOST_CHECK(input.empty());
+
+    ParseResult<string_view> result = valid_utf8().parse(invalid);
 
     BOOST_REQUIRE(!result.has_value());
-    BOOST_CHECK(result.error().message() == "Failed satisfy");
+    BOOST_CHECK(result.error().message() == "Expected \"<valid UTF-8>\", found \"invalid UTF-8 byte 0xFF at byte offset 120\"");
 }
 
 BOOST_AUTO_TEST_SUITE_END()
 
-// --------------------------- Choice Parsers ---------------------------
-BOOST_AUTO_TEST_SUITE(Choice_Parsers)
+// --------------------------- Wide Input Parsers ---------------------------
 
-BOOST_AUTO_TEST_CASE(Choice_Parser_Multiple_Choices)
+BOOST_AUTO_TEST_SUITE(Wide_Input_Parsers)
+
+BOOST_AUTO_TEST_CASE(Utf16_Char_Parsers)
 {
-    string inputStr = "two threeten two tenEND";
-    string_view input = inputStr;
+    u16string inputStr = u"ab1 rest";
+    u16string_view input = inputStr;
 
-    Parser<int> t_skeleton_nums = choice(vector({
-        try_(string_("two") >> spaces() >> success(2)),
-        try_(string_("three") >> spaces() >> success(3)),
-        try_(string_("ten") >> spaces() >> success(10)),
-    }));
+    auto p = char_<u16string_view>(u'a') & letter<u16string_view>() & digit<u16string_view>() & space<u16string_view>();
+    ParseResult<tuple<char16_t, char16_t, char16_t, char16_t>, char16_t> result = p.parse(input);
 
-    ParseResult<vector<int>> result = many1(t_skeleton_nums).parse(input);
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(*result == tuple(u'a', u'b', u'1', u' '));
+    BOOST_CHECK(input == u"rest");
+
+    ParseResult<u16string, char16_t> rest = string_<u16string_view>(u"rest").parse(input);
+
+    BOOST_REQUIRE(rest.has_value());
+    BOOST_CHECK(*rest == u"rest");
+    BOOST_CHECK(input.empty());
+}
+
+BOOST_AUTO_TEST_CASE(Char_Classes_High_Bytes)
+{
+    // bytes above 0x7F are negative chars, classified as unsigned char like the ASCII ones
+    for (int b = 0x80; b <= 0xFF; b++) {
+        string inputStr(1, static_cast<char>(b));
+        for (const Parser<char>& p : { letter(), digit(), space(), alpha_num() }) {
+            string_view input = inputStr;
+            BOOST_CHECK(!p.parse(input).has_value());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Utf32_Int_Parser)
+{
+    u32string inputStr = U"-42,17";
+    u32string_view input = inputStr;
+
+    auto ints = sep_by1(int_<u32string_view>(), char_<u32string_view>(U','));
+    ParseResult<vector<int>, char32_t> result = ints.parse(input);
 
     BOOST_REQUIRE(result.has_value());
-    BOOST_CHECK(*result == vector({ 2, 3, 10, 2, 10 }));
-    BOOST_CHECK(input == "END");
+    BOOST_CHECK(*result == vector<int>({ -42, 17 }));
+}
+
+BOOST_AUTO_TEST_CASE(Wide_Error_Messages)
+{
+    // non-ASCII code units are reported as UTF-8, surrogate pairs are combined and lone surrogates become U+FFFD
+    u16string inputStr = u"\u00e9t\U0001F600";
+    u16string_view input = inputStr;
+
+    ParseResult<char16_t, char16_t> c = char_<u16string_view>(u'e').parse(input);
+
+    BOOST_REQUIRE(!c.has_value());
+    BOOST_CHECK(c.error().message() == "Expected '\xC3\xA9', found 'e'");
+
+    ParseResult<u16string, char16_t> str = string_<u16string_view>(u"\u00e9t\U0001F601").parse(input);
+
+    BOOST_REQUIRE(!str.has_value());
+    BOOST_CHECK(str.error().message() == "Expected '\xEF\xBF\xBD', found '\xEF\xBF\xBD'");
+    BOOST_CHECK(str.error().message_top() == ("Expected \"\xC3\xA9t\xF0\x9F\x98\x81\", found \"\xC3\xA9t\xF0\x9F\x98\x80\""));
+
+    u32string inputStr2 = U"x";
+    u32string_view input2 = inputStr2;
+
+    ParseResult<char32_t, char32_t> d = digit<u32string_view>().parse(input2);
+
+    BOOST_REQUIRE(!d.has_value());
+    BOOST_CHECK(d.error().message() == "Expected \"<digit>\", found \"x\"");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// --------------------------- Int Parsers ---------------------------
+BOOST_AUTO_TEST_SUITE(Int_Parsers)
+
+BOOST_AUTO_TEST_CASE(Int_Parser_Simple)
+{
+    ParseResult<int> result = int_().parse("1");
+
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(*result == 1);
+}
+
+BOOST_AUTO_TEST_CASE(Int_Parser_With_Space)
+{
+    ParseResult<tuple<int, int>> result = (int_() << space() & int_()).parse("25 105");
+
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(*result == tuple(25, 105));
+}
+
+BOOST_AUTO_TEST_CASE(Int_Parser_Failure)
+{
+    ParseResult<int> result = int_().parse("a500");
+
+    BOOST_REQUIRE(!result.has_value());
+    // println("{}", result.error().message());
+    //BOOST_CHECK(result.error().message() == "Expected \"<digit>\", found \"\"");
+}
+
+BOOST_AUTO_TEST_CASE(Integer_Parser_Widths)
+{
+    BOOST_CHECK(integer<int8_t>().parse("-128") == int8_t(-128));
+    BOOST_CHECK(integer<uint8_t>().parse("+255") == uint8_t(255));
+    BOOST_CHECK(integer<int16_t>().parse("-32768") == int16_t(-32768));
+    BOOST_CHECK(integer<uint32_t>().parse("4294967295") == 4294967295u);
+    BOOST_CHECK(integer<int64_t>().parse("-9223372036854775808") == std::numeric_limits<int64_t>::min());
+    BOOST_CHECK(integer<uint64_t>().parse("18446744073709551615") == std::numeric_limits<uint64_t>::max());
+}
+
+BOOST_AUTO_TEST_CASE(Integer_Parser_Overflow)
+{
+    string inputStr = "256,1";
+    string_view input = inputStr;
+
+    ParseResult<uint8_t> result = integer<uint8_t>().parse(input);
+
+    BOOST_REQUIRE(!result.has_value());
+    BOOST_CHECK(result.error().message() == "Expected \"integer in [0, 255]\", found \"256\"");
+    BOOST_CHECK(input == ",1");
+
+    BOOST_CHECK(!integer<int64_t>().parse("9223372036854775808").has_value());
+    BOOST_CHECK(!cpparsec::uint().parse("4294967296").has_value());
+}
+
+BOOST_AUTO_TEST_CASE(Integer_Parser_Long_Digit_Runs)
+{
+    // 16 digits take two 8 digit kernel steps, the rest go through the byte tail
+    string inputStr = "1234567890123456 00000000000000000000042 18446744073709551616";
+    string_view input = inputStr;
+
+    BOOST_CHECK(integer<uint64_t>().parse(input) == 1234567890123456ull);
+    BOOST_CHECK((char_(' ') >> integer<uint8_t>()).parse(input) == uint8_t(42));
+    BOOST_CHECK(!(char_(' ') >> integer<uint64_t>()).parse(input).has_value());
+    BOOST_CHECK(input.empty());
+
+    BOOST_CHECK(detail::is_eight_digits(detail::load_le64("12345678")));
+    BOOST_CHECK(!detail::is_eight_digits(detail::load_le64("1234:678")));
+    BOOST_CHECK(!detail::is_eight_digits(detail::load_le64("1234/678")));
+    BOOST_CHECK(detail::parse_eight_digits(detail::load_le64("12345678")) == 12345678);
+}
+
+BOOST_AUTO_TEST_CASE(Padded_Integer_Parser)
+{
+    PaddedBuffer buffer("1234567812345678");
+    PaddedInput input = buffer.view();
+
+    BOOST_CHECK((integer<int64_t, PaddedInput>().parse(input) == 1234567812345678ll));
+    BOOST_CHECK(input.empty());
+}
+
+BOOST_AUTO_TEST_CASE(Integer_Parser_Signs)
+{
+    string inputStr = "-5";
+    string_view input = inputStr;
+
+    BOOST_CHECK(!integer<unsigned>().parse(input).has_value());
+    BOOST_CHECK(input == "-5");
+    BOOST_CHECK(!integer<int>().parse("+-5").has_value());
+    BOOST_CHECK(!integer<int>().parse("-").has_value());
+
+    ParseResult<vector<int>> list = sep_by(integer<int>(), char_(',')).parse("1,+2,-3");
+
+    BOOST_REQUIRE(list.has_value());
+    BOOST_CHECK(*list == vector<int>({ 1, 2, -3 }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// --------------------------- Int List Parsers ---------------------------
+
+BOOST_AUTO_TEST_SUITE(Int_List_Parsers)
+
+BOOST_AUTO_TEST_CASE(Int_List_Spaced)
+{
+    string inputStr = "0 1732 -2783723  1723 -23823 281 +0237 12 2 +23 end";
+    string_view input = inputStr;
+
+    ParseResult<vector<int>> result = int_list<int>(" ").parse(input);
+
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(*result == vector<int>({ 0, 1732, -2783723, 1723, -23823, 281, 237, 12, 2, 23 }));
+    BOOST_CHECK(input == "end");
+
+    // same result as the combinator version
+    BOOST_CHECK(*result == *many(int_().skip(spaces())).parse(inputStr));
+}
+
+BOOST_AUTO_TEST_CASE(Int_List_Caller_Vector)
+{
+    // long separator runs go through the vector path
+    string inputStr = "1,2,\t" + string(40, ' ') + "3\n4";
+    string_view input = inputStr;
+
+    vector<uint16_t> values = { 9 };
+    ParseResult<size_t> count = int_list<uint16_t>(", \t\n", values).parse(input);
+
+    BOOST_REQUIRE(count.has_value());
+    BOOST_CHECK(*count == 4);
+    BOOST_CHECK(values == vector<uint16_t>({ 9, 1, 2, 3, 4 }));
+    BOOST_CHECK(input.empty());
+
+    ParseResult<vector<int>> empty = int_list<int>(",").parse("x");
+
+    BOOST_REQUIRE(empty.has_value());
+    BOOST_CHECK(empty->empty());
+}
+
+BOOST_AUTO_TEST_CASE(Int_List_Overflow)
+{
+    string inputStr = "1,2,300,4";
+    string_view input = inputStr;
+
+    ParseResult<vector<uint8_t>> result = int_list<uint8_t>(",").parse(input);
+
+    BOOST_REQUIRE(!result.has_value());
+    BOOST_CHECK(result.error().message() == "Expected \"integer in [0, 255]\", found \"300\"");
+    BOOST_CHECK(input == ",4");
+
+    // a caller vector keeps only what it held before the failed parse
+    vector<uint8_t> values = { 9 };
+    ParseResult<size_t> count = int_list<uint8_t>(",", values).parse("1,2,300,4");
+
+    BOOST_REQUIRE(!count.has_value());
+    BOOST_CHECK(values == vector<uint8_t>({ 9 }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// --------------------------- Decimal Parsers ---------------------------
+
+BOOST_AUTO_TEST_SUITE(Decimal_Parsers)
+
+BOOST_AUTO_TEST_CASE(Decimal_Parser)
+{
+    string inputStr = "-1234.5678 USD";
+    string_view input = inputStr;
+
+    ParseResult<int64_t> result = decimal<4>().parse(input);
+
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(*result == -12345678);
+    BOOST_CHECK(input == " USD");
+
+    BOOST_CHECK(decimal<2>().parse("12") == 1200);
+    BOOST_CHECK(decimal<2>().parse("+0.5") == 50);
+    BOOST_CHECK(decimal<2>().parse("3.1400") == 314);
+    BOOST_CHECK(decimal<0>().parse("42") == 42);
+
+    // a '.' without digits is left for the next parser
+    input = "7.";
+    BOOST_CHECK(decimal<2>().parse(input) == 700);
+    BOOST_CHECK(input == ".");
+}
+
+BOOST_AUTO_TEST_CASE(Decimal_Parser_Rounding)
+{
+    Parser<int64_t> half_up = decimal<2>(DecimalRounding::half_up);
+    Parser<int64_t> half_even = decimal<2>(DecimalRounding::half_even);
+
+    BOOST_CHECK(half_up.parse("1.005") == 101);
+    BOOST_CHECK(half_even.parse("1.005") == 100);
+    BOOST_CHECK(half_even.parse("1.015") == 102);
+    BOOST_CHECK(half_even.parse("1.0050001") == 101);
+    BOOST_CHECK(half_up.parse("-2.675") == -268);
+
+    string_view input = "19.999 EUR";
+    BOOST_CHECK(decimal<2>().parse(input).error().message() == "Expected \"at most 2 fraction digits\", found \"19.999\"");
+    BOOST_CHECK(input == " EUR");
+}
+
+BOOST_AUTO_TEST_CASE(Decimal_Parser_Overflow)
+{
+    BOOST_CHECK(decimal<4>().parse("922337203685477.5807") == std::numeric_limits<int64_t>::max());
+    BOOST_CHECK(decimal<4>().parse("-922337203685477.5808") == std::numeric_limits<int64_t>::min());
+    BOOST_CHECK(decimal<4>().parse("922337203685477.5808").error().message()
+        == "Expected \"decimal with 4 fraction digits in range\", found \"922337203685477.5808\"");
+    BOOST_CHECK(!decimal<2>(DecimalRounding::half_up).parse("92233720368547758.075").has_value());
+    BOOST_CHECK(!decimal<4>().parse("123456789012345678901234").has_value());
+
+#ifdef __SIZEOF_INT128__
+    ParseResult<__int128> wide = decimal<6, __int128>().parse("123456789012345678901234.5");
+    BOOST_REQUIRE(wide.has_value());
+    BOOST_CHECK(*wide / 1000000000000 == (__int128)123456789012345678);
+    BOOST_CHECK(*wide % 1000000000000 == (__int128)901234500000);
+#endif
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// --------------------------- Radix Integer Parsers ---------------------------
+
+BOOST_AUTO_TEST_SUITE(Radix_Integer_Parsers)
+
+BOOST_AUTO_TEST_CASE(Hex_Integer_Parser)
+{
+    BOOST_CHECK(hex_integer<uint32_t>().parse("0xDEADbeef") == 0xDEADBEEFu);
+    BOOST_CHECK(hex_integer<uint64_t>().parse("7fff_ffff_ffff_ffff") == 0x7FFFFFFFFFFFFFFFull);
+    BOOST_CHECK(hex_integer<uint8_t>().parse("ff") == uint8_t(0xFF));
+
+    string inputStr = "0x1_g";
+    string_view input = inputStr;
+
+    BOOST_CHECK(hex_integer<int>().parse(input) == 1);
+    BOOST_CHECK(input == "_g");
+
+    // a prefix without digits is a single 0
+    string inputStr2 = "0xg";
+    string_view input2 = inputStr2;
+
+    BOOST_CHECK(hex_integer<int>().parse(input2) == 0);
+    BOOST_CHECK(input2 == "xg");
+
+    ParseResult<uint8_t> overflow = hex_integer<uint8_t>().parse("0x100");
+
+    BOOST_REQUIRE(!overflow.has_value());
+    BOOST_CHECK(overflow.error().message() == "Expected \"hex integer in [0, 255]\", found \"0x100\"");
+}
+
+BOOST_AUTO_TEST_CASE(Oct_Bin_Integer_Parsers)
+{
+    BOOST_CHECK(oct_integer<int>().parse("0o755") == 0755);
+    BOOST_CHECK(oct_integer<int>().parse("644") == 0644);
+    BOOST_CHECK(bin_integer<uint16_t>().parse("0b1010_0101") == uint16_t(0xA5));
+    BOOST_CHECK(!bin_integer<uint8_t>().parse("1_0000_0000").has_value());
+
+    ParseResult<int> result = oct_integer<int>().parse("9");
+
+    BOOST_REQUIRE(!result.has_value());
+    BOOST_CHECK(result.error().message() == "Expected \"<octal digit>\", found \"9\"");
+}
+
+BOOST_AUTO_TEST_CASE(Hex_Bytes_Parser)
+{
+    string inputStr = "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855 -";
+    string_view input = inputStr;
+
+    std::array<uint8_t, 32> digest;
+    ParseResult<std::span<uint8_t>> result = hex_bytes(digest).parse(input);
+
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(result->data() == digest.data());
+    BOOST_CHECK(digest[0] == 0xE3 && digest[1] == 0xB0 && digest[31] == 0x55);
+    BOOST_CHECK(input == " -");
+
+    string_view bad = "00112233445566778899AABBCCDDEEFz";
+    std::array<uint8_t, 16> buffer;
+
+    BOOST_CHECK(!hex_bytes(buffer).parse(bad).has_value());
+    BOOST_CHECK(bad.size() == 32);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// --------------------------- Float Parsers ---------------------------
+
+BOOST_AUTO_TEST_SUITE(Float_Parsers)
+
+BOOST_AUTO_TEST_CASE(Double_Parser_C_Syntax)
+{
+    BOOST_CHECK(double_().parse("3.25") == 3.25);
+    BOOST_CHECK(double_().parse("-0.1") == -0.1);
+    BOOST_CHECK(double_().parse("+1e3") == 1000.0);
+    BOOST_CHECK(double_().parse(".5") == 0.5);
+    BOOST_CHECK(double_().parse("2.") == 2.0);
+    BOOST_CHECK(double_().parse("6.02214076E23") == 6.02214076e23);
+    BOOST_CHECK(float_().parse("0.1") == 0.1f);
+
+    // past the fast path, converted by the fallback
+    BOOST_CHECK(double_().parse("2.2250738585072011e-308") == 2.2250738585072011e-308);
+    BOOST_CHECK(double_().parse("0.30000000000000000000001") == 0.3);
+
+    string inputStr = "1.5e,x";
+    string_view input = inputStr;
+
+    BOOST_CHECK(double_().parse(input) == 1.5);
+    BOOST_CHECK(input == "e,x");
+}
+
+BOOST_AUTO_TEST_CASE(Double_Parser_JSON_Syntax)
+{
+    FloatOptions json{ .json = true };
+
+    string inputStr = "0123";
+    string_view input = inputStr;
+
+    BOOST_CHECK(double_(json).parse(input) == 0.0);
+    BOOST_CHECK(input == "123");
+
+    BOOST_CHECK(!double_(json).parse("+1").has_value());
+    BOOST_CHECK(!double_(json).parse(".5").has_value());
+
+    string inputStr2 = "1.]";
+    string_view input2 = inputStr2;
+
+    BOOST_CHECK(double_(json).parse(input2) == 1.0);
+    BOOST_CHECK(input2 == ".]");
+}
+
+BOOST_AUTO_TEST_CASE(Double_Parser_Special_Values)
+{
+    FloatOptions specials{ .inf_nan = true };
+
+    BOOST_CHECK(double_(specials).parse("-Infinity") == -std::numeric_limits<double>::infinity());
+    BOOST_CHECK(double_(specials).parse("inf") == std::numeric_limits<double>::infinity());
+    BOOST_CHECK(std::isnan(*double_(specials).parse("NaN")));
+    BOOST_CHECK(!double_().parse("inf").has_value());
+
+    string inputStr = "1e400;";
+    string_view input = inputStr;
+
+    ParseResult<double> result = double_().parse(input);
+
+    BOOST_REQUIRE(!result.has_value());
+    BOOST_CHECK(result.error().message() == "Expected \"floating point number in range\", found \"1e400\"");
+    BOOST_CHECK(input == ";");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// --------------------------- Timestamp Parsers ---------------------------
+
+BOOST_AUTO_TEST_SUITE(Timestamp_Parsers)
+
+BOOST_AUTO_TEST_CASE(Rfc3339_Parser)
+{
+    using namespace std::chrono;
+    string inputStr = "1996-12-19T16:39:57.5-08:00 GET /";
+    string_view input = inputStr;
+
+    ParseResult<Timestamp> result = rfc3339().parse(input);
+
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(*result == sys_days(1996y / 12 / 20) + 39min + 57s + 500ms);
+    BOOST_CHECK(input == " GET /");
+
+    BOOST_CHECK(rfc3339().parse("1985-04-12t23:20:50.123456789999z") == sys_days(1985y / 4 / 12) + 23h + 20min + 50s + 123456789ns);
+    BOOST_CHECK(rfc3339().parse("1990-12-31T23:59:60Z") == sys_days(1991y / 1 / 1));
+
+    // ISO 8601 forms that RFC 3339 doesn't allow
+    BOOST_CHECK(rfc3339().parse("1985-04-12 23:20:50Z").error().message() == "Expected \"RFC 3339 timestamp\", found \" \"");
+    BOOST_CHECK(rfc3339().parse("1985-04-12T23:20:50").error().message() == "Expected \"RFC 3339 timestamp\", found \"end of input\"");
+}
+
+BOOST_AUTO_TEST_CASE(Iso8601_Parser)
+{
+    using namespace std::chrono;
+    Timestamp expected = sys_days(2024y / 2 / 29) + 12h + 30min;
+
+    BOOST_CHECK(iso8601_timestamp().parse("2024-02-29T12:30:00") == expected);
+    BOOST_CHECK(iso8601_timestamp().parse("2024-02-29 14:30:00+02") == expected);
+    BOOST_CHECK(iso8601_timestamp().parse("2024-02-29T07:00:00-0530") == expected);
+    BOOST_CHECK(iso8601_timestamp().parse("2024-02-29T12:30:00,000Z") == expected);
+
+    // short input is copied into a local buffer, padded input is read in place
+    PaddedBuffer buffer("2024-02-29T12:30:00Z");
+    PaddedInput padded = buffer.view();
+    BOOST_CHECK(iso8601_timestamp<PaddedInput>().parse(padded) == expected);
+    BOOST_CHECK(padded.empty());
+}
+
+BOOST_AUTO_TEST_CASE(Timestamp_Parser_Failure)
+{
+    string inputStr = "2023-02-29T00:00:00Z";
+    string_view input = inputStr;
+
+    ParseResult<Timestamp> result = rfc3339().parse(input);
+
+    BOOST_REQUIRE(!result.has_value());
+    BOOST_CHECK(result.error().message() == "Expected \"valid date and time\", found \"2023-02-29T00:00:00Z\"");
+    BOOST_CHECK(input.empty());
+
+    // misplaced separators don't consume
+    input = "2023-02-28T00-00:00Z";
+    BOOST_CHECK(rfc3339().parse(input).error().message() == "Expected \"RFC 3339 timestamp\", found \"-\"");
+    BOOST_CHECK(input == "2023-02-28T00-00:00Z");
+
+    BOOST_CHECK(rfc3339().parse("2262-06-01T00:00:00Z").error().message() == "Expected \"timestamp in range\", found \"2262-06-01T00:00:00Z\"");
+    BOOST_CHECK(!rfc3339().parse("2023-02-28T24:00:00Z").has_value());
+    BOOST_CHECK(!rfc3339().parse("2023-02-28T00:00:00+24:00").has_value());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// --------------------------- Address Parsers ---------------------------
+
+BOOST_AUTO_TEST_SUITE(Address_Parsers)
+
+BOOST_AUTO_TEST_CASE(Ipv4_Parser)
+{
+    string inputStr = "192.168.0.1 - - [09/Mar/2024]";
+    string_view input = inputStr;
+
+    ParseResult<uint32_t> result = ipv4().parse(input);
+
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(*result == 0xC0A80001);
+    BOOST_CHECK(input == " - - [09/Mar/2024]");
+
+    BOOST_CHECK(ipv4().parse("0.0.0.0") == 0u);
+    BOOST_CHECK(ipv4().parse("255.255.255.255") == 0xFFFFFFFF);
+    BOOST_CHECK(ipv4().parse("256.1.1.1").error().message() == "Expected \"octet in [0, 255]\", found \"256\"");
+    BOOST_CHECK(ipv4().parse("10.01.1.1").error().message() == "Expected \"octet in [0, 255]\", found \"01\"");
+    BOOST_CHECK(ipv4().parse("10.1.1").error().message() == "Expected \"'.'\", found \"end of input\"");
+}
+
+BOOST_AUTO_TEST_CASE(Ipv6_Parser)
+{
+    using Bytes = std::array<uint8_t, 16>;
+
+    BOOST_CHECK(ipv6().parse("2001:db8::1") == Bytes({ 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 }));
+    BOOST_CHECK(ipv6().parse("::") == Bytes{});
+    BOOST_CHECK(ipv6().parse("::ffff:192.168.0.1") == Bytes({ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff, 192, 168, 0, 1 }));
+    BOOST_CHECK(ipv6().parse("1:2:3:4:5:6:7:8") == Bytes({ 0, 1, 0, 2, 0, 3, 0, 4, 0, 5, 0, 6, 0, 7, 0, 8 }));
+    BOOST_CHECK(ipv6().parse("FE80::") == Bytes({ 0xfe, 0x80 }));
+
+    string_view input = "1::2::3";
+    BOOST_CHECK(ipv6().parse(input).error().message() == "Expected \"<hex digit>\", found \":\"");
+    BOOST_CHECK(input == "1::2::3");
+    BOOST_CHECK(!ipv6().parse("1:2:3:4:5:6:7").has_value());
+    BOOST_CHECK(!ipv6().parse("1:2:3:4::5:6:7:8").has_value());
+    BOOST_CHECK(!ipv6().parse("12345::").has_value());
+}
+
+BOOST_AUTO_TEST_CASE(Cidr_Parser)
+{
+    ParseResult<Cidr> v4 = cidr().parse("10.0.0.0/8");
+
+    BOOST_REQUIRE(v4.has_value());
+    BOOST_CHECK(v4->is_ipv4);
+    BOOST_CHECK(v4->prefix_length == 8);
+    BOOST_CHECK(v4->address[0] == 10);
+
+    ParseResult<Cidr> v6 = cidr().parse("2001:db8::/32");
+
+    BOOST_REQUIRE(v6.has_value());
+    BOOST_CHECK(!v6->is_ipv4);
+    BOOST_CHECK(v6->prefix_length == 32);
+    BOOST_CHECK(v6->address[1] == 0x01);
+
+    BOOST_CHECK(cidr().parse("10.0.0.0/33").error().message() == "Expected \"prefix length in [0, 32]\", found \"33\"");
+    BOOST_CHECK(cidr().parse("10.0.0.0").error().message() == "Expected \"'/'\", found \"end of input\"");
+    BOOST_CHECK(cidr().parse("::/128").has_value());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// --------------------------- Decoding Parsers ---------------------------
+
+BOOST_AUTO_TEST_SUITE(Decoding_Parsers)
+
+BOOST_AUTO_TEST_CASE(Base64_Parser)
+{
+    // long enough for the vector path, followed by a JSON delimiter
+    string text = "The quick brown fox jumps over the lazy dog.";
+    string inputStr = "VGhlIHF1aWNrIGJyb3duIGZveCBqdW1wcyBvdmVyIHRoZSBsYXp5IGRvZy4=\",";
+    string_view input = inputStr;
+
+    ParseResult<vector<uint8_t>> result = base64_decode().parse(input);
+
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(string(result->begin(), result->end()) == text);
+    BOOST_CHECK(input == "\",");
+
+    // URL alphabet without padding into a caller buffer
+    vector<uint8_t> bytes = { 0 };
+    ParseResult<size_t> count = base64_decode(Base64Alphabet::url, bytes).parse("-_8");
+
+    BOOST_REQUIRE(count.has_value());
+    BOOST_CHECK(*count == 2);
+    BOOST_CHECK(bytes == vector<uint8_t>({ 0, 0xFB, 0xFF }));
+}
+
+BOOST_AUTO_TEST_CASE(Base64_Parser_Failure)
+{
+    string_view input = "QUJDR";
+
+    BOOST_CHECK(base64_decode().parse(input).error().message() == "Expected \"<base64 digit>\", found \"end of input at byte offset 5\"");
+    BOOST_CHECK(input == "QUJDR");
+
+    BOOST_CHECK(base64_decode().parse("QUJDRA=x").error().message() == "Expected \"<base64 digit>\", found \"byte 0x78 at byte offset 7\"");
+
+    // a byte outside the alphabet ends the run
+    input = "QUJD+A";
+    BOOST_CHECK(base64_decode(Base64Alphabet::url).parse(input)->size() == 3);
+    BOOST_CHECK(input == "+A");
+}
+
+BOOST_AUTO_TEST_CASE(Percent_Parser)
+{
+    string inputStr = "caf%C3%A9+au+lait&size=large";
+    string_view input = inputStr;
+
+    ParseResult<string> result = percent_decode("&=", true).parse(input);
+
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(*result == "caf\xC3\xA9 au lait");
+    BOOST_CHECK(input == "&size=large");
+
+    string path = "/";
+    BOOST_CHECK(percent_decode("?", path).parse("a%2Fb+c?q") == 5);
+    BOOST_CHECK(path == "/a/b+c");
+
+    BOOST_CHECK(percent_decode().parse("100%").error().message() == "Expected \"<hex digit>\", found \"end of input at byte offset 4\"");
+    BOOST_CHECK(percent_decode().parse("%2g").error().message() == "Expected \"<hex digit>\", found \"byte 0x67 at byte offset 2\"");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// --------------------------- Optional Result Parsers ---------------------------
+
+BOOST_AUTO_TEST_SUITE(Optional_Result_Parsers)
+
+BOOST_AUTO_TEST_CASE(Optional_Result_Parser_Int)
+{
+    Parser<optional<int>> opt_int = optional_result(int_());
+    ParseResult<optional<int>> result = opt_int.parse("123");
+
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(*result == optional(123));
+}
+
+BOOST_AUTO_TEST_CASE(Optional_Result_Parser_No_Int)
+{
+    Parser<optional<int>> opt_int = optional_result(int_());
+    ParseResult<optional<int>> result = opt_int.parse("X");
+
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(*result == std::nullopt);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// --------------------------- ChainL Parser ---------------------------
+
+BOOST_AUTO_TEST_SUITE(ChainL_Parsers)
+
+BOOST_AUTO_TEST_CASE(ChainL_Parser)
+{
+    auto add_op = success(function<int(int, int)>([](int a, int b) { return a + b; }));
+    auto mul_op = success(function<int(int, int)>([](int a, int b) { return a * b; }));
+    auto spaced = [](auto p) { return p.between(spaces(), spaces()); };
+
+    function<Parser<int>()> expr, term, factor;
+
+    factor = [&] { return spaced(int_() | lazy(expr).between(char_('('), char_(')'))); };
+    term = [&] { return chainl1(factor(), char_('*') >> mul_op); };
+    expr = [&] { return chainl1(term(), char_('+') >> add_op); };
+
+    ParseResult<int> result1 = expr().parse("2+3*4");
+
+    BOOST_REQUIRE(result1);
+    BOOST_CHECK(*result1 == 14);
+
+    ParseResult<int> result2 = expr().parse("2+3*4+5");
+
+    BOOST_REQUIRE(result2);
+    BOOST_CHECK(*result2 == 19);
+
+    ParseResult<int> result3 = expr().parse("(2)+(3*((4)))+5");
+
+    BOOST_REQUIRE(result3);
+    BOOST_CHECK(*result3 == 19);
+
+    ParseResult<int> result4 = expr().parse("(2+3*(4+5))");
+
+    BOOST_REQUIRE(result4);
+    BOOST_CHECK(*result4 == 29);
+
+    ParseResult<int> result5 = expr().parse("(2+3*");
+
+    BOOST_REQUIRE(!result5);
+
+    ParseResult<int> result6 = expr().parse("1+");
+
+    BOOST_REQUIRE(!result6);
+
+    string inputStr = " ( 2 ) + ( 3 * ( ( 4 ) ) ) + 5 end";
+    string_view input = inputStr;
+
+    ParseResult<int> result7 = expr().parse(input);
+
+    BOOST_REQUIRE(result7);
+    BOOST_CHECK(*result7 == 19);
+    BOOST_CHECK(input == "end");
+}
+
+namespace {
+    // Counts its copies, chains move their operands
+    struct Counted {
+        static inline int copies = 0;
+        int value = 0;
+
+        Counted(int value = 0) : value(value) { }
+        Counted(const Counted& other) : value(other.value) { copies++; }
+        Counted(Counted&&) = default;
+        Counted& operator=(const Counted& other) { value = other.value; copies++; return *this; }
+        Counted& operator=(Counted&&) = default;
+    };
+
+    enum class ArithmeticOp { add, subtract, multiply, power };
+
+    int apply_arithmetic(ArithmeticOp op, int a, int b) {
+        switch (op) {
+        case ArithmeticOp::add: return a + b;
+        case ArithmeticOp::subtract: return a - b;
+        case ArithmeticOp::multiply: return a * b;
+        default:
+            int result = 1;
+            for (int i = 0; i < b; i++) {
+                result *= a;
+            }
+            return result;
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ChainL_Typed_Operators)
+{
+    // any callable, without a std::function
+    auto subtract = char_('-') >> success([](int a, int b) { return a - b; });
+    BOOST_CHECK_EQUAL(*chainl1(int_(), subtract).parse("10-3-2"), 5);
+    BOOST_CHECK_EQUAL(*chainl(int_(), subtract, 42).parse("x"), 42);
+
+    using Combine = int (*)(int, int);
+    auto add_or_multiply = char_('+') >> success<string_view, Combine>([](int a, int b) { return a + b; })
+        | char_('*') >> success<string_view, Combine>([](int a, int b) { return a * b; });
+    BOOST_CHECK_EQUAL(*chainl1(int_(), add_or_multiply).parse("2+3*4"), 20);
+
+    // operands are moved through the chain
+    auto counted = digit().transform([](char c) { return Counted(c - '0'); });
+    auto add = char_('+') >> success([](Counted a, Counted b) { return Counted(a.value + b.value); });
+    Counted::copies = 0;
+    ParseResult<Counted> sum = chainl1(counted, add).parse("1+2+3+4");
+    BOOST_REQUIRE(sum);
+    BOOST_CHECK_EQUAL(sum->value, 10);
+    BOOST_CHECK_EQUAL(Counted::copies, 0);
+}
+
+BOOST_AUTO_TEST_CASE(ChainL_Tag_Operators)
+{
+    auto op = char_('+') >> success(ArithmeticOp::add)
+        | char_('-') >> success(ArithmeticOp::subtract)
+        | char_('*') >> success(ArithmeticOp::multiply);
+
+    BOOST_CHECK_EQUAL(*chainl1(int_(), op, apply_arithmetic).parse("10-3-2"), 5);
+    BOOST_CHECK_EQUAL(*chainl1(int_(), op, apply_arithmetic).parse("2+3*4"), 20);
+    BOOST_CHECK_EQUAL(*chainl(int_(), op, apply_arithmetic, -1).parse(""), -1);
+    BOOST_CHECK_EQUAL(*chainr1(int_(), op, apply_arithmetic).parse("10-3-2"), 9);
+
+    // an operator without its operand fails after consuming it
+    BOOST_CHECK(!chainl1(int_(), op, apply_arithmetic).parse("1+"));
+    BOOST_CHECK(chainl1(int_(), op, apply_arithmetic).grammar()->kind == GrammarKind::chainl1);
+}
+
+BOOST_AUTO_TEST_CASE(ChainR_Parser)
+{
+    auto power = char_('^') >> success(ArithmeticOp::power);
+    auto cons = char_(':') >> success([](string a, string b) { return a + "(" + b + ")"; });
+    auto letters = many1(letter());
+
+    BOOST_CHECK_EQUAL(*chainr1(int_(), power, apply_arithmetic).parse("2^3^2"), 512);
+    BOOST_CHECK_EQUAL(*chainr1(letters, cons).parse("a:b:c"), "a(b(c))");
+    BOOST_CHECK_EQUAL(*chainr1(letters, cons).parse("a"), "a");
+    BOOST_CHECK_EQUAL(*chainr(letters, cons, string("none")).parse("1"), "none");
+    BOOST_CHECK(!chainr1(letters, cons).parse("a:b:"));
+
+    string_view input = "a:b c";
+    BOOST_CHECK_EQUAL(*chainr1(letters, cons).parse(input), "a(b)");
+    BOOST_CHECK_EQUAL(input, " c");
+
+    // long chains don't recurse
+    string ones = "1";
+    for (int i = 0; i < 100000; i++) {
+        ones += "^1";
+    }
+    BOOST_CHECK_EQUAL(*chainr1(int_(), power, apply_arithmetic).parse(ones), 1);
+    BOOST_CHECK(chainr(letters, cons, string()).grammar()->kind == GrammarKind::chainr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// --------------------------- LookAhead_NotFollowedBy Parser ---------------------------
+
+BOOST_AUTO_TEST_SUITE(LookAhead_NotFollowedBy_Parsers)
+
+BOOST_AUTO_TEST_CASE(LookAhead_NotFollowedBy_Parser)
+{
+    auto partialParseNum = [](const string& word, int num) {
+            return try_(
+                look_ahead(string_(word)) >> char_(word[0]) >> success(num)
+            );
+        };
+
+    Parser<int> wordToNum =
+        partialParseNum("one", 1)
+        | partialParseNum("two", 2)
+        | partialParseNum("three", 3)
+        | partialParseNum("four", 4)
+        | partialParseNum("five", 5)
+        | partialParseNum("six", 6)
+        | partialParseNum("seven", 7)
+        | partialParseNum("eight", 8)
+        | partialParseNum("nine", 9);
+
+    auto charToInt = [](char c) { return c - '0'; };
+
+    Parser<int> number = digit().transform(charToInt) | wordToNum;
+
+    Parser<int> numberBetweenLetters = number.between(
+        (many(not_followed_by(number) >> letter())),
+        (many(not_followed_by(number) >> letter())));
+
+    string inputStr = "x5KZ4threeXtwone0Y";
+    string_view input = inputStr;
+
+    ParseResult<vector<int>> result1 = many1(numberBetweenLetters).parse(input);
+
+    BOOST_REQUIRE(result1.has_value());
+    BOOST_CHECK(*result1 == vector({ 5, 4, 3, 2, 1, 0 }));
+    BOOST_CHECK(input == "");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// --------------------------- Satisfy Parsers ---------------------------
+
+BOOST_AUTO_TEST_SUITE(Satisfy_Parsers)
+
+BOOST_AUTO_TEST_CASE(Char_Satisfy_Success)
+{
+    string inputStr = "abc";
+    string_view input = inputStr;
+
+    auto is_a = [](char c) { return c == 'a'; };
+    Parser<char> a = char_satisfy(is_a, "not a");
+    ParseResult<char> result = a.parse(input);
+
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(*result == 'a');
+    BOOST_CHECK(input == "bc");
+}
+
+BOOST_AUTO_TEST_CASE(Satisfy_IsDigit_Success)
+{
+    string inputStr = "1abc";
+    string_view input = inputStr;
+
+    auto is_digit = [](char c) { return isdigit(c); };
+    Parser<char> digit_parser = satisfy(any_char(), is_digit);
+    ParseResult<char> result = digit_parser.parse(input);
+
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(*result == '1');
+    BOOST_CHECK(input == "abc");
+}
+
+BOOST_AUTO_TEST_CASE(Satisfy_IsDigit_Failure)
+{
+    string inputStr = "a1bc";
+    string_view input = inputStr;
+
+    auto is_digit = [](char c) { return isdigit(c); };
+    Parser<char> digit_parser = any_char().satisfy(is_digit);
+    ParseResult<char> result = digit_parser.parse(input);
+
+    BOOST_REQUIRE(!result.has_value());
+    BOOST_CHECK(result.error().message() == "Failed satisfy");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// --------------------------- Choice Parsers ---------------------------
+BOOST_AUTO_TEST_SUITE(Choice_Parsers)
+
+BOOST_AUTO_TEST_CASE(Choice_Parser_Multiple_Choices)
+{
+    string inputStr = "two threeten two tenEND";
+    string_view input = inputStr;
+
+    Parser<int> t_skeleton_nums = choice(vector({
+        try_(string_("two") >> spaces() >> success(2)),
+        try_(string_("three") >> spaces() >> success(3)),
+        try_(string_("ten") >> spaces() >> success(10)),
+    }));
+
+    ParseResult<vector<int>> result = many1(t_skeleton_nums).parse(input);
+
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(*result == vector({ 2, 3, 10, 2, 10 }));
+    BOOST_CHECK(input == "END");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// ----------------------------- Grammar IR -----------------------------
+BOOST_AUTO_TEST_SUITE(Grammar_IR)
+
+BOOST_AUTO_TEST_CASE(Grammar_IR_Leaves)
+{
+    auto sign = char_('-');
+    auto keyword = string_("let");
+    auto digits = digit();
+
+    BOOST_CHECK(sign.grammar()->kind == GrammarKind::char_);
+    BOOST_CHECK(sign.grammar()->atoms == vector({ '-' }));
+    BOOST_CHECK(keyword.grammar()->kind == GrammarKind::literal);
+    BOOST_CHECK(keyword.grammar()->atoms == vector({ 'l', 'e', 't' }));
+    BOOST_REQUIRE(digits.grammar()->kind == GrammarKind::char_class);
+    BOOST_CHECK(digits.grammar()->predicate('7') && !digits.grammar()->predicate('x'));
+    BOOST_CHECK(take_until("*/").grammar()->kind == GrammarKind::opaque);
+}
+
+BOOST_AUTO_TEST_CASE(Grammar_IR_Combinators)
+{
+    Parser<char> a = char_('a');
+    auto keyword_set = string_("if") | string_("in") | try_(string_("int"));
+
+    auto list = between(char_('['), char_(']'), sep_by(many1(digit()), char_(',')));
+    BOOST_CHECK(std::format("{}", *list.grammar())
+        == "sequence<0>(sequence<1>(char_('['), sep_by(many1(char_class(<digit>)), char_(','))), char_(']'))");
+
+    auto choice_node = keyword_set.grammar();
+    BOOST_REQUIRE(choice_node->kind == GrammarKind::choice);
+    BOOST_CHECK(choice_node->children[0]->kind == GrammarKind::choice);
+    BOOST_CHECK(choice_node->children[1]->kind == GrammarKind::try_);
+
+    BOOST_CHECK(std::format("{}", *(a & char_('b')).grammar()) == "sequence(char_('a'), char_('b'))");
+    BOOST_CHECK(std::format("{}", *count(3, a).grammar()) == "count<3>(char_('a'))");
+    BOOST_CHECK(std::format("{}", *(not_followed_by(a) >> look_ahead(a)).grammar())
+        == "sequence<1>(not_followed_by(char_('a')), look_ahead(char_('a')))");
+    BOOST_CHECK(std::format("{}", *(skip_many(a) % "a's").grammar()) == "label(\"a's\", skip_many(char_('a')))");
+}
+
+BOOST_AUTO_TEST_CASE(Grammar_IR_Shared_Nodes)
+{
+    // nodes are shared, not copied, and recording them leaves parsing unchanged
+    Parser<char> digit_parser = digit();
+    auto number = many1(digit_parser);
+    auto numbers = sep_by1(number, char_(','));
+
+    BOOST_CHECK(number.grammar()->children[0] == digit_parser.grammar());
+    BOOST_CHECK(numbers.grammar()->children[0] == number.grammar());
+    BOOST_CHECK(choice(vector({ char_('x'), char_('y'), char_('z') })).grammar()->children.size() == 3);
+
+    string_view input = "12,345;";
+    ParseResult<vector<string>> result = numbers.parse(input);
+
+    BOOST_REQUIRE(result.has_value());
+    BOOST_CHECK(*result == vector<string>({ "12", "345" }));
+    BOOST_CHECK(input == ";");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// ---------------------------- Grammar Optimizer ----------------------------
+BOOST_AUTO_TEST_SUITE(Grammar_Optimizer)
+
+// Checks that optimize(p) returns, consumes and fails as p does on every input
+template <typename T>
+void check_optimized(const Parser<T>& p, const vector<string>& inputs)
+{
+    Parser<T> optimized = optimize(p);
+    check_equivalent(p, [&](string_view& input) { return optimized.parse(input); }, inputs);
+}
+
+BOOST_AUTO_TEST_CASE(Optimizer_Char_Rewrites)
+{
+    auto non_comma = [](char c) { return c != ','; };
+
+    check_optimized(many(char_satisfy(non_comma)), { "abc,d", ",", "", "abc" });
+    check_optimized(many1(letter()), { "abc1", "1", "" });
+    check_optimized(char_('a') >> char_('b') >> char_('c'), { "abcd", "abx", "ab", "x", "" });
+    check_optimized(try_(char_('x')) | char_('y'), { "x", "y", "z", "" });
+    check_optimized(char_('-') | char_('+') | digit(), { "-1", "+", "5", "x", "" });
+    check_optimized(skip(many(space())) >> letter(), { "  a", "a", "  1", "" });
+
+    // bytes above 0x7F reach tabulated predicates as the negative chars they are in the input
+    check_optimized(many(char_class([](char c) { return c < 0; })), { "\xE9\xFF" "a", "a", "" });
+    check_optimized(many1(alpha_num()), { "a1\xE9", "\xC3\xA9", "" });
+}
+
+BOOST_AUTO_TEST_CASE(Optimizer_Calls_User_Predicates)
+{
+    // char_satisfy predicates may keep state, so they are called as the parser calls them
+    int calls = 0;
+    auto letters = many(char_('x') | char_satisfy([&calls](char) { return ++calls <= 2; }));
+    auto optimized = optimize(letters);
+    BOOST_CHECK_EQUAL(calls, 0);
+
+    ParseResult<string> expected = letters.parse("xaxaa");
+    BOOST_CHECK_EQUAL(calls, 3);
+    calls = 0;
+    ParseResult<string> result = optimized.parse("xaxaa");
+    BOOST_CHECK_EQUAL(calls, 3);
+    BOOST_REQUIRE(result && expected);
+    BOOST_CHECK_EQUAL(*result, *expected);
+
+    // char_class predicates are tabulated by optimize, parses don't call them
+    int class_calls = 0;
+    auto digits = optimize(many(char_class([&class_calls](char c) { ++class_calls; return c >= '0' && c <= '9'; })));
+    const int tabulated = class_calls;
+    BOOST_CHECK(tabulated >= 256);
+    BOOST_CHECK_EQUAL(*digits.parse("123x"), "123");
+    BOOST_CHECK_EQUAL(class_calls, tabulated);
+}
+
+BOOST_AUTO_TEST_CASE(Optimizer_Sequences_And_Choices)
+{
+    // consumptive failures, try_ and choices mixing classes with other alternatives
+    auto list = between(char_('['), char_(']'), sep_by(many1(digit()), char_(',')));
+    auto keyword = try_(string_("int")) | string_("in") | many1(letter());
+    auto signed_digits = optional_(char_('-') | char_('+')) >> many1(digit()) << spaces() << eof();
+
+    check_optimized(list, { "[1,22,333]", "[]", "[1,]", "[1,2", "1]", "" });
+    check_optimized(keyword, { "int", "in", "inx", "if", "i", "1" });
+    check_optimized(signed_digits, { "-12  ", "+3", "12x", "-", "", "--1" });
+    check_optimized(char_('a') >> (char_('b') | char_('c')) >> string_("de") << char_('!'), { "abde!", "acde!", "ade!", "abdx", "abde" });
+    check_optimized(count(2, char_('a') << char_(';')), { "a;a;", "a;b;", "a;a" });
+    check_optimized(many(char_('a') >> char_('b')), { "ababx", "aba", "" });
+    check_optimized(skip_many1(char_('a') >> char_('b')), { "abab", "aba", "b" });
+}
+
+BOOST_AUTO_TEST_CASE(Optimizer_Many_Till_Search)
+{
+    // many_till(any_char(), lit) searches for lit, consuming and failing where the per-byte loop would
+    vector<string> inputs = { "abc*/rest", "*/", "abc", "", "a*b*/", "ab*", "*", "a**/" };
+    check_optimized(many_till(any_char(), try_(string_("*/"))), inputs);
+    check_optimized(many_till(any_char(), string_("*/")), inputs);
+    check_optimized(many_till<char, string, string>(any_char(), string_("-->")), { "x -- y -->", "--", "-->", "x-", "-" });
+    check_optimized(string_("/*") >> many_till(any_char(), try_(string_("*/"))), { "/* c */ x", "/* c", "/ c" });
+
+    auto comment = many_till(any_char(), try_(string_("*/")));
+    BOOST_CHECK(optimize(comment).grammar()->kind == GrammarKind::opaque);
+    // other ends keep the loop
+    auto line = many_till(any_char(), newline());
+    BOOST_CHECK(optimize(line).grammar() == line.grammar());
+}
+
+BOOST_AUTO_TEST_CASE(Optimizer_Keeps_Opaque_Parsers)
+{
+    // labels, transforms and hand-written parsers keep their behavior
+    auto digits = many1(digit()) % "number";
+    auto length = many1(letter()).transform([](const string& s) { return s.size(); });
+    auto comment = string_("/*") >> take_until("*/");
+
+    check_optimized(digits, { "12", "x" });
+    check_optimized(length, { "abc1", "1" });
+    check_optimized(comment, { "/* a */b", "/* a", "//" });
+    check_optimized(not_followed_by(string_("--")) >> look_ahead(any_char()), { "-a", "--", "" });
+
+    // a label is kept as the same parser, a rewrite is a new opaque parser and leaves p as it was
+    Parser<string> word = many(letter());
+    Parser<string> optimized = optimize(word);
+    BOOST_CHECK(optimize(digits).grammar() == digits.grammar());
+    BOOST_CHECK(optimized.grammar()->kind == GrammarKind::opaque);
+    BOOST_CHECK(word.grammar()->kind == GrammarKind::many);
+    BOOST_CHECK(*optimized.parse(string("abc1")) == "abc");
+}
+
+BOOST_AUTO_TEST_CASE(Optimizer_Dispatches_Choices)
+{
+    // statement keywords sharing first atoms, nullable and consuming alternatives
+    auto statement = try_(string_("select")) | try_(string_("set")) | string_("insert") | many(char_('x')) | string_("delete");
+    auto value = choice(vector({ string_("null"), string_("true"), many1(digit()), char_('"') >> many_till(any_char(), char_('"')) }));
+
+    check_optimized(statement, { "select", "set", "sex", "insert", "inx", "xx", "delete", "d", "" });
+    check_optimized(value, { "null", "nul", "true", "42", "\"ab\"", "\"ab", "x", "" });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(Choice_Dispatch)
+
+// Checks that a choice parsed past its warmup returns, consumes and fails as a fresh one does
+template <typename T>
+void check_dispatched(const std::function<Parser<T>()>& make, const vector<string>& inputs)
+{
+    Parser<T> hot = make();
+    for (int i = 0; i < 16; i++) {
+        for (const string& inputStr : inputs) {
+            hot.parse(inputStr);
+        }
+    }
+
+    // a fresh choice per input, so it stays cold
+    for (const string& inputStr : inputs) {
+        check_equivalent(make(), [&](string_view& input) { return hot.parse(input); }, { inputStr });
+    }
+}
+
+BOOST_AUTO_TEST_CASE(First_Sets)
+{
+    FirstSet keyword = first_set(*(string_("if") | string_("while") | many1(digit())).grammar());
+    BOOST_CHECK(keyword.atoms['i'] && keyword.atoms['w'] && keyword.atoms['7']);
+    BOOST_CHECK_EQUAL(keyword.atoms.count(), 12);
+    BOOST_CHECK(!keyword.nullable);
+
+    // a prefix matching empty input lets the atoms after it in
+    FirstSet number = first_set(*(optional_(char_('-')) >> many1(digit())).grammar());
+    BOOST_CHECK_EQUAL(number.atoms.count(), 11);
+    BOOST_CHECK(!number.nullable && !number.viable('+') && number.viable('-'));
+
+    BOOST_CHECK(first_set(*many(letter()).grammar()).nullable);
+    BOOST_CHECK(first_set(*sep_by(letter(), char_(',')).grammar()).nullable);
+    BOOST_CHECK(!first_set(*sep_by1(letter(), char_(',')).grammar()).atoms[',']);
+
+    // hand-written parsers may start with any atom or none
+    FirstSet hand_written = first_set(*take_until("*/").grammar());
+    BOOST_CHECK(hand_written.atoms.all() && hand_written.nullable);
+}
+
+BOOST_AUTO_TEST_CASE(Dispatch_Keeps_Or_Semantics)
+{
+    // disjoint keywords, a consumptive failure in "inx", and the last alternative's error
+    check_dispatched<string>([] { return try_(string_("select")) | try_(string_("set")) | string_("insert") | string_("delete") | many1(letter()); },
+        { "select", "set", "sex", "insert", "inx", "delete", "dx", "1", "" });
+    check_dispatched<string>([] { return choice(vector({ string_("null"), string_("true"), string_("false"), many1(digit()) })); },
+        { "null", "true", "false", "fals", "123", "x", "" });
+    check_dispatched<char>([] { return char_('-') | char_('+') | digit(); }, { "-", "+", "5", "x", "" });
+}
+
+BOOST_AUTO_TEST_CASE(Dispatch_Falls_Back_To_Order)
+{
+    // overlapping first atoms try the alternatives in order
+    check_dispatched<string>([] { return try_(string_("ab")) | try_(string_("ac")) | string_("a"); }, { "ab", "ac", "ad", "b", "" });
+    // an alternative matching empty input is tried on every atom, hiding the ones after it
+    check_dispatched<string>([] { return string_("b") | many(char_('x')) | string_("c"); }, { "b", "xx", "c", "" });
+    // nested choices are flattened through labels only as opaque alternatives
+    check_dispatched<string>([] { return (string_("if") | string_("in")) % "keyword" | many1(digit()); }, { "if", "in", "9", "x", "" });
+}
+
+BOOST_AUTO_TEST_CASE(Dispatch_Leaves_User_Predicates_Alone)
+{
+    // char_satisfy predicates are only called by parses, however hot the choice
+    int calls = 0;
+    bool negative = false;
+    auto x_or_y = char_satisfy([&](char c) { calls++; negative |= c < 0; return c == 'x'; }) | char_('y');
+    for (int i = 0; i < 20; i++) {
+        BOOST_CHECK(x_or_y.parse(string("x")).has_value());
+    }
+    BOOST_CHECK_EQUAL(calls, 20);
+    BOOST_CHECK(!negative);
+
+    // so they may start with any atom, while the library classes are tabulated
+    BOOST_CHECK(first_set(*char_satisfy([](char c) { return c == 'x'; }).grammar()).atoms.all());
+    BOOST_CHECK_EQUAL(first_set(*(digit() | letter()).grammar()).atoms.count(), 62);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(Packrat)
+
+BOOST_AUTO_TEST_CASE(Memo_Parses_Each_Position_Once)
+{
+    int calls = 0;
+    auto name = memo(many1(char_satisfy([&calls](char c) { calls++; return isalpha(c) != 0; })));
+    auto statement = try_(name << char_('(')) | try_(name << char_('=')) | name;
+
+    // the three alternatives share one parse of name
+    BOOST_CHECK(*packrat(statement).parse(string("abc;")) == "abc");
+    BOOST_CHECK_EQUAL(calls, 4);
+
+    // outside packrat each outermost memo has a table of its own
+    calls = 0;
+    BOOST_CHECK(*statement.parse(string("abc;")) == "abc");
+    BOOST_CHECK_EQUAL(calls, 12);
+
+    // a recorded failure consumes what the failed parse consumed
+    auto plain = char_('a') >> char_('b');
+    auto ab = memo(plain);
+    string_view expected_input = "ax", input = "ax";
+    auto expected = (try_(plain << char_('!')) | plain).parse(expected_input);
+    auto result = packrat(try_(ab << char_('!')) | ab).parse(input);
+    BOOST_REQUIRE(!result && !expected);
+    BOOST_CHECK_EQUAL(result.error().message_stack(), expected.error().message_stack());
+    BOOST_CHECK_EQUAL(input.size(), expected_input.size());
+}
+
+BOOST_AUTO_TEST_CASE(Rules_Memoized_By_Switch)
+{
+    int calls = 0;
+    auto digits = rule("digits", many1(char_satisfy([&calls](char c) { calls++; return isdigit(c) != 0; })));
+    auto number = try_(digits << char_('.')) | digits;
+
+    BOOST_CHECK(*packrat(number).parse(string("42;")) == "42");
+    BOOST_CHECK_EQUAL(calls, 6);
+
+    calls = 0;
+    BOOST_CHECK(*packrat(number, { .memoize_rules = true }).parse(string("42;")) == "42");
+    BOOST_CHECK_EQUAL(calls, 3);
+
+    BOOST_CHECK(digits.grammar()->kind == GrammarKind::rule);
+    BOOST_CHECK_EQUAL(digits.grammar()->label, "digits");
+}
+
+BOOST_AUTO_TEST_CASE(Window_Keeps_Results)
+{
+    // a long list backtracking one item at a time, with records dropped far behind
+    auto name = memo(many1(letter()));
+    auto items = many(try_(name << char_(',')) | name << char_(';'));
+
+    string input;
+    for (int i = 0; i < 2000; i++) {
+        input += i % 3 == 0 ? "abc;" : "de,";
+    }
+
+    ParseResult<vector<string>> expected = items.parse(input);
+    ParseResult<vector<string>> windowed = packrat(items, { .window = 16 }).parse(input);
+    ParseResult<vector<string>> unbounded = packrat(items).parse(input);
+    BOOST_REQUIRE(expected && windowed && unbounded);
+    BOOST_CHECK(*windowed == *expected);
+    BOOST_CHECK(*unbounded == *expected);
+    BOOST_CHECK_EQUAL(expected->size(), 2000);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// ----------------------- Left Recursive Rules ------------------------
+
+BOOST_AUTO_TEST_SUITE(Left_Recursion)
+
+BOOST_AUTO_TEST_CASE(Direct_Left_Recursion)
+{
+    auto subtract = [](tuple<int, int> operands) { return get<0>(operands) - get<1>(operands); };
+    Rule<int> difference("difference");
+    difference = (difference << char_('-') & int_()).transform(subtract) | int_();
+
+    // grows to the left, so subtraction associates to the left
+    BOOST_CHECK_EQUAL(*difference.parse("9-3-2"), 4);
+    BOOST_CHECK_EQUAL(*difference.parse("7"), 7);
+
+    // stops at the longest seed, leaving the rest of the input
+    string_view input = "9-3-x";
+    BOOST_CHECK_EQUAL(*difference.parse(input), 6);
+    BOOST_CHECK_EQUAL(input, "-x");
+    BOOST_CHECK(!difference.parse("x"));
+
+    // postfix calls, counted
+    Rule<int> call("call");
+    call = (call << string_("()")).transform([](int calls) { return calls + 1; }) | char_('f').transform([](char) { return 0; });
+    BOOST_CHECK_EQUAL(*call.parse("f()()()"), 3);
+    BOOST_CHECK(call.grammar()->kind == GrammarKind::rule);
+    BOOST_CHECK(std::format("{}", *call.grammar()) == "rule(\"call\")");
+}
+
+BOOST_AUTO_TEST_CASE(Indirect_Left_Recursion)
+{
+    // a -> b 'a' | 'x', b -> a 'b' | 'y'
+    Rule<string> a("a"), b("b");
+    auto append = [](char c) { return [c](string s) { return s + c; }; };
+    a = (b << char_('a')).transform(append('a')) | string_("x");
+    b = (a << char_('b')).transform(append('b')) | string_("y");
+
+    BOOST_CHECK_EQUAL(*a.parse("xbaba"), "xbaba");
+    BOOST_CHECK_EQUAL(*a.parse("ya"), "ya");
+    BOOST_CHECK_EQUAL(*b.parse("xbab"), "xbab");
+
+    // rules reentered further on aren't left recursive
+    Rule<int> nested("nested");
+    nested = (char_('(') >> nested << char_(')')).transform([](int depth) { return depth + 1; }) | success(0);
+    BOOST_CHECK_EQUAL(*nested.parse("((()))"), 3);
+
+    Rule<int> undefined("undefined");
+    BOOST_CHECK(!undefined.parse("1"));
+}
+
+BOOST_AUTO_TEST_CASE(Left_Recursion_Matches_Chains)
+{
+    auto add_op = success(function<int(int, int)>([](int a, int b) { return a + b; }));
+    auto mul_op = success(function<int(int, int)>([](int a, int b) { return a * b; }));
+    auto add = [](tuple<int, int> operands) { return get<0>(operands) + get<1>(operands); };
+    auto mul = [](tuple<int, int> operands) { return get<0>(operands) * get<1>(operands); };
+
+    Rule<int> expr("expr"), term("term"), factor("factor");
+    expr = (expr << char_('+') & term).transform(add) | term;
+    term = (term << char_('*') & factor).transform(mul) | factor;
+    factor = int_() | char_('(') >> expr << char_(')');
+
+    function<Parser<int>()> chain_expr, chain_term, chain_factor;
+    chain_factor = [&] { return int_() | char_('(') >> lazy(chain_expr) << char_(')'); };
+    chain_term = [&] { return chainl1(chain_factor(), char_('*') >> mul_op); };
+    chain_expr = [&] { return chainl1(chain_term(), char_('+') >> add_op); };
+
+    for (string text : { "1", "2+3*4", "2*3+4", "(1+2)*(3+4)*5", "1+2+3*(4+5*(6+7))", "((((8))))" }) {
+        ParseResult<int> expected = chain_expr().parse(text);
+        BOOST_REQUIRE(expected);
+        BOOST_CHECK_EQUAL(*expr.parse(text), *expected);
+        BOOST_CHECK_EQUAL(*packrat(Parser<int>(expr), { .memoize_rules = true }).parse(text), *expected);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// ------------------------ Expression Parsers -------------------------
+
+BOOST_AUTO_TEST_SUITE(Expression_Parsers)
+
+namespace {
+    int power(int base, int exponent) {
+        int result = 1;
+        for (int i = 0; i < exponent; i++) {
+            result *= base;
+        }
+        return result;
+    }
+
+    int factorial(int n) {
+        return n <= 1 ? 1 : n * factorial(n - 1);
+    }
+
+    OperatorTable<int> arithmetic() {
+        OperatorTable<int> table;
+        table.infix("+", 1, Associativity::left, std::plus{})
+             .infix("-", 1, Associativity::left, std::minus{})
+             .infix("*", 2, Associativity::left, std::multiplies{})
+             .infix("/", 2, Associativity::left, std::divides{})
+             .infix("^", 4, Associativity::right, power)
+             .prefix("-", 3, std::negate{})
+             .postfix("!", 5, factorial);
+        return table;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Precedence_And_Associativity)
+{
+    Rule<int> expr("expr");
+    expr = expression_parser(int_() << spaces() | char_('(') >> spaces() >> expr << char_(')') << spaces(), arithmetic());
+
+    BOOST_CHECK_EQUAL(*expr.parse("1 + 2 * 3"), 7);
+    BOOST_CHECK_EQUAL(*expr.parse("10 - 4 - 3"), 3);
+    BOOST_CHECK_EQUAL(*expr.parse("2 ^ 3 ^ 2"), 512);
+    BOOST_CHECK_EQUAL(*expr.parse("-2 ^ 2"), -4);
+    BOOST_CHECK_EQUAL(*expr.parse("-2 * 3 + 1"), -5);
+    BOOST_CHECK_EQUAL(*expr.parse("- - 3!"), 6);
+    BOOST_CHECK_EQUAL(*expr.parse("2 * 3! ^ 2"), 72);
+    BOOST_CHECK_EQUAL(*expr.parse("(1 + 2) * (10 - 4) / 3"), 6);
+
+    // an operator without its right operand fails after consuming it
+    string_view input = "1 + * 2";
+    BOOST_CHECK(!expr.parse(input));
+    BOOST_CHECK_EQUAL(input, "* 2");
+    BOOST_CHECK(!expr.parse("+ 1"));
+}
+
+BOOST_AUTO_TEST_CASE(Keywords_And_Non_Associative_Operators)
+{
+    OperatorTable<int> table = arithmetic();
+    table.infix("<", 0, Associativity::none, [](int a, int b) { return int(a < b); })
+         .infix("<=", 0, Associativity::none, [](int a, int b) { return int(a <= b); })
+         .infix("mod", 2, Associativity::left, std::modulus{})
+         .prefix("not", 3, [](int a) { return int(!a); });
+    Parser<int> expr = expression_parser(int_() << spaces(), table);
+
+    // longest symbols, keywords ending at a word boundary
+    BOOST_CHECK_EQUAL(*expr.parse("3 <= 3"), 1);
+    BOOST_CHECK_EQUAL(*expr.parse("17 mod 5 + 1"), 3);
+    BOOST_CHECK_EQUAL(*expr.parse("not 0 < 1 + 1"), 1);
+    string_view input = "7 modulo 4";
+    BOOST_CHECK_EQUAL(*expr.parse(input), 7);
+    BOOST_CHECK_EQUAL(input, "modulo 4");
+
+    // non-associative operators of one precedence don't chain
+    BOOST_CHECK(!expr.parse("1 < 2 < 3"));
+    BOOST_CHECK(!expr.parse("1 < 2 <= 3"));
+    BOOST_CHECK_EQUAL(*expr.parse("1 < 2 * 3"), 1);
+
+    // defining a symbol again replaces it
+    table.infix("mod", 2, Associativity::left, std::plus{});
+    BOOST_CHECK_EQUAL(*expression_parser(int_() << spaces(), table).parse("17 mod 5"), 22);
+}
+
+BOOST_AUTO_TEST_CASE(Expressions_Match_Chains)
+{
+    auto add_op = success(function<int(int, int)>([](int a, int b) { return a + b; }));
+    auto sub_op = success(function<int(int, int)>([](int a, int b) { return a - b; }));
+    auto mul_op = success(function<int(int, int)>([](int a, int b) { return a * b; }));
+
+    function<Parser<int>()> chain_expr, chain_term, chain_factor;
+    chain_factor = [&] { return int_() | char_('(') >> lazy(chain_expr) << char_(')'); };
+    chain_term = [&] { return chainl1(chain_factor(), char_('*') >> mul_op); };
+    chain_expr = [&] { return chainl1(chain_term(), char_('+') >> add_op | char_('-') >> sub_op); };
+
+    Rule<int> expr("expr");
+    expr = expression_parser(int_() | char_('(') >> expr << char_(')'), arithmetic());
+
+    for (string text : { "1", "2+3*4", "2*3-4", "(1+2)*(3-4)*5", "1-2-3*(4+5*(6-7))", "((((8))))", "1+", "(2" }) {
+        ParseResult<int> expected = chain_expr().parse(text);
+        ParseResult<int> result = expr.parse(text);
+        BOOST_REQUIRE_EQUAL(result.has_value(), expected.has_value());
+        if (expected) {
+            BOOST_CHECK_EQUAL(*result, *expected);
+        }
+    }
+
+    Parser<int> arithmetic_expr = expression_parser(digit().transform([](char c) { return c - '0'; }), arithmetic());
+    BOOST_CHECK_EQUAL(*arithmetic_expr.parse("-1+2*3"), 5);
+    BOOST_CHECK(arithmetic_expr.grammar()->kind == GrammarKind::expression);
+    BOOST_CHECK_EQUAL(arithmetic_expr.grammar()->label, "- + - * / ^ !");
+    BOOST_CHECK(first_set(*arithmetic_expr.grammar()).viable('-'));
+    BOOST_CHECK(!first_set(*arithmetic_expr.grammar()).viable('*'));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// ------------------------- Bytecode Machine --------------------------
+
+BOOST_AUTO_TEST_SUITE(Bytecode_Machine)
+
+namespace {
+    // Checks bytecode(p) parses each input as p does, to the same result and rest of input
+    template <typename T>
+    void check_bytecode(const Parser<T>& p, const vector<string>& inputs) {
+        Parser<T> compiled = bytecode(p);
+        BOOST_CHECK(compiled.grammar()->kind == GrammarKind::opaque);
+        check_equivalent(p, [&](string_view& input) { return compiled.parse(input); }, inputs);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Bytecode_Lists)
+{
+    Parser<vector<string>> csv = sep_by1(many(char_satisfy([](char c) { return c != ','; })), char_(','));
+    check_bytecode(csv, { "a,bc,def", "", ",,", "a, b,", "single" });
+
+    Parser<vector<int>> ints = sep_by(int_(), char_(',') << spaces());
+    check_bytecode(ints, { "1, 2, 3", "", "42", "1,", "1, x", "-7,8" });
+
+    Parser<string> terminated = many(any_char() << char_(';'));
+    check_bytecode(terminated, { "a;b;c;", "a;b", "" });
+    check_bytecode(count(3, digit()), { "123", "12", "1234" });
+    check_bytecode(many1(string_("ab")), { "ababa", "abab", "a", "" });
+}
+
+BOOST_AUTO_TEST_CASE(Bytecode_Choices)
+{
+    // the second alternative is only tried when the first consumed nothing
+    Parser<string> keyword = string_("let") | string_("lambda") | string_("if");
+    check_bytecode(keyword, { "let", "lambda", "if", "x", "" });
+    check_bytecode(try_(string_("let")) | string_("lambda"), { "let", "lambda", "lex" });
+
+    Parser<char> sign = char_('+') | char_('-') | success('+');
+    check_bytecode(sign, { "+1", "-1", "1" });
+
+    Parser<optional<string>> suffix = optional_result(char_('.') >> many1(digit()));
+    check_bytecode(suffix, { ".25", "", ".", "x" });
+
+    Parser<string> identifier = not_followed_by(string_("end")) >> many1(letter()) << look_ahead(char_(';'));
+    check_bytecode(identifier, { "name;", "endless;", "end;", "name" });
+}
+
+BOOST_AUTO_TEST_CASE(Bytecode_Shared_Subgrammars)
+{
+    // a subgrammar used twice is compiled once and called
+    Parser<string> word = many1(letter()) << spaces();
+    Parser<vector<string>> words = char_('[') >> many(word) << char_(']') | char_('{') >> many(word) << char_('}');
+    check_bytecode(words, { "[a bc d]", "{x y}", "[}", "[]" });
+
+    // transforms are called out
+    Parser<int> length = word.transform([](const string& s) { return static_cast<int>(s.size()); });
+    check_bytecode(sep_by(length | (char_('#') >> int_()), char_(',')), { "abc,#12,de", "#,", "" });
+
+    // parsers the machine can't run are used as they are
+    Parser<int> number = int_();
+    BOOST_CHECK(bytecode(number).grammar() == number.grammar());
+}
+
+BOOST_AUTO_TEST_CASE(Bytecode_Calls_User_Predicates)
+{
+    // class ops of char_satisfy predicates call them for each byte tested, in order of the alternatives
+    int calls = 0;
+    Parser<string> letters = many(char_('x') | char_satisfy([&calls](char) { return ++calls <= 2; }));
+    Parser<string> compiled = bytecode(letters);
+    BOOST_CHECK_EQUAL(calls, 0);
+
+    ParseResult<string> expected = letters.parse("xaxaa");
+    BOOST_CHECK_EQUAL(calls, 3);
+    calls = 0;
+    ParseResult<string> result = compiled.parse("xaxaa");
+    BOOST_CHECK_EQUAL(calls, 3);
+    BOOST_REQUIRE(result && expected);
+    BOOST_CHECK_EQUAL(*result, *expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// ------------------------- Generated Parsers -------------------------
+
+BOOST_AUTO_TEST_SUITE(Generated_Parsers)
+
+namespace {
+    // Checks the generated parser parses each input as the grammar does, to the same result and rest of input
+    template <typename T>
+    void check_generated(const Parser<T>& p, ParseResult<T>(*generated)(string_view&), const vector<string>& inputs) {
+        check_equivalent(p, generated, inputs);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Generated_Parsers_Match_Grammars)
+{
+    check_generated(test_grammars::csv(), generated::csv, { "a,bc,def", "", ",,", "a, b,", "single" });
+    check_generated(test_grammars::digit_runs(), generated::digit_runs, { "1, 22, 333", "", "42", "1,", "1, x", "-7,8" });
+    check_generated(test_grammars::three_digits(), generated::three_digits, { "123", "12", "1234", "" });
+    check_generated(test_grammars::keyword(), generated::keyword, { "let", "lambda", "if", "x", "" });
+    check_generated(test_grammars::backtracking_keyword(), generated::backtracking_keyword, { "let", "lambda", "lex" });
+    check_generated(test_grammars::sign(), generated::sign, { "+1", "-1", "1" });
+    check_generated(test_grammars::decimals(), generated::decimals, { ".25", "", ".", "x" });
+    check_generated(test_grammars::identifier(), generated::identifier, { "name;", "endless;", "end;", "name" });
+    check_generated(test_grammars::bracketed_words(), generated::bracketed_words, { "[a bc d]", "{x y}", "[}", "[]" });
+}
+
+BOOST_AUTO_TEST_CASE(Generated_Parsers_Are_Current)
+{
+    // generated_parsers.h is written by generate_parsers.cpp before the unit tests are built
+    std::expected<string, string> header = test_grammars::generate_parsers();
+    BOOST_REQUIRE_MESSAGE(header, (header ? "" : header.error()));
+
+    // found as the pre-build step passes it to generate_parsers, relative to the project directory,
+    // unless the path is given after -- on the command line
+    const auto& suite = boost::unit_test::framework::master_test_suite();
+    std::filesystem::path path = suite.argc > 1 ? suite.argv[1] : "tests/generated_parsers.h";
+    std::ifstream file(path);
+    BOOST_REQUIRE_MESSAGE(file, "can't open " << path.string());
+    std::stringstream written;
+    written << file.rdbuf();
+    BOOST_CHECK_MESSAGE(written.str() == *header, "generated_parsers.h is out of date, build Debug UnitTests|x64 or run generate_parsers");
+}
+
+BOOST_AUTO_TEST_CASE(Generator_Limits)
+{
+    // nodes without a C++ spelling are reported
+    ParserGenerator generator("limits");
+    std::expected<void, string> added = generator.add("length", many(digit()).transform([](const string& s) { return static_cast<int>(s.size()); }));
+    BOOST_REQUIRE(!added);
+    BOOST_CHECK(added.error().starts_with("can't generate"));
+    BOOST_CHECK(!generator.add("pair", digit() & letter()));
+
+    // classes are tabulated, as ranges or as a table
+    BOOST_CHECK(generator.add("code", many1(digit() | upper())));
+    BOOST_CHECK(generator.add("odd", many1(char_class([](char c) { return c % 2 != 0; }))));
+    string header = generator.header("LIMITS_H");
+    BOOST_CHECK(header.find("(u >= '0' && u <= '9') || (u >= 'A' && u <= 'Z')") != string::npos);
+    BOOST_CHECK(header.find("static constexpr uint64_t members[4] = { 0xAAAAAAAAAAAAAAAAull") != string::npos);
+    BOOST_CHECK(header.find("limits::detail::length") == string::npos);
+
+    // char_satisfy predicates may be impure, so they aren't tabulated
+    std::expected<void, string> user = generator.add("user", many1(char_satisfy([](char c) { return c % 2 != 0; }) | digit()));
+    BOOST_REQUIRE(!user);
+    BOOST_CHECK(user.error().find("use char_class") != string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// ---------------------------- PEG Grammars ----------------------------
+
+BOOST_AUTO_TEST_SUITE(Peg_Grammars)
+
+BOOST_AUTO_TEST_CASE(Peg_Captures_And_Fields)
+{
+    ParseResult<Grammar> grammar = load_grammar(R"(
+        # a log line
+        entry    <- date:date ' ' level:level ' [' thread:word '] ' message:.*
+        date     <- digit digit digit digit '-' digit digit '-' digit digit
+        digit    <- [0-9]
+        level    <- 'DEBUG' / 'INFO' / 'WARN' / 'ERROR'
+        word     <- [a-zA-Z_0-9]+
+    )");
+    BOOST_REQUIRE(grammar);
+    BOOST_CHECK_EQUAL(grammar->start(), "entry");
+
+    string_view input = "2024-05-01 WARN [main] disk almost full";
+    ParseResult<Fields> fields = grammar->fields().parse(input);
+    BOOST_REQUIRE(fields);
+    BOOST_CHECK_EQUAL((*fields)["date"], "2024-05-01");
+    BOOST_CHECK_EQUAL((*fields)["level"], "WARN");
+    BOOST_CHECK_EQUAL((*fields)["thread"], "main");
+    BOOST_CHECK_EQUAL((*fields)["message"], "disk almost full");
+    BOOST_CHECK(!fields->contains("digit"));
+    BOOST_CHECK(input.empty());
+
+    input = "2024-05-01 INFO [io] ok";
+    ParseResult<Capture> entry = grammar->captures().parse(input);
+    BOOST_REQUIRE(entry);
+    BOOST_CHECK_EQUAL(entry->name, "entry");
+    BOOST_CHECK_EQUAL(entry->text, "2024-05-01 INFO [io] ok");
+    BOOST_REQUIRE_EQUAL(entry->children.size(), 4);
+    BOOST_CHECK_EQUAL(entry->find("thread")->text, "io");
+    BOOST_CHECK(entry->find("digit") == nullptr);
+
+    // a failed match consumes nothing, reporting the start rule
+    input = "2024-05-01 TRACE [main] x";
+    ParseResult<Fields> failed = grammar->fields().parse(input);
+    BOOST_REQUIRE(!failed);
+    BOOST_CHECK(failed.error().message().find("entry") != string::npos);
+    BOOST_CHECK_EQUAL(input.size(), 25);
+}
+
+BOOST_AUTO_TEST_CASE(Peg_Semantics)
+{
+    auto matches = [](const ParseResult<Grammar>& grammar, string_view input) {
+        return grammar->captures().parse(input).has_value();
+    };
+
+    // ordered choice tries the next alternative from where the last started, whatever it consumed
+    ParseResult<Grammar> choice = load_grammar("s = ('ab' / 'a' 'c' | 'a') !.");
+    BOOST_REQUIRE(choice);
+    BOOST_CHECK(matches(choice, "ab"));
+    BOOST_CHECK(matches(choice, "ac"));
+    BOOST_CHECK(matches(choice, "a"));
+    BOOST_CHECK(!matches(choice, "ad"));
+
+    // recursion, predicates and escapes
+    ParseResult<Grammar> nested = load_grammar(R"(
+        list  <- '(' item* ')' !.
+        item  <- '(' item* ')' / atom
+        atom  <- !('(' / ')') [^\x20\t] ;
+    )");
+    BOOST_REQUIRE(nested);
+    BOOST_CHECK(matches(nested, "(a(bc)((d)))"));
+    BOOST_CHECK(!matches(nested, "(a(b c))"));
+    BOOST_CHECK(!matches(nested, "(a(b)"));
+
+    // greedy repetitions don't give input back, captured again the last wins
+    ParseResult<Grammar> greedy = load_grammar("s <- (x:[a-z])* 'z'?");
+    BOOST_REQUIRE(greedy);
+    string_view input = "xyz";
+    ParseResult<Fields> fields = greedy->fields().parse(input);
+    BOOST_REQUIRE(fields);
+    BOOST_CHECK_EQUAL((*fields)["x"], "z");
+    BOOST_CHECK_EQUAL((*fields)["s"], "xyz");
+}
+
+BOOST_AUTO_TEST_CASE(Peg_Load_Errors)
+{
+    auto error = [](string_view text) {
+        ParseResult<Grammar> grammar = load_grammar(text);
+        return grammar ? string() : grammar.error().message();
+    };
+
+    BOOST_CHECK(error("s <- 'a' [b-c] .").empty());
+    BOOST_CHECK(error("s <- 'a").find("end of input") != string::npos);
+    BOOST_CHECK(error("s <- t").find("undefined rule t") != string::npos);
+    BOOST_CHECK(error("s <- 'a'\ns <- 'b'").find("another definition") != string::npos);
+    BOOST_CHECK(error("s <- t 'x'\nt <- 'y'? s").find("left recursive rule") != string::npos);
+    BOOST_CHECK(error("s <- ('a'?)*").find("can match nothing") != string::npos);
+    BOOST_CHECK(error("s <- [z-a]").find("class range in order") != string::npos);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,71 @@
+#ifndef CPPARSEC_TEST_GRAMMARS_H
+#define CPPARSEC_TEST_GRAMMARS_H
+
+#include "../cpparsec_char.h"
+#include "../cpparsec_codegen.h"
+
+// Grammars the tests run both as closures and as the parsers generate_parsers.cpp writes to generated_parsers.h
+namespace test_grammars {
+    using namespace cpparsec;
+
+    inline Parser<std::vector<std::string>> csv() {
+        return sep_by1(many(char_class([](char c) { return c != ','; })), char_(','));
+    }
+
+    inline Parser<std::vector<std::string>> digit_runs() {
+        return sep_by(many1(digit()), char_(',') << spaces());
+    }
+
+    inline Parser<std::vector<char>> three_digits() {
+        return count(3, digit());
+    }
+
+    inline Parser<std::string> keyword() {
+        return string_("let") | string_("lambda") | string_("if");
+    }
+
+    inline Parser<std::string> backtracking_keyword() {
+        return try_(string_("let")) | string_("lambda");
+    }
+
+    inline Parser<char> sign() {
+        return char_('+') | char_('-') | success('+');
+    }
+
+    inline Parser<std::optional<std::string>> decimals() {
+        return optional_result(char_('.') >> many1(digit()));
+    }
+
+    inline Parser<std::string> identifier() {
+        return not_followed_by(string_("end")) >> many1(letter()) << look_ahead(char_(';'));
+    }
+
+    inline Parser<std::vector<std::string>> bracketed_words() {
+        Parser<std::string> word = many1(letter()) << spaces();
+        return char_('[') >> many(word) << char_(']') | char_('{') >> many(word) << char_('}');
+    }
+
+    // The header of the parsers of the grammars, or the error of the first one that can't be generated
+    inline std::expected<std::string, std::string> generate_parsers() {
+        ParserGenerator generator("generated", "../cpparsec_core.h");
+
+        for (const std::expected<void, std::string>& added : {
+            generator.add("csv", csv()),
+            generator.add("digit_runs", digit_runs()),
+            generator.add("three_digits", three_digits()),
+            generator.add("keyword", keyword()),
+            generator.add("backtracking_keyword", backtracking_keyword()),
+            generator.add("sign", sign()),
+            generator.add("decimals", decimals()),
+            generator.add("identifier", identifier()),
+            generator.add("bracketed_words", bracketed_words()) }) {
+            if (!added) {
+                return std::unexpected(added.error());
+            }
+        }
+
+        return generator.header("CPPARSEC_GENERATED_PARSERS_H");
+    }
+};
+
+#endif /* CPPARSEC_TEST_GRAMMARS_H */